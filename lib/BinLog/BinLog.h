@@ -0,0 +1,127 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include "SpscRing.h"
+#include "BinLogFormats.h"
+
+/*************************************
+ *  延迟格式化的二进制日志             *
+ *  热路径只把格式 ID 与参数原始字节   *
+ *  拷入无锁环形缓冲；低优先级线程在   *
+ *  空闲时把字节流送出，主机端解码     *
+ *************************************/
+// 记录格式（小端）：
+//   [0xA5][id][len][timestamp u32][参数 len 字节]
+// 参数按格式串中的转换说明依次编码，见 BinLogFormats.h
+
+enum BinLogId : uint8_t {
+#define BINLOG_X_ID(id, fmt) id,
+    BINLOG_FORMATS(BINLOG_X_ID)
+#undef BINLOG_X_ID
+    BINLOG_COUNT
+};
+
+constexpr const char *BINLOG_FMT[] = {
+#define BINLOG_X_FMT(id, fmt) fmt,
+    BINLOG_FORMATS(BINLOG_X_FMT)
+#undef BINLOG_X_FMT
+};
+
+constexpr uint8_t BINLOG_SYNC       = 0xA5;
+constexpr size_t  BINLOG_HEADER     = 7;   // sync + id + len + timestamp
+constexpr size_t  BINLOG_MAX_RECORD = 64;  // 单条记录上限（含头部）
+constexpr size_t  BINLOG_MAX_STR    = 15;  // 字符串参数截断长度
+
+// 格式串中的参数个数（"%%" 不计）
+constexpr int binlogArgCount(const char *fmt) {
+    int n = 0;
+    for (; *fmt; ++fmt) {
+        if (*fmt != '%') continue;
+        if (fmt[1] == '%') { ++fmt; continue; }
+        ++n;
+    }
+    return n;
+}
+
+namespace binlog_detail {
+
+// 各类参数的编码（返回写入字节数）
+template <class T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, size_t>::type
+put(uint8_t *p, T v) {
+    uint32_t u = (uint32_t)v;
+    memcpy(p, &u, 4);
+    return 4;
+}
+
+template <class T>
+inline typename std::enable_if<std::is_floating_point<T>::value, size_t>::type
+put(uint8_t *p, T v) {
+    float f = (float)v;
+    memcpy(p, &f, 4);
+    return 4;
+}
+
+inline size_t put(uint8_t *p, const char *s) {
+    size_t n = strnlen(s, BINLOG_MAX_STR);
+    p[0] = (uint8_t)n;
+    memcpy(p + 1, s, n);
+    return n + 1;
+}
+
+// 参数编码后的最大字节数，用于编译期检查记录长度
+template <class T>
+constexpr size_t maxSize() {
+    return std::is_pointer<T>::value ? 1 + BINLOG_MAX_STR : 4;
+}
+
+constexpr size_t sum() { return 0; }
+template <class... R>
+constexpr size_t sum(size_t a, R... r) { return a + sum(r...); }
+
+}  // namespace binlog_detail
+
+// RingBytes 为环形缓冲字节数（2 的幂）。写入方与读出方各只能有一个线程
+template <size_t RingBytes>
+class BinLog {
+public:
+    typedef uint32_t (*Clock)();
+
+    // clock 为时间戳来源（如微秒计数器），可为空
+    explicit BinLog(Clock clock = nullptr) : clock_(clock) {}
+
+    /*********** 写入方（热路径） ***********/
+    // 写入一条记录；缓冲剩余空间不足时整条丢弃并计数
+    template <BinLogId ID, class... A>
+    bool write(A... args) {
+        static_assert(ID < BINLOG_COUNT, "unknown log id");
+        static_assert(binlogArgCount(BINLOG_FMT[ID]) == (int)sizeof...(A),
+                      "argument count does not match the format string");
+        static_assert(BINLOG_HEADER + binlog_detail::sum(binlog_detail::maxSize<A>()...)
+                      <= BINLOG_MAX_RECORD, "log record too long");
+
+        uint8_t rec[BINLOG_MAX_RECORD];
+        const uint32_t ts = clock_ ? clock_() : 0;
+        rec[0] = BINLOG_SYNC;
+        rec[1] = ID;
+        memcpy(rec + 3, &ts, 4);
+        size_t n = BINLOG_HEADER;
+        int unused[] = {0, (n += binlog_detail::put(rec + n, args), 0)...};
+        (void)unused;
+        rec[2] = (uint8_t)(n - BINLOG_HEADER);
+        return ring_.pushAll(rec, n);
+    }
+
+    /*********** 读出方（空闲时） ***********/
+    // 取出最多 max 个字节，原样送往串口 / 文件
+    size_t drain(uint8_t *dst, size_t max) { return ring_.popMany(dst, max); }
+
+    bool empty() const { return ring_.empty(); }
+    uint32_t dropped() const { return ring_.overruns(); }  // 因缓冲满丢弃的记录数
+
+private:
+    Clock clock_;
+    SpscRing<uint8_t, RingBytes> ring_;
+};
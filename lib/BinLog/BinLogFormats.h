@@ -0,0 +1,28 @@
+#pragma once
+
+/*************************************
+ *  固件日志格式表                    *
+ *  固件只发送 ID + 原始参数，主机端   *
+ *  logdecode 用同一张表还原文本       *
+ *  只在末尾追加新条目，不要重排或删除 *
+ *  （ID 即条目序号，旧的抓包依赖它）   *
+ *************************************/
+// 参数编码：整数 / bool → 4 字节，float / double → 4 字节 float，
+// const char * → 1 字节长度 + 最多 BINLOG_MAX_STR 个字符
+#define BINLOG_FORMATS(X)                                                               \
+    X(LOG_BOOT,         "Boot\r\n")                                                     \
+    X(LOG_FOUND_IMU,    "Found LSM6DSL at 0x%02X\r\n")                                  \
+    X(LOG_CTRL_REGS,    "CTRL1=%02X CTRL2=%02X CTRL3=%02X\r\n")                         \
+    X(LOG_FREQ_BINS,    "Freq bins: i3=%d i5=%d i7=%d\r\n")                             \
+    X(LOG_CALIB_START,  "Starting calibration...\r\n")                                  \
+    X(LOG_CALIB_DONE,   "Calibration complete. Baselines: ACC[%.3f, %.3f, %.3f] "        \
+                        "GYR[%.3f, %.3f, %.3f]\r\n")                                     \
+    X(LOG_WINDOW,       "--- Window %lu ---\r\n")                                       \
+    X(LOG_RAW,          "RAW %d %d %d %d %d %d\r\n")                                    \
+    X(LOG_FFT_SUMMARY,  "%s 3-5 %.3f@%.1fHz 5-7 %.3f@%.1fHz rms %.3f\r\n")              \
+    X(LOG_DECISION,     "Decision T=%d(%.2f) D=%d(%.2f)\r\n")                           \
+    X(LOG_MOTION,       "Motion detected - Tremor: %d(%.2f) Dyskinesia: %d(%.2f)\r\n")  \
+    X(LOG_OVERRUN,      "Overrun frames=%lu\r\n")                                       \
+    X(LOG_DROPPED,      "Log dropped=%lu\r\n")                                          \
+    X(LOG_TEL_DROPPED,  "Telemetry dropped frames=%lu\r\n")                             \
+    X(LOG_MISSED_TICKS, "Missed ticks=%lu\r\n")
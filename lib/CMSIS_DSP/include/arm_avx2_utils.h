@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_avx2_utils.h
+ * Description:  Utility functions for the x86-64 AVX2/FMA host variants
+ *
+ * Target Processor: x86-64 hosts with AVX2 and FMA
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_UTILS_AVX2_H_
+#define ARM_UTILS_AVX2_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/***************************************
+
+Complex helpers. A __m256 holds 4 complex
+values interleaved as {re, im, re, im, ...}
+
+***************************************/
+
+/* Swap real and imaginary parts */
+__STATIC_FORCEINLINE __m256 arm_avx2_swap_cplx_f32(__m256 x)
+{
+    return _mm256_permute_ps(x, 0xB1);
+}
+
+/* Complex conjugate */
+__STATIC_FORCEINLINE __m256 arm_avx2_conj_f32(__m256 x)
+{
+    return _mm256_xor_ps(x, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+}
+
+/* -i * x */
+__STATIC_FORCEINLINE __m256 arm_avx2_mul_negj_f32(__m256 x)
+{
+    return arm_avx2_conj_f32(arm_avx2_swap_cplx_f32(x));
+}
+
+/* x * w */
+__STATIC_FORCEINLINE __m256 arm_avx2_cmul_f32(__m256 x, __m256 w)
+{
+    __m256 t = _mm256_mul_ps(arm_avx2_swap_cplx_f32(x), _mm256_movehdup_ps(w));
+    return _mm256_fmaddsub_ps(x, _mm256_moveldup_ps(w), t);
+}
+
+/* x * conj(w) */
+__STATIC_FORCEINLINE __m256 arm_avx2_cmul_conj_f32(__m256 x, __m256 w)
+{
+    __m256 t = _mm256_mul_ps(arm_avx2_swap_cplx_f32(x), _mm256_movehdup_ps(w));
+    return _mm256_fmsubadd_ps(x, _mm256_moveldup_ps(w), t);
+}
+
+/* Reverse the order of the 4 complex values */
+__STATIC_FORCEINLINE __m256 arm_avx2_rev_cplx_f32(__m256 x)
+{
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(x), 0x1B));
+}
+
+/* Load the 4 complex values pCplx[idx[0]] ... pCplx[idx[3]] (idx in complex units) */
+__STATIC_FORCEINLINE __m256 arm_avx2_gather_cplx_f32(const float32_t * pCplx, __m128i idx)
+{
+    return _mm256_castpd_ps(_mm256_i32gather_pd((const double *) pCplx, idx, 8));
+}
+
+/* Transpose a 4x4 matrix of complex values held in 4 vectors */
+__STATIC_FORCEINLINE void arm_avx2_transpose4_cplx_f32(__m256 * r0, __m256 * r1, __m256 * r2, __m256 * r3)
+{
+    __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(*r0), _mm256_castps_pd(*r1));
+    __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(*r0), _mm256_castps_pd(*r1));
+    __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(*r2), _mm256_castps_pd(*r3));
+    __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(*r2), _mm256_castps_pd(*r3));
+
+    *r0 = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x20));
+    *r1 = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x20));
+    *r2 = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x31));
+    *r3 = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+/***************************************
+
+Real helpers
+
+***************************************/
+
+/* Mask with the first n (0..8) lanes set, for _mm256_maskload_ps / _mm256_maskstore_ps */
+__STATIC_FORCEINLINE __m256i arm_avx2_head_mask(uint32_t n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t) n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+/* Sum of the 8 lanes */
+__STATIC_FORCEINLINE float32_t arm_avx2_hsum_f32(__m256 x)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+/* {sum(a), sum(b), sum(c), sum(d)} */
+__STATIC_FORCEINLINE __m128 arm_avx2_hsum4_f32(__m256 a, __m256 b, __m256 c, __m256 d)
+{
+    __m256 t = _mm256_hadd_ps(_mm256_hadd_ps(a, b), _mm256_hadd_ps(c, d));
+    return _mm_add_ps(_mm256_castps256_ps128(t), _mm256_extractf128_ps(t, 1));
+}
+
+/* Transpose the 8x8 matrix held in r[0..7] */
+__STATIC_FORCEINLINE void arm_avx2_transpose8_f32(__m256 * r)
+{
+    __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+    __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+    __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+    __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+    __m256 u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+    __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+    __m256 u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+    __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44);
+    __m256 u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+    __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44);
+    __m256 u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+
+    r[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+    r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+    r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+    r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+    r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+    r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+    r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+    r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+}
+
+/*
+  Full linear convolution used by arm_conv_f32 and arm_correlate_f32:
+
+      y[n] = sum_k pH[k * hStride] * x[n - k],   n = 0 .. xLen + hLen - 2
+
+  with x taken as zero outside [0, xLen). y[n] is written to pDst[n * dstStride].
+  8 consecutive outputs are computed per vector; loads that straddle the ends of
+  x are masked (masked-off lanes are not accessed).
+*/
+__STATIC_INLINE void arm_avx2_conv_f32(
+  const float32_t * pX,
+        uint32_t xLen,
+  const float32_t * pH,
+        int32_t hStride,
+        uint32_t hLen,
+        float32_t * pDst,
+        int32_t dstStride)
+{
+    const uint32_t outLen = xLen + hLen - 1U;
+    const __m256i  lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i  vLen = _mm256_set1_epi32((int32_t) xLen);
+    float32_t tmp[8];
+    int32_t n, k, kLo, kHi, kInLo, kInHi, l;
+
+    for (n = 0; n < (int32_t) outLen; n += 8)
+    {
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps();
+        __m256 acc3 = _mm256_setzero_ps();
+
+        /* taps reaching x for at least one lane, and taps whose 8 samples are all inside x */
+        kLo = n - (int32_t) xLen + 1;
+        kLo = kLo > 0 ? kLo : 0;
+        kHi = n + 7 < (int32_t) hLen - 1 ? n + 7 : (int32_t) hLen - 1;
+        kInLo = n + 8 - (int32_t) xLen;
+        kInLo = kInLo > kLo ? kInLo : kLo;
+        kInHi = n < kHi ? n : kHi;
+        if (kInLo > kInHi + 1)
+        {
+            kInLo = kInHi + 1;
+        }
+
+        for (k = kLo; k <= kHi; )
+        {
+            if (k >= kInLo && k <= kInHi)
+            {
+                for (; k + 3 <= kInHi; k += 4)
+                {
+                    acc0 = _mm256_fmadd_ps(_mm256_set1_ps(pH[k * hStride]),       _mm256_loadu_ps(pX + n - k),     acc0);
+                    acc1 = _mm256_fmadd_ps(_mm256_set1_ps(pH[(k + 1) * hStride]), _mm256_loadu_ps(pX + n - k - 1), acc1);
+                    acc2 = _mm256_fmadd_ps(_mm256_set1_ps(pH[(k + 2) * hStride]), _mm256_loadu_ps(pX + n - k - 2), acc2);
+                    acc3 = _mm256_fmadd_ps(_mm256_set1_ps(pH[(k + 3) * hStride]), _mm256_loadu_ps(pX + n - k - 3), acc3);
+                }
+                for (; k <= kInHi; k++)
+                {
+                    acc0 = _mm256_fmadd_ps(_mm256_set1_ps(pH[k * hStride]), _mm256_loadu_ps(pX + n - k), acc0);
+                }
+            }
+            else
+            {
+                const __m256i idx = _mm256_add_epi32(_mm256_set1_epi32(n - k), lane);
+                const __m256i mask = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), idx),
+                                                         _mm256_cmpgt_epi32(vLen, idx));
+
+                acc1 = _mm256_fmadd_ps(_mm256_set1_ps(pH[k * hStride]), _mm256_maskload_ps(pX + n - k, mask), acc1);
+                k++;
+            }
+        }
+
+        acc0 = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+
+        if (dstStride == 1 && n + 8 <= (int32_t) outLen)
+        {
+            _mm256_storeu_ps(pDst + n, acc0);
+        }
+        else
+        {
+            _mm256_storeu_ps(tmp, acc0);
+            for (l = 0; l < 8 && n + l < (int32_t) outLen; l++)
+            {
+                pDst[(n + l) * dstStride] = tmp[l];
+            }
+        }
+    }
+}
+
+#endif /* defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_UTILS_AVX2_H_ */
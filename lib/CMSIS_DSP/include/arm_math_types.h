@@ -140,6 +140,27 @@ extern "C"
   #endif
 #endif
 
+/* ARM_MATH_AVX2 enables the x86-64 AVX2/FMA variants used by host builds.
+ * The API and buffer sizes are the ones of the scalar build.
+ */
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+  #if !defined(__GNUC_PYTHON__) || !defined(__AVX2__) || !defined(__FMA__)
+    #error "ARM_MATH_AVX2 requires a host build (__GNUC_PYTHON__) with -mavx2 -mfma"
+  #endif
+  #include <immintrin.h>
+#endif
+
+/* ARM_MATH_X86_DISPATCH compiles SSE2, AVX2/FMA and AVX-512F variants of a few
+ * kernels into the same binary and selects one per function at load time
+ * (GNU ifunc), so the library itself only needs the x86-64 baseline.
+ */
+#if defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+  #if !defined(__GNUC_PYTHON__) || !defined(__x86_64__) || !defined(__ELF__)
+    #error "ARM_MATH_X86_DISPATCH requires an x86-64 ELF host build (__GNUC_PYTHON__)"
+  #endif
+  #include <immintrin.h>
+#endif
+
 #if !defined(ARM_MATH_AUTOVECTORIZE)
 
 
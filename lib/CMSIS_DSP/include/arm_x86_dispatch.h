@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_dispatch.h
+ * Description:  Load-time ISA selection for the x86-64 host variants
+ *
+ * Target Processor: x86-64 hosts (SSE2 baseline, AVX2/FMA, AVX-512F)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_X86_DISPATCH_H_
+#define ARM_X86_DISPATCH_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief Instruction set selected by the dispatched kernels.
+ */
+typedef enum
+{
+    ARM_X86_ISA_SSE2 = 0,    /**< x86-64 baseline */
+    ARM_X86_ISA_AVX2 = 1,    /**< AVX2 and FMA */
+    ARM_X86_ISA_AVX512 = 2   /**< AVX-512F */
+} arm_x86_isa;
+
+/**
+  @brief  Widest instruction set supported by the running CPU.
+  @return the variant every dispatched kernel resolves to
+  @par
+          Also called from the ifunc resolvers, before the C library is fully
+          initialized: only the compiler's CPU model builtins are used.
+ */
+__STATIC_INLINE arm_x86_isa arm_x86_dispatch_isa(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return ARM_X86_ISA_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return ARM_X86_ISA_AVX2;
+    }
+    return ARM_X86_ISA_SSE2;
+}
+
+#define ARM_X86_TARGET_SSE2   __attribute__((target("sse2")))
+#define ARM_X86_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define ARM_X86_TARGET_AVX512 __attribute__((target("avx512f")))
+
+/*
+  Defines `name` as an ifunc resolved once, when the IRELATIVE relocation is
+  processed, to name##_sse2, name##_avx2 or name##_avx512. Calls then cost one
+  indirect jump through the PLT / GOT entry.
+*/
+#define ARM_X86_DISPATCH(name)                                              \
+    static __typeof__(name##_sse2) * name##_resolve(void)                   \
+    {                                                                       \
+        switch (arm_x86_dispatch_isa())                                     \
+        {                                                                   \
+            case ARM_X86_ISA_AVX512: return name##_avx512;                  \
+            case ARM_X86_ISA_AVX2:   return name##_avx2;                    \
+            default:                 return name##_sse2;                    \
+        }                                                                   \
+    }                                                                       \
+    __typeof__(name##_sse2) name __attribute__((ifunc(#name "_resolve")));
+
+/***************************************
+
+Reductions
+
+***************************************/
+
+ARM_X86_TARGET_SSE2 __STATIC_FORCEINLINE float32_t arm_x86_hsum_sse2(__m128 x)
+{
+    x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 0x55));
+    return _mm_cvtss_f32(x);
+}
+
+ARM_X86_TARGET_SSE2 __STATIC_FORCEINLINE float32_t arm_x86_hmax_sse2(__m128 x)
+{
+    x = _mm_max_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_max_ss(x, _mm_shuffle_ps(x, x, 0x55));
+    return _mm_cvtss_f32(x);
+}
+
+/* Mask of the first n (0..16) lanes of a __m512 */
+__STATIC_FORCEINLINE __mmask16 arm_x86_head_mask16(uint32_t n)
+{
+    return (__mmask16) ((1U << n) - 1U);
+}
+
+/*
+ * Tail of the 16-lane loops: samples i..n-1 with n - i < 16. When the array
+ * holds a full vector, returns n - 16 and masks the last n - i lanes, so the
+ * masked load stays inside the array. A masked load spanning memory past the
+ * end still waits for pending stores there (masked-off lanes included),
+ * which costs ~15 ns when the next buffer was just written. Shorter arrays
+ * fall back to a head mask at i.
+ */
+__STATIC_FORCEINLINE uint32_t arm_x86_tail16(uint32_t i, uint32_t n, __mmask16 *pMask)
+{
+    if (n >= 16U)
+    {
+        *pMask = (__mmask16) ~((1U << (16U - (n - i))) - 1U);
+        return n - 16U;
+    }
+    *pMask = arm_x86_head_mask16(n - i);
+    return i;
+}
+
+/***************************************
+
+Variants. Each dispatched kernel has the signature of the public function;
+they are exported so that benchmarks can call one instruction set directly.
+
+***************************************/
+
+#define ARM_X86_VARIANTS(decl) decl(_sse2) decl(_avx2) decl(_avx512)
+
+#define ARM_X86_DECL_DOT_PROD(sfx) void arm_dot_prod_f32##sfx(const float32_t * pSrcA, const float32_t * pSrcB, uint32_t blockSize, float32_t * result);
+#define ARM_X86_DECL_MULT(sfx) void arm_mult_f32##sfx(const float32_t * pSrcA, const float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+#define ARM_X86_DECL_SCALE(sfx) void arm_scale_f32##sfx(const float32_t * pSrc, float32_t scale, float32_t * pDst, uint32_t blockSize);
+#define ARM_X86_DECL_CMPLX_MAG(sfx) void arm_cmplx_mag_f32##sfx(const float32_t * pSrc, float32_t * pDst, uint32_t numSamples);
+#define ARM_X86_DECL_CMPLX_MAG_SQUARED(sfx) void arm_cmplx_mag_squared_f32##sfx(const float32_t * pSrc, float32_t * pDst, uint32_t numSamples);
+#define ARM_X86_DECL_RMS(sfx) void arm_rms_f32##sfx(const float32_t * pSrc, uint32_t blockSize, float32_t * pResult);
+#define ARM_X86_DECL_VAR(sfx) void arm_var_f32##sfx(const float32_t * pSrc, uint32_t blockSize, float32_t * pResult);
+#define ARM_X86_DECL_ABSMAX(sfx) void arm_absmax_f32##sfx(const float32_t * pSrc, uint32_t blockSize, float32_t * pResult, uint32_t * pIndex);
+
+ARM_X86_VARIANTS(ARM_X86_DECL_DOT_PROD)
+ARM_X86_VARIANTS(ARM_X86_DECL_MULT)
+ARM_X86_VARIANTS(ARM_X86_DECL_SCALE)
+ARM_X86_VARIANTS(ARM_X86_DECL_CMPLX_MAG)
+ARM_X86_VARIANTS(ARM_X86_DECL_CMPLX_MAG_SQUARED)
+ARM_X86_VARIANTS(ARM_X86_DECL_RMS)
+ARM_X86_VARIANTS(ARM_X86_DECL_VAR)
+ARM_X86_VARIANTS(ARM_X86_DECL_ABSMAX)
+
+#endif /* defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_X86_DISPATCH_H_ */
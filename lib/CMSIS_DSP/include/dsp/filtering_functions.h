@@ -1202,6 +1202,40 @@ arm_status arm_fir_decimate_init_f32(
     const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter applied to N planar channels.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of channels filtered with the same coefficients. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_planar_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter applied to N interleaved channels.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels filtered with the same coefficients. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multich_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 transposed direct form II Biquad cascade filter applied to N interleaved channels.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels filtered with the same coefficients. */
+          q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+          uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_multich_df2T_instance_q31;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -1241,6 +1275,48 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N planar channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, channel c at pSrc + c*blockSize.
+   * @param[out] pDst       points to the block of output data, same layout as pSrc.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_planar_df2T_f32(
+  const arm_biquad_cascade_planar_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, sample n of channel c at pSrc[n*numChannels + c].
+   * @param[out] pDst       points to the block of output data, same layout as pSrc.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multich_df2T_f32(
+  const arm_biquad_cascade_multich_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, sample n of channel c at pSrc[n*numChannels + c].
+   * @param[out] pDst       points to the block of output data, same layout as pSrc.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multich_df2T_q31(
+  const arm_biquad_cascade_multich_df2T_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in]  S          points to an instance of the filter data structure.
@@ -1295,6 +1371,56 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N planar channels
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer of length 2*numStages*numChannels.
+   */
+  void arm_biquad_cascade_planar_df2T_init_f32(
+        arm_biquad_cascade_planar_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer of length 2*numStages*numChannels.
+   */
+  void arm_biquad_cascade_multich_df2T_init_f32(
+        arm_biquad_cascade_multich_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the Q31 transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the 64-bit state buffer of length 2*numStages*numChannels.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format.
+   */
+  void arm_biquad_cascade_multich_df2T_init_q31(
+        arm_biquad_cascade_multich_df2T_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const q31_t * pCoeffs,
+        q63_t * pState,
+        uint8_t postShift);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -363,10 +363,23 @@ arm_status arm_mat_mult_f64(
    * @param[out] pDst     points to output vector
    */
 void arm_mat_vec_mult_f32(
-  const arm_matrix_instance_f32 *pSrcMat, 
-  const float32_t *pVec, 
+  const arm_matrix_instance_f32 *pSrcMat,
+  const float32_t *pVec,
   float32_t *pDst);
 
+  /**
+   * @brief Floating-point matrix multiplication of a batch of vectors
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVecs    points to numVecs input vectors, stored one after the other
+   * @param[out] pDst     points to numVecs output vectors, stored one after the other
+   * @param[in]  numVecs  number of vectors
+   */
+void arm_mat_vec_mult_batch_f32(
+  const arm_matrix_instance_f32 *pSrcMat,
+  const float32_t *pVecs,
+  float32_t *pDst,
+  uint32_t numVecs);
+
   /**
    * @brief Q7 matrix multiplication
    * @param[in]  pSrcA   points to the first input matrix structure
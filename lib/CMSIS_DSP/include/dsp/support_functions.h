@@ -493,6 +493,48 @@ const q7_t * pSrc,
         uint32_t blockSize);
 
 
+  /**
+   * @brief  Splits interleaved Q15 frames into floating-point channels, with a per-channel scale and offset.
+   * @param[in]  pSrc         interleaved input frames, numChannels samples per frame
+   * @param[in]  numChannels  number of channels per frame
+   * @param[in]  pScale       scale of each channel
+   * @param[in]  pBias        offset of each channel
+   * @param[out] pDst         first output channel; channel c starts at pDst + c * dstStride
+   * @param[in]  dstStride    distance, in samples, between the starts of two output channels
+   * @param[in]  numFrames    number of frames to process
+   */
+  void arm_deinterleave_q15_to_float(
+  const q15_t * pSrc,
+        uint16_t numChannels,
+  const float32_t * pScale,
+  const float32_t * pBias,
+        float32_t * pDst,
+        uint32_t dstStride,
+        uint32_t numFrames);
+
+
+  /**
+   * @brief  Splits interleaved Q15 frames into Q15 channels, with a per-channel scale and offset.
+   * @param[in]  pSrc         interleaved input frames, numChannels samples per frame
+   * @param[in]  numChannels  number of channels per frame
+   * @param[in]  pScaleFract  fractional part of the scale of each channel
+   * @param[in]  shift        number of bits to shift the result by
+   * @param[in]  pBias        offset of each channel
+   * @param[out] pDst         first output channel; channel c starts at pDst + c * dstStride
+   * @param[in]  dstStride    distance, in samples, between the starts of two output channels
+   * @param[in]  numFrames    number of frames to process
+   */
+  void arm_deinterleave_q15(
+  const q15_t * pSrc,
+        uint16_t numChannels,
+  const q15_t * pScaleFract,
+        int8_t shift,
+  const q15_t * pBias,
+        q15_t * pDst,
+        uint32_t dstStride,
+        uint32_t numFrames);
+
+
 
 
 
@@ -847,8 +847,122 @@ void arm_rfft_fast_f32(
         const arm_rfft_fast_instance_f32 * S,
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the output-pruned floating-point RFFT.
+   */
+typedef struct
+  {
+          arm_rfft_fast_instance_f32 Sub;  /**< Sub-transform of length fftLenSub */
+          uint16_t fftLen;                 /**< length of the real sequence */
+          uint16_t fftLenSub;              /**< length of each decimated sub-transform */
+          uint16_t numSub;                 /**< number of sub-transforms (fftLen / fftLenSub) */
+          uint16_t numBins;                /**< number of output bins (maxBin + 1) */
+    const float32_t * pTwiddle;            /**< combination twiddles (CFFT table of length fftLen) */
+  } arm_rfft_pruned_instance_f32 ;
+
+arm_status arm_rfft_pruned_init_f32(
+         arm_rfft_pruned_instance_f32 * S,
+         uint16_t fftLen,
+         uint16_t maxBin);
+
+  void arm_rfft_pruned_f32(
+        const arm_rfft_pruned_instance_f32 * S,
+        const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch);
 #endif
 
+  /**
+   * @brief Instance structure for the multi-channel floating-point RFFT.
+   */
+typedef struct
+  {
+          arm_cfft_instance_f32 Sint;         /**< CFFT of length fftLenRFFT, two channels per call */
+          arm_rfft_fast_instance_f32 Single;  /**< RFFT for the last channel of an odd count */
+          uint16_t fftLenRFFT;                /**< length of each real sequence */
+  } arm_rfft_fast_multi_instance_f32;
+
+arm_status arm_rfft_fast_multi_init_f32(
+         arm_rfft_fast_multi_instance_f32 * S,
+         uint16_t fftLen);
+
+void arm_rfft_fast_multi_f32(
+  const arm_rfft_fast_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint16_t numChannels);
+
+#define ARM_CFFT_MIXED_MAX_FACTORS 16  /**< maximum number of radix stages */
+#define ARM_CFFT_MIXED_MAX_RADIX   31  /**< largest prime handled by a direct stage; larger primes use Bluestein */
+
+/**
+ * @brief Upper bounds, in float32_t values, of the state and scratch buffers of
+ *        a mixed-radix transform of length N (usable for static allocation).
+ */
+#define ARM_CFFT_MIXED_STATE_LEN_MAX(N)   (10U * (N))
+#define ARM_CFFT_MIXED_SCRATCH_LEN_MAX(N) (8U * (N))
+#define ARM_RFFT_MIXED_STATE_LEN_MAX(N)   (6U * (N))
+#define ARM_RFFT_MIXED_SCRATCH_LEN_MAX(N) (5U * (N))
+
+  /**
+   * @brief Instance structure for the arbitrary-length floating-point CFFT.
+   */
+typedef struct
+  {
+          uint16_t fftLen;                 /**< length of the FFT */
+          uint16_t numStages;              /**< number of radix stages (0 when Bluestein is used) */
+          uint16_t factors[ARM_CFFT_MIXED_MAX_FACTORS]; /**< radix of each stage */
+    const float32_t * pTwiddle;            /**< fftLen complex twiddles exp(-2*pi*i*k/fftLen) */
+          uint16_t blueLen;                /**< Bluestein convolution length (power of two, 0 if unused) */
+    const float32_t * pChirp;              /**< fftLen complex chirp exp(-i*pi*n^2/fftLen) */
+    const float32_t * pChirpFft;           /**< blueLen complex spectrum of the conjugated chirp */
+          arm_cfft_instance_f32 blueCfft;  /**< power-of-two CFFT used by Bluestein */
+  } arm_cfft_mixed_instance_f32;
+
+uint32_t arm_cfft_mixed_state_len_f32(uint16_t fftLen);
+uint32_t arm_cfft_mixed_scratch_len_f32(uint16_t fftLen);
+
+arm_status arm_cfft_mixed_init_f32(
+         arm_cfft_mixed_instance_f32 * S,
+         uint16_t fftLen,
+         float32_t * pState,
+         uint32_t stateLen);
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the arbitrary even-length floating-point RFFT.
+   */
+typedef struct
+  {
+          arm_cfft_mixed_instance_f32 Sint; /**< Internal CFFT of length fftLenRFFT/2 */
+          uint16_t fftLenRFFT;              /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;         /**< fftLenRFFT/2 complex twiddles exp(-2*pi*i*k/fftLenRFFT) */
+  } arm_rfft_mixed_instance_f32;
+
+uint32_t arm_rfft_mixed_state_len_f32(uint16_t fftLen);
+uint32_t arm_rfft_mixed_scratch_len_f32(uint16_t fftLen);
+
+arm_status arm_rfft_mixed_init_f32(
+         arm_rfft_mixed_instance_f32 * S,
+         uint16_t fftLen,
+         float32_t * pState,
+         uint32_t stateLen);
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint8_t ifftFlag);
+
 
   /**
    * @brief Instance structure for the Floating-point MFCC function.
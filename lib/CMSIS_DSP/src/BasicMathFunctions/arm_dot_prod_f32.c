@@ -116,6 +116,112 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_f32(
 
 }
 
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+ARM_X86_TARGET_SSE2 void arm_dot_prod_f32_sse2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  float32_t sum;
+  uint32_t i = 0U;
+
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pSrcA + i),      _mm_loadu_ps(pSrcB + i)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(pSrcA + i + 4U), _mm_loadu_ps(pSrcB + i + 4U)));
+  }
+  if (i + 4U <= blockSize)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pSrcA + i), _mm_loadu_ps(pSrcB + i)));
+    i += 4U;
+  }
+
+  sum = arm_x86_hsum_sse2(_mm_add_ps(acc0, acc1));
+  for (; i < blockSize; i++)
+  {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+
+  *result = sum;
+}
+
+ARM_X86_TARGET_AVX2 void arm_dot_prod_f32_avx2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+  __m128 acc;
+  float32_t sum;
+  uint32_t i = 0U;
+
+  for (; i + 32U <= blockSize; i += 32U)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i),       _mm256_loadu_ps(pSrcB + i),       acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i +  8U), _mm256_loadu_ps(pSrcB + i +  8U), acc1);
+    acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i + 16U), _mm256_loadu_ps(pSrcB + i + 16U), acc2);
+    acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i + 24U), _mm256_loadu_ps(pSrcB + i + 24U), acc3);
+  }
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i), _mm256_loadu_ps(pSrcB + i), acc0);
+  }
+
+  acc0 = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  if (i + 4U <= blockSize)
+  {
+    acc = _mm_fmadd_ps(_mm_loadu_ps(pSrcA + i), _mm_loadu_ps(pSrcB + i), acc);
+    i += 4U;
+  }
+
+  sum = arm_x86_hsum_sse2(acc);
+  for (; i < blockSize; i++)
+  {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+
+  *result = sum;
+}
+
+ARM_X86_TARGET_AVX512 void arm_dot_prod_f32_avx512(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+  __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+  __mmask16 m;
+  uint32_t i = 0U;
+
+  for (; i + 32U <= blockSize; i += 32U)
+  {
+    acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(pSrcA + i),       _mm512_loadu_ps(pSrcB + i),       acc0);
+    acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(pSrcA + i + 16U), _mm512_loadu_ps(pSrcB + i + 16U), acc1);
+  }
+  if (i + 16U <= blockSize)
+  {
+    acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(pSrcA + i), _mm512_loadu_ps(pSrcB + i), acc0);
+    i += 16U;
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, pSrcA + i), _mm512_maskz_loadu_ps(m, pSrcB + i), acc1);
+  }
+
+  *result = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+ARM_X86_DISPATCH(arm_dot_prod_f32)
+
 #else
 
 ARM_DSP_ATTRIBUTE void arm_dot_prod_f32(
@@ -107,6 +107,74 @@ ARM_DSP_ATTRIBUTE void arm_mult_f32(
 
 }
 
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+ARM_X86_TARGET_SSE2 void arm_mult_f32_sse2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t i = 0U;
+
+  for (; i + 4U <= blockSize; i += 4U)
+  {
+    _mm_storeu_ps(pDst + i, _mm_mul_ps(_mm_loadu_ps(pSrcA + i), _mm_loadu_ps(pSrcB + i)));
+  }
+  for (; i < blockSize; i++)
+  {
+    pDst[i] = pSrcA[i] * pSrcB[i];
+  }
+}
+
+ARM_X86_TARGET_AVX2 void arm_mult_f32_avx2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t i = 0U;
+
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    _mm256_storeu_ps(pDst + i, _mm256_mul_ps(_mm256_loadu_ps(pSrcA + i), _mm256_loadu_ps(pSrcB + i)));
+  }
+  if (i + 4U <= blockSize)
+  {
+    _mm_storeu_ps(pDst + i, _mm_mul_ps(_mm_loadu_ps(pSrcA + i), _mm_loadu_ps(pSrcB + i)));
+    i += 4U;
+  }
+  for (; i < blockSize; i++)
+  {
+    pDst[i] = pSrcA[i] * pSrcB[i];
+  }
+}
+
+ARM_X86_TARGET_AVX512 void arm_mult_f32_avx512(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  __mmask16 m;
+  uint32_t i = 0U;
+
+  for (; i + 16U <= blockSize; i += 16U)
+  {
+    _mm512_storeu_ps(pDst + i, _mm512_mul_ps(_mm512_loadu_ps(pSrcA + i), _mm512_loadu_ps(pSrcB + i)));
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    _mm512_mask_storeu_ps(pDst + i, m, _mm512_mul_ps(_mm512_maskz_loadu_ps(m, pSrcA + i),
+                                                     _mm512_maskz_loadu_ps(m, pSrcB + i)));
+  }
+}
+
+ARM_X86_DISPATCH(arm_mult_f32)
+
 #else
 ARM_DSP_ATTRIBUTE void arm_mult_f32(
   const float32_t * pSrcA,
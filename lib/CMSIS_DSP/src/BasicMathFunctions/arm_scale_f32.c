@@ -120,6 +120,76 @@ ARM_DSP_ATTRIBUTE void arm_scale_f32(
 
 }
 
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+ARM_X86_TARGET_SSE2 void arm_scale_f32_sse2(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const __m128 k = _mm_set1_ps(scale);
+  uint32_t i = 0U;
+
+  for (; i + 4U <= blockSize; i += 4U)
+  {
+    _mm_storeu_ps(pDst + i, _mm_mul_ps(_mm_loadu_ps(pSrc + i), k));
+  }
+  for (; i < blockSize; i++)
+  {
+    pDst[i] = pSrc[i] * scale;
+  }
+}
+
+ARM_X86_TARGET_AVX2 void arm_scale_f32_avx2(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const __m256 k = _mm256_set1_ps(scale);
+  uint32_t i = 0U;
+
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    _mm256_storeu_ps(pDst + i, _mm256_mul_ps(_mm256_loadu_ps(pSrc + i), k));
+  }
+  if (i + 4U <= blockSize)
+  {
+    _mm_storeu_ps(pDst + i, _mm_mul_ps(_mm_loadu_ps(pSrc + i), _mm256_castps256_ps128(k)));
+    i += 4U;
+  }
+  for (; i < blockSize; i++)
+  {
+    pDst[i] = pSrc[i] * scale;
+  }
+}
+
+ARM_X86_TARGET_AVX512 void arm_scale_f32_avx512(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const __m512 k = _mm512_set1_ps(scale);
+  __mmask16 m;
+  uint32_t i = 0U;
+
+  for (; i + 16U <= blockSize; i += 16U)
+  {
+    _mm512_storeu_ps(pDst + i, _mm512_mul_ps(_mm512_loadu_ps(pSrc + i), k));
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    _mm512_mask_storeu_ps(pDst + i, m, _mm512_mul_ps(_mm512_maskz_loadu_ps(m, pSrc + i), k));
+  }
+}
+
+ARM_X86_DISPATCH(arm_scale_f32)
+
 #else
 ARM_DSP_ATTRIBUTE void arm_scale_f32(
   const float32_t *pSrc,
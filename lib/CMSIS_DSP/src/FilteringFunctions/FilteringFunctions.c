@@ -40,6 +40,12 @@
 #include "arm_biquad_cascade_df2T_f64.c"
 #include "arm_biquad_cascade_df2T_init_f32.c"
 #include "arm_biquad_cascade_df2T_init_f64.c"
+#include "arm_biquad_cascade_multich_df2T_f32.c"
+#include "arm_biquad_cascade_multich_df2T_init_f32.c"
+#include "arm_biquad_cascade_multich_df2T_init_q31.c"
+#include "arm_biquad_cascade_multich_df2T_q31.c"
+#include "arm_biquad_cascade_planar_df2T_f32.c"
+#include "arm_biquad_cascade_planar_df2T_init_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
 #include "arm_conv_f32.c"
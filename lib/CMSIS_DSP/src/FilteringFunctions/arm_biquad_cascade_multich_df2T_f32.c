@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/* One sample of one channel through one stage */
+__STATIC_FORCEINLINE float32_t arm_biquad_multich_df2T_step_f32(
+  float32_t Xn1,
+  float32_t b0,
+  float32_t b1,
+  float32_t b2,
+  float32_t a1,
+  float32_t a2,
+  float32_t * d1,
+  float32_t * d2)
+{
+  /* y[n] = b0 * x[n] + d1 */
+  /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+  /* d2 = b2 * x[n] + a2 * y[n] */
+  float32_t acc1 = (b0 * Xn1) + *d1;
+
+  *d1 = ((b1 * Xn1) + (a1 * acc1)) + *d2;
+  *d2 = (b2 * Xn1) + (a2 * acc1);
+
+  return acc1;
+}
+
+/*
+ * One stage applied to a group of `width` (1, 2 or 4) adjacent channels.
+ * width is a compile-time constant at every call site, so the unused channel
+ * slots fold away, the state stays in registers and the per-channel
+ * recursions are interleaved instruction by instruction.
+ */
+__STATIC_FORCEINLINE void arm_biquad_multich_df2T_group_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t width,
+  const float32_t * pCoeffs,
+        float32_t * pD1,
+        float32_t * pD2,
+        uint32_t blockSize)
+{
+  float32_t d1a, d1b = 0.0f, d1c = 0.0f, d1d = 0.0f;   /* State variables of the group */
+  float32_t d2a, d2b = 0.0f, d2c = 0.0f, d2d = 0.0f;
+  /* Coefficients are read once: a store through pOut could otherwise alias them */
+  float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];
+  float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+  uint32_t sample;
+
+  d1a = pD1[0];
+  d2a = pD2[0];
+  if (width > 1U)
+  {
+    d1b = pD1[1];
+    d2b = pD2[1];
+  }
+  if (width > 2U)
+  {
+    d1c = pD1[2];
+    d2c = pD2[2];
+    d1d = pD1[3];
+    d2d = pD2[3];
+  }
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    pOut[0] = arm_biquad_multich_df2T_step_f32(pIn[0], b0, b1, b2, a1, a2, &d1a, &d2a);
+    if (width > 1U)
+    {
+      pOut[1] = arm_biquad_multich_df2T_step_f32(pIn[1], b0, b1, b2, a1, a2, &d1b, &d2b);
+    }
+    if (width > 2U)
+    {
+      pOut[2] = arm_biquad_multich_df2T_step_f32(pIn[2], b0, b1, b2, a1, a2, &d1c, &d2c);
+      pOut[3] = arm_biquad_multich_df2T_step_f32(pIn[3], b0, b1, b2, a1, a2, &d1d, &d2d);
+    }
+
+    pIn += numChannels;
+    pOut += numChannels;
+  }
+
+  pD1[0] = d1a;
+  pD2[0] = d2a;
+  if (width > 1U)
+  {
+    pD1[1] = d1b;
+    pD2[1] = d2b;
+  }
+  if (width > 2U)
+  {
+    pD1[2] = d1c;
+    pD2[2] = d2c;
+    pD1[3] = d1d;
+    pD2[3] = d2d;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad cascade filter
+                 applied to interleaved channels sharing the same coefficients.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data. Sample n of channel c is <code>pSrc[n*numChannels + c]</code>
+  @param[out]    pDst      points to the block of output data, same layout as <code>pSrc</code>. Can be equal to <code>pSrc</code>
+  @param[in]     blockSize number of samples to process per channel
+
+  @par           Scheduling
+                   This is the N-channel generalization of \ref arm_biquad_cascade_stereo_df2T_f32.
+                   Within a channel every output depends on the previous one through <code>d1</code>,
+                   so a single-channel cascade runs at the latency of the multiply-accumulate chain
+                   rather than at its throughput. Here each step processes the same sample of up to
+                   4 channels, whose recursions are independent and fill the pipeline slots the single
+                   channel leaves idle. Channels are taken in groups of 4, then 2, then 1; each group
+                   keeps its state in registers and walks the block once per stage, so 6 channels take
+                   two passes per stage (4 + 2). Stepping every channel in a single pass would move the
+                   state of all groups through memory on each sample, which was measured slower.
+  @par           Relation to the planar kernel
+                   \ref arm_biquad_cascade_planar_df2T_f32 filters the same kind of channel set stored
+                   channel by channel (<code>pSrc[c*blockSize + n]</code>); its AVX2 version transposes
+                   8x8 tiles so one vector holds the same sample of 8 channels. This kernel takes the
+                   interleaved layout in which sensor frames arrive and relies on scalar instruction-level
+                   parallelism, which is what a Cortex-M4 without floating-point SIMD can exploit.
+ */
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_multich_df2T_f32(
+  const arm_biquad_cascade_multich_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t stage, ch;                            /* Loop counters */
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    float32_t *pD1 = pState + (2U * stage) * numChannels;
+    float32_t *pD2 = pState + (2U * stage + 1U) * numChannels;
+
+    ch = 0U;
+
+    while (numChannels - ch >= 4U)
+    {
+      arm_biquad_multich_df2T_group_f32(pIn + ch, pDst + ch, numChannels, 4U, pCoeffs, pD1 + ch, pD2 + ch, blockSize);
+      ch += 4U;
+    }
+
+    if (numChannels - ch >= 2U)
+    {
+      arm_biquad_multich_df2T_group_f32(pIn + ch, pDst + ch, numChannels, 2U, pCoeffs, pD1 + ch, pD2 + ch, blockSize);
+      ch += 2U;
+    }
+
+    if (ch < numChannels)
+    {
+      arm_biquad_multich_df2T_group_f32(pIn + ch, pDst + ch, numChannels, 1U, pCoeffs, pD1 + ch, pD2 + ch, blockSize);
+    }
+
+    pCoeffs += 5U;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
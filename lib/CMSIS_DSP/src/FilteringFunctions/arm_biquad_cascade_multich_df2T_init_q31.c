@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df2T_init_q31.c
+ * Description:  Initialization function for Q31 transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 transposed direct form II Biquad cascade filter
+                 applied to interleaved channels sharing the same coefficients.
+  @param[in,out] S           points to an instance of the filter data structure.
+  @param[in]     numStages   number of 2nd order stages in the filter.
+  @param[in]     numChannels number of channels.
+  @param[in]     pCoeffs     points to the filter coefficients.
+  @param[in]     pState      points to the state buffer.
+  @param[in]     postShift   Shift to be applied after the accumulator.  Varies according to the coefficients format
+
+  @par           Coefficient and State Ordering
+                   The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   where <code>b1x</code> and <code>a1x</code> are the coefficients for the first stage,
+                   <code>b2x</code> and <code>a2x</code> are the coefficients for the second stage,
+                   and so on.  The <code>pCoeffs</code> array contains a total of <code>5*numStages</code> values,
+                   in the format described for \ref arm_biquad_cas_df1_32x64_init_q31.
+                   All channels use the same coefficients.
+  @par
+                   The <code>pState</code> points to state variables array in 2.62 format.
+                   Each Biquad stage has 2 state variables <code>d1,</code> and <code>d2</code> for each channel,
+                   arranged as for \ref arm_biquad_cascade_multich_df2T_init_f32:
+  <pre>
+      {d1[stage 1][ch 0..numChannels-1], d2[stage 1][ch 0..numChannels-1], d1[stage 2][...], ...}
+  </pre>
+  @par
+                   The state array has a total length of <code>2*numStages*numChannels</code> values.
+                   The state variables are updated after each block of data is processed; the coefficients are untouched.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_multich_df2T_init_q31(
+        arm_biquad_cascade_multich_df2T_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const q31_t * pCoeffs,
+        q63_t * pState,
+        uint8_t postShift)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * (uint32_t) numChannels) * sizeof(q63_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df2T_q31.c
+ * Description:  Processing function for Q31 transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/* One sample of one channel through one stage */
+__STATIC_FORCEINLINE q31_t arm_biquad_multich_df2T_step_q31(
+  q31_t Xn1,
+  q31_t b0,
+  q31_t b1,
+  q31_t b2,
+  q31_t a1,
+  q31_t a2,
+  q63_t * d1,
+  q63_t * d2,
+  uint32_t shift)
+{
+  /* y[n] = b0 * x[n] + d1 */
+  /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+  /* d2 = b2 * x[n] + a2 * y[n] */
+  q31_t Yn1 = clip_q63_to_q31(((q63_t) b0 * Xn1 + *d1) >> shift);
+
+  *d1 = (q63_t) b1 * Xn1 + (q63_t) a1 * Yn1 + *d2;
+  *d2 = (q63_t) b2 * Xn1 + (q63_t) a2 * Yn1;
+
+  return Yn1;
+}
+
+/*
+ * One stage applied to a group of `width` (1 or 2) adjacent channels, width
+ * being a compile-time constant at every call site (see the f32 version).
+ */
+__STATIC_FORCEINLINE void arm_biquad_multich_df2T_group_q31(
+  const q31_t * pIn,
+        q31_t * pOut,
+        uint32_t numChannels,
+        uint32_t width,
+  const q31_t * pCoeffs,
+        q63_t * pD1,
+        q63_t * pD2,
+        uint32_t shift,
+        uint32_t blockSize)
+{
+  q63_t d1a, d1b = 0, d2a, d2b = 0;                    /* State variables of the group */
+  /* Coefficients are read once: a store through pOut could otherwise alias them */
+  q31_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];
+  q31_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+  uint32_t sample;
+
+  d1a = pD1[0];
+  d2a = pD2[0];
+  if (width > 1U)
+  {
+    d1b = pD1[1];
+    d2b = pD2[1];
+  }
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    pOut[0] = arm_biquad_multich_df2T_step_q31(pIn[0], b0, b1, b2, a1, a2, &d1a, &d2a, shift);
+    if (width > 1U)
+    {
+      pOut[1] = arm_biquad_multich_df2T_step_q31(pIn[1], b0, b1, b2, a1, a2, &d1b, &d2b, shift);
+    }
+
+    pIn += numChannels;
+    pOut += numChannels;
+  }
+
+  pD1[0] = d1a;
+  pD2[0] = d2a;
+  if (width > 1U)
+  {
+    pD1[1] = d1b;
+    pD2[1] = d2b;
+  }
+}
+
+/**
+  @brief         Processing function for the Q31 transposed direct form II Biquad cascade filter
+                 applied to interleaved channels sharing the same coefficients.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data. Sample n of channel c is <code>pSrc[n*numChannels + c]</code>
+  @param[out]    pDst      points to the block of output data, same layout as <code>pSrc</code>. Can be equal to <code>pSrc</code>
+  @param[in]     blockSize number of samples to process per channel
+
+  @par           Scaling and Overflow Behavior
+                   The coefficients are in the same format as for \ref arm_biquad_cas_df1_32x64_q31:
+                   Q31 values scaled down by <code>2^postShift</code>. Every product is a 32x32 bit
+                   multiplication accumulated in 64 bits, and the two state variables of each stage are
+                   kept in 64 bits (2.62 format scaled by <code>2^-postShift</code>), so there is no
+                   truncation inside the recursion. Only the stage output is shifted by
+                   <code>31-postShift</code> bits and saturated to 1.31 format; it is this output
+                   that is fed back. The state does not saturate: the input must be scaled so that
+                   <code>d1</code> and <code>d2</code> stay within <code>2^(1+postShift)</code>.
+  @par           Scheduling
+                   As in \ref arm_biquad_cascade_multich_df2T_f32, each step processes the same sample
+                   of several channels so that their independent recursions overlap. With 64-bit state
+                   the channels are taken in groups of 2, then 1, to stay within the Cortex-M register file.
+                   Each group walks the block once per stage, so 6 channels take three passes per stage.
+ */
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_multich_df2T_q31(
+  const arm_biquad_cascade_multich_df2T_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pIn = pSrc;                             /* Source pointer */
+        q63_t *pState = S->pState;                     /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t shift = 31U - (uint32_t) S->postShift; /* Shift from the 2.62 accumulator to the 1.31 output */
+        uint32_t stage, ch;                            /* Loop counters */
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    q63_t *pD1 = pState + (2U * stage) * numChannels;
+    q63_t *pD2 = pState + (2U * stage + 1U) * numChannels;
+
+    for (ch = 0U; numChannels - ch >= 2U; ch += 2U)
+    {
+      arm_biquad_multich_df2T_group_q31(pIn + ch, pDst + ch, numChannels, 2U, pCoeffs, pD1 + ch, pD2 + ch, shift, blockSize);
+    }
+
+    if (ch < numChannels)
+    {
+      arm_biquad_multich_df2T_group_q31(pIn + ch, pDst + ch, numChannels, 1U, pCoeffs, pD1 + ch, pD2 + ch, shift, blockSize);
+    }
+
+    pCoeffs += 5U;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_planar_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N planar channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad cascade filter
+                 applied to a block of channels sharing the same coefficients.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data. Channel c occupies <code>pSrc[c*blockSize]</code> to <code>pSrc[c*blockSize + blockSize - 1]</code>
+  @param[out]    pDst      points to the block of output data, same layout as <code>pSrc</code>. Can be equal to <code>pSrc</code>
+  @param[in]     blockSize number of samples to process per channel
+
+  @par           Vectorization
+                   The recursion of a biquad cannot be vectorized along time. The channels are
+                   independent though: the AVX2 version filters 8 channels per vector. Each
+                   8x8 tile (8 channels by 8 samples) is transposed so that one vector holds
+                   the same sample of 8 channels, and transposed back after the cascade.
+ */
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_planar_df2T_f32(
+  const arm_biquad_cascade_planar_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs;                            /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t numStages = S->numStages;             /* Number of stages */
+  const float32_t *pIn[8];                             /* Row pointers of the current channel group */
+        float32_t *pOut[8];
+        __m256 r[8];                                   /* Tile: 8 channels x 8 samples */
+        __m256 b0, b1, b2, a1, a2, d1, d2, x;
+        __m256i chMask, tMask;
+        uint32_t ch, nc, t, nt, l, stage;
+
+  for (ch = 0U; ch < numChannels; ch += 8U)
+  {
+    /* Lanes past the last channel duplicate it; they are never stored */
+    nc = (numChannels - ch) < 8U ? (numChannels - ch) : 8U;
+    chMask = arm_avx2_head_mask(nc);
+
+    for (l = 0U; l < 8U; l++)
+    {
+      uint32_t c = ch + (l < nc ? l : nc - 1U);
+
+      pIn[l]  = pSrc + c * blockSize;
+      pOut[l] = pDst + c * blockSize;
+    }
+
+    for (t = 0U; t < blockSize; t += 8U)
+    {
+      nt = (blockSize - t) < 8U ? (blockSize - t) : 8U;
+      tMask = arm_avx2_head_mask(nt);
+
+      for (l = 0U; l < 8U; l++)
+      {
+        r[l] = (nt == 8U) ? _mm256_loadu_ps(pIn[l] + t) : _mm256_maskload_ps(pIn[l] + t, tMask);
+      }
+
+      /* r[j] now holds sample t + j of the 8 channels */
+      arm_avx2_transpose8_f32(r);
+
+      pCoeffs = S->pCoeffs;
+
+      for (stage = 0U; stage < numStages; stage++)
+      {
+        b0 = _mm256_broadcast_ss(pCoeffs + 0);
+        b1 = _mm256_broadcast_ss(pCoeffs + 1);
+        b2 = _mm256_broadcast_ss(pCoeffs + 2);
+        a1 = _mm256_broadcast_ss(pCoeffs + 3);
+        a2 = _mm256_broadcast_ss(pCoeffs + 4);
+        pCoeffs += 5U;
+
+        d1 = _mm256_maskload_ps(pState + (2U * stage) * numChannels + ch, chMask);
+        d2 = _mm256_maskload_ps(pState + (2U * stage + 1U) * numChannels + ch, chMask);
+
+        for (l = 0U; l < nt; l++)
+        {
+          /* y[n] = b0 * x[n] + d1 */
+          /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+          /* d2 = b2 * x[n] + a2 * y[n] */
+          x = r[l];
+          r[l] = _mm256_fmadd_ps(b0, x, d1);
+          d1 = _mm256_fmadd_ps(b1, x, _mm256_fmadd_ps(a1, r[l], d2));
+          d2 = _mm256_fmadd_ps(b2, x, _mm256_mul_ps(a2, r[l]));
+        }
+
+        _mm256_maskstore_ps(pState + (2U * stage) * numChannels + ch, chMask, d1);
+        _mm256_maskstore_ps(pState + (2U * stage + 1U) * numChannels + ch, chMask, d2);
+      }
+
+      arm_avx2_transpose8_f32(r);
+
+      for (l = 0U; l < nc; l++)
+      {
+        if (nt == 8U)
+        {
+          _mm256_storeu_ps(pOut[l] + t, r[l]);
+        }
+        else
+        {
+          _mm256_maskstore_ps(pOut[l] + t, tMask, r[l]);
+        }
+      }
+    }
+  }
+}
+
+#else
+
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_planar_df2T_f32(
+  const arm_biquad_cascade_planar_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn;                                /* Source pointer */
+        float32_t *pOut;                               /* Destination pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs;                            /* Coefficient pointer */
+        float32_t acc1;                                /* Accumulator */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d1, d2;                              /* State variables */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t sample, stage, ch;                    /* Loop counters */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch * blockSize;
+    pOut = pDst + ch * blockSize;
+    pCoeffs = S->pCoeffs;
+
+    for (stage = 0U; stage < S->numStages; stage++)
+    {
+      /* Reading the coefficients */
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[1];
+      b2 = pCoeffs[2];
+      a1 = pCoeffs[3];
+      a2 = pCoeffs[4];
+      pCoeffs += 5U;
+
+      /* Reading the state values of this channel */
+      d1 = pState[(2U * stage) * numChannels + ch];
+      d2 = pState[(2U * stage + 1U) * numChannels + ch];
+
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        /* y[n] = b0 * x[n] + d1 */
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        Xn1 = pIn[sample];
+
+        acc1 = (b0 * Xn1) + d1;
+
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+
+        pOut[sample] = acc1;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[(2U * stage) * numChannels + ch] = d1;
+      pState[(2U * stage + 1U) * numChannels + ch] = d2;
+
+      /* The current stage output is given as the input to the next stage */
+      pIn = pOut;
+    }
+  }
+}
+
+#endif /* defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -249,6 +249,27 @@ ARM_DSP_ATTRIBUTE void arm_conv_f32(
         pA++;
     }
 }
+#elif defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_conv_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst)
+{
+  /* Convolution is commutative: slide the shorter sequence over the longer one */
+  if (srcALen >= srcBLen)
+  {
+    arm_avx2_conv_f32(pSrcA, srcALen, pSrcB, 1, srcBLen, pDst, 1);
+  }
+  else
+  {
+    arm_avx2_conv_f32(pSrcB, srcBLen, pSrcA, 1, srcALen, pDst, 1);
+  }
+}
 #else
 ARM_DSP_ATTRIBUTE void arm_conv_f32(
   const float32_t * pSrcA,
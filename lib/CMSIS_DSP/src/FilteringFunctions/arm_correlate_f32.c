@@ -305,6 +305,35 @@ ARM_DSP_ATTRIBUTE void arm_correlate_f32(
     }
 }
 
+#elif defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+/*
+  Same output layout as the reference implementation: srcB slides across srcA
+  as a convolution with the time-reversed srcB. When srcALen > srcBLen the first
+  (srcALen - srcBLen) outputs are left untouched; when srcALen < srcBLen the
+  roles are swapped and the result is written backwards from the end.
+*/
+ARM_DSP_ATTRIBUTE void arm_correlate_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst)
+{
+  if (srcALen >= srcBLen)
+  {
+    arm_avx2_conv_f32(pSrcA, srcALen, pSrcB + (srcBLen - 1U), -1, srcBLen,
+                      pDst + (srcALen - srcBLen), 1);
+  }
+  else
+  {
+    arm_avx2_conv_f32(pSrcB, srcBLen, pSrcA + (srcALen - 1U), -1, srcALen,
+                      pDst + (srcALen + srcBLen - 2U), -1);
+  }
+}
+
 #else
 ARM_DSP_ATTRIBUTE void arm_correlate_f32(
   const float32_t * pSrcA,
@@ -616,6 +616,87 @@ ARM_DSP_ATTRIBUTE void arm_fir_decimate_f32(
     i--;
   }
 }
+#elif defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+/*
+  The whole input block is appended to the state buffer first. Four outputs are
+  then computed together, each as an 8-wide dot product over the taps (masked
+  loads for the last numTaps % 8 taps) followed by a joint horizontal sum.
+*/
+ARM_DSP_ATTRIBUTE void arm_fir_decimate_f32(
+  const arm_fir_decimate_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *px0, *px1, *px2, *px3;              /* Temporary pointers for state buffer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t M = S->M;                             /* Decimation factor */
+        uint32_t i, k, outBlockSize = blockSize / M;   /* Loop counters */
+  const __m256i tailMask = arm_avx2_head_mask(numTaps & 7U);
+        __m256 acc0, acc1, acc2, acc3, c;
+
+  /* New samples are placed after the (numTaps - 1) samples of the previous block */
+  memcpy(pState + numTaps - 1U, pSrc, blockSize * sizeof(float32_t));
+
+  for (i = 0U; i + 4U <= outBlockSize; i += 4U)
+  {
+    px0 = pState + i * M;
+    px1 = px0 + M;
+    px2 = px1 + M;
+    px3 = px2 + M;
+    acc0 = _mm256_setzero_ps();
+    acc1 = _mm256_setzero_ps();
+    acc2 = _mm256_setzero_ps();
+    acc3 = _mm256_setzero_ps();
+
+    for (k = 0U; k + 8U <= numTaps; k += 8U)
+    {
+      c = _mm256_loadu_ps(pCoeffs + k);
+      acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px0 + k), acc0);
+      acc1 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px1 + k), acc1);
+      acc2 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px2 + k), acc2);
+      acc3 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px3 + k), acc3);
+    }
+
+    if (k < numTaps)
+    {
+      c = _mm256_maskload_ps(pCoeffs + k, tailMask);
+      acc0 = _mm256_fmadd_ps(c, _mm256_maskload_ps(px0 + k, tailMask), acc0);
+      acc1 = _mm256_fmadd_ps(c, _mm256_maskload_ps(px1 + k, tailMask), acc1);
+      acc2 = _mm256_fmadd_ps(c, _mm256_maskload_ps(px2 + k, tailMask), acc2);
+      acc3 = _mm256_fmadd_ps(c, _mm256_maskload_ps(px3 + k, tailMask), acc3);
+    }
+
+    _mm_storeu_ps(pDst + i, arm_avx2_hsum4_f32(acc0, acc1, acc2, acc3));
+  }
+
+  for (; i < outBlockSize; i++)
+  {
+    px0 = pState + i * M;
+    acc0 = _mm256_setzero_ps();
+
+    for (k = 0U; k + 8U <= numTaps; k += 8U)
+    {
+      acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(pCoeffs + k), _mm256_loadu_ps(px0 + k), acc0);
+    }
+
+    if (k < numTaps)
+    {
+      acc0 = _mm256_fmadd_ps(_mm256_maskload_ps(pCoeffs + k, tailMask),
+                             _mm256_maskload_ps(px0 + k, tailMask), acc0);
+    }
+
+    pDst[i] = arm_avx2_hsum_f32(acc0);
+  }
+
+  /* Copy the last (numTaps - 1) samples to the start of the state buffer */
+  memmove(pState, pState + outBlockSize * M, (numTaps - 1U) * sizeof(float32_t));
+}
 #else
 ARM_DSP_ATTRIBUTE void arm_fir_decimate_f32(
   const arm_fir_decimate_instance_f32 * S,
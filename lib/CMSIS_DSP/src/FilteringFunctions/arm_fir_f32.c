@@ -907,6 +907,84 @@ uint32_t blockSize)
    }
 
 }
+#elif defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+/*
+  The whole input block is appended to the state buffer first. Outputs are then
+  computed 32 (then 8) at a time: each tap multiplies a broadcast coefficient
+  with unaligned loads of the delayed samples.
+*/
+ARM_DSP_ATTRIBUTE void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, k;                                 /* Loop counters */
+        __m256 acc0, acc1, acc2, acc3, c;
+        float32_t acc;
+
+  /* New samples are placed after the (numTaps - 1) samples of the previous block */
+  memcpy(pState + numTaps - 1U, pSrc, blockSize * sizeof(float32_t));
+
+  for (i = 0U; i + 32U <= blockSize; i += 32U)
+  {
+    px = pState + i;
+    acc0 = _mm256_setzero_ps();
+    acc1 = _mm256_setzero_ps();
+    acc2 = _mm256_setzero_ps();
+    acc3 = _mm256_setzero_ps();
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      c = _mm256_broadcast_ss(pCoeffs + k);
+      acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k),       acc0);
+      acc1 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k +  8U), acc1);
+      acc2 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k + 16U), acc2);
+      acc3 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k + 24U), acc3);
+    }
+
+    _mm256_storeu_ps(pDst + i,       acc0);
+    _mm256_storeu_ps(pDst + i +  8U, acc1);
+    _mm256_storeu_ps(pDst + i + 16U, acc2);
+    _mm256_storeu_ps(pDst + i + 24U, acc3);
+  }
+
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    px = pState + i;
+    acc0 = _mm256_setzero_ps();
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc0 = _mm256_fmadd_ps(_mm256_broadcast_ss(pCoeffs + k), _mm256_loadu_ps(px + k), acc0);
+    }
+
+    _mm256_storeu_ps(pDst + i, acc0);
+  }
+
+  for (; i < blockSize; i++)
+  {
+    px = pState + i;
+    acc = 0.0f;
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc += px[k] * pCoeffs[k];
+    }
+
+    pDst[i] = acc;
+  }
+
+  /* Copy the last (numTaps - 1) samples to the start of the state buffer */
+  memmove(pState, pState + blockSize, (numTaps - 1U) * sizeof(float32_t));
+}
 #else
 ARM_DSP_ATTRIBUTE void arm_fir_f32(
   const arm_fir_instance_f32 * S,
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_householder_f16.c
+ * Description:  Floating-point (half precision) Householder transform
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions_f16.h"
+#include <math.h>
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixHouseholder
+  @{
+ */
+
+/**
+  @brief         Householder transform of a floating point vector.
+  @param[in]     pSrc        points to the input vector.
+  @param[in]     threshold   norm2 threshold.
+  @param[in]     blockSize   dimension of the vector space.
+  @param[out]    pOut        points to the output vector.
+  @return        beta        return the scaling factor beta
+
+  @par
+                   The output vector v (with v[0] = 1) and beta define the reflection
+                   H = I - beta v v^t such that H pSrc is a multiple of the first basis vector.
+                   When the norm of pSrc[1..blockSize-1] is below the threshold, the vector is
+                   left unchanged: beta is 0 and v is the first basis vector.
+                   pOut may be the same buffer as pSrc.
+ */
+ARM_DSP_ATTRIBUTE float16_t arm_householder_f16(
+    const float16_t * pSrc,
+    const float16_t threshold,
+    uint32_t    blockSize,
+    float16_t * pOut
+    )
+{
+  _Float16 epsilon = threshold;
+  _Float16 alpha = pSrc[0];
+  _Float16 beta, x1norm2, r;
+  uint32_t i;
+
+  x1norm2 = 0.0f16;
+  for (i = 1U; i < blockSize; i++)
+  {
+    x1norm2 += (_Float16)pSrc[i] * (_Float16)pSrc[i];
+  }
+
+  if (x1norm2 <= epsilon)
+  {
+    pOut[0] = 1.0f16;
+    for (i = 1U; i < blockSize; i++)
+    {
+      pOut[i] = 0.0f16;
+    }
+    beta = 0.0f16;
+  }
+  else
+  {
+    beta = (_Float16) sqrtf(alpha * alpha + x1norm2);
+    if (alpha > 0.0f16)
+    {
+      beta = -beta;
+    }
+
+    r = 1.0f16 / (alpha - beta);
+    for (i = 1U; i < blockSize; i++)
+    {
+      pOut[i] = (_Float16)pSrc[i] * r;
+    }
+    pOut[0] = 1.0f16;
+
+    beta = (beta - alpha) / beta;
+  }
+
+  return (beta);
+}
+
+/**
+  @} end of MatrixHouseholder group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
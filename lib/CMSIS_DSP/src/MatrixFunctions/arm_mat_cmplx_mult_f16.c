@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cmplx_mult_f16.c
+ * Description:  Floating-point complex matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup CmplxMatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point complex matrix multiplication.
+  @param[in]     pSrcA      points to first input complex matrix structure
+  @param[in]     pSrcB      points to second input complex matrix structure
+  @param[out]    pDst       points to output complex matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_cmplx_mult_f16(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        arm_matrix_instance_f16 * pDst)
+{
+  const float16_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+        float16_t *pOut = pDst->pData;                /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, k;                          /* loop counters */
+  _Float16 sumReal, sumImag;                        /* accumulators */
+  _Float16 a0, a1, b0, b1;                          /* real and imaginary parts of the operands */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        const float16_t *pA = pSrcA->pData + 2U * row * numColsA;
+        const float16_t *pB = pInB + 2U * col;
+
+        sumReal = 0.0f16;
+        sumImag = 0.0f16;
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* (a0 + j a1) * (b0 + j b1) = (a0 b0 - a1 b1) + j (a0 b1 + a1 b0) */
+          a0 = *pA++;
+          a1 = *pA++;
+          b0 = pB[0];
+          b1 = pB[1];
+          pB += 2U * numColsB;
+
+          sumReal += a0 * b0;
+          sumReal -= a1 * b1;
+          sumImag += a0 * b1;
+          sumImag += a1 * b0;
+        }
+
+        *pOut++ = (float16_t) sumReal;
+        *pOut++ = (float16_t) sumImag;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of CmplxMatrixMult group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cmplx_mult_f32.c
+ * Description:  Floating-point complex matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup CmplxMatrixMult Complex Matrix Multiplication
+
+  Complex Matrix multiplication is only defined if the number of columns of the
+  first matrix equals the number of rows of the second matrix.
+  Multiplying an <code>M x N</code> matrix with an <code>N x P</code> matrix results
+  in an <code>M x P</code> matrix.
+  @par
+  When matrix size checking is enabled, the functions check:
+   - that the inner dimensions of <code>pSrcA</code> and <code>pSrcB</code> are equal;
+   - that the size of the output matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+  @par
+  Complex elements are stored interleaved (real, imaginary).
+ */
+
+/**
+  @addtogroup CmplxMatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point complex matrix multiplication.
+  @param[in]     pSrcA      points to first input complex matrix structure
+  @param[in]     pSrcB      points to second input complex matrix structure
+  @param[out]    pDst       points to output complex matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_cmplx_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+        float32_t *pOut = pDst->pData;                /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, k;                          /* loop counters */
+  float32_t sumReal, sumImag;                        /* accumulators */
+  float32_t a0, a1, b0, b1;                          /* real and imaginary parts of the operands */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        const float32_t *pA = pSrcA->pData + 2U * row * numColsA;
+        const float32_t *pB = pInB + 2U * col;
+
+        sumReal = 0.0f;
+        sumImag = 0.0f;
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* (a0 + j a1) * (b0 + j b1) = (a0 b0 - a1 b1) + j (a0 b1 + a1 b0) */
+          a0 = *pA++;
+          a1 = *pA++;
+          b0 = pB[0];
+          b1 = pB[1];
+          pB += 2U * numColsB;
+
+          sumReal += a0 * b0;
+          sumReal -= a1 * b1;
+          sumImag += a0 * b1;
+          sumImag += a1 * b0;
+        }
+
+        *pOut++ = sumReal;
+        *pOut++ = sumImag;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of CmplxMatrixMult group
+ */
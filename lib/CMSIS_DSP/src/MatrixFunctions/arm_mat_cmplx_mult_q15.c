@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cmplx_mult_q15.c
+ * Description:  Q15 complex matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup CmplxMatrixMult
+  @{
+ */
+
+/**
+  @brief         Q15 complex matrix multiplication.
+  @param[in]     pSrcA      points to first input complex matrix structure
+  @param[in]     pSrcB      points to second input complex matrix structure
+  @param[out]    pDst       points to output complex matrix structure
+  @param[in]     pScratch   points to the array for storing intermediate results
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator. The inputs to the
+                   multiplications are in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   This approach provides 33 guard bits and there is no risk of overflow. The 34.30 result is then
+                   truncated to 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.
+  @par
+                   <code>pScratch</code> holds the transposed second matrix (2 * numRowsB * numColsB values).
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_cmplx_mult_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pScratch)
+{
+  const q15_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+        q15_t *pOut = pDst->pData;                /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix B */
+  uint32_t row, col, k;                          /* loop counters */
+  q63_t sumReal, sumImag;                        /* accumulators */
+  q63_t a0, a1, b0, b1;                          /* real and imaginary parts of the operands */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Transpose B into pScratch so that every dot product reads two contiguous rows */
+    for (row = 0U; row < numRowsB; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        pScratch[2U * (col * numRowsB + row)]      = pInB[2U * (row * numColsB + col)];
+        pScratch[2U * (col * numRowsB + row) + 1U] = pInB[2U * (row * numColsB + col) + 1U];
+      }
+    }
+
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        const q15_t *pA = pSrcA->pData + 2U * row * numColsA;
+        const q15_t *pB = pScratch + 2U * col * numRowsB;
+
+        sumReal = 0;
+        sumImag = 0;
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* (a0 + j a1) * (b0 + j b1) = (a0 b0 - a1 b1) + j (a0 b1 + a1 b0) */
+          a0 = *pA++;
+          a1 = *pA++;
+          b0 = pB[0];
+          b1 = pB[1];
+          pB += 2U;
+
+          sumReal += a0 * b0;
+          sumReal -= a1 * b1;
+          sumImag += a0 * b1;
+          sumImag += a1 * b0;
+        }
+
+        *pOut++ = (q15_t) __SSAT((sumReal >> 15), 16);
+        *pOut++ = (q15_t) __SSAT((sumImag >> 15), 16);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of CmplxMatrixMult group
+ */
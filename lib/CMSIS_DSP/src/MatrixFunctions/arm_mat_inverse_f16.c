@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_f16.c
+ * Description:  Floating-point (half precision) matrix inverse
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions_f16.h"
+#include "dsp/matrix_utils.h"
+#include <math.h>
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixInv
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix inverse.
+  @param[in]     pSrc      points to input matrix structure. The source matrix is modified by the function.
+  @param[out]    pDst      points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_f16(
+  const arm_matrix_instance_f16 * pSrc,
+        arm_matrix_instance_f16 * pDst)
+{
+  float16_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  float16_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of input matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of input matrix */
+  _Float16 pivot, newPivot, factor;                 /* pivot and row multiplier */
+  uint32_t selectedRow, rowNb, column, i;        /* loop counters */
+  arm_status status;                             /* status of matrix inverse */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Gauss-Jordan elimination: the row operations reducing pSrc to the
+       identity turn the identity in pDst into the inverse */
+    for (i = 0U; i < numRows * numCols; i++)
+    {
+      pOut[i] = 0.0f16;
+    }
+    for (i = 0U; i < numRows; i++)
+    {
+      pOut[i * numCols + i] = 1.0f16;
+    }
+
+    for (column = 0U; column < numCols; column++)
+    {
+      /* Partial pivoting: largest magnitude in the column, on or below the diagonal */
+      pivot = (_Float16)pIn[column * numCols + column];
+      selectedRow = column;
+      for (rowNb = column + 1U; rowNb < numRows; rowNb++)
+      {
+        newPivot = (_Float16)pIn[rowNb * numCols + column];
+        if ((_Float16) fabsf(newPivot) > (_Float16) fabsf(pivot))
+        {
+          selectedRow = rowNb;
+          pivot = newPivot;
+        }
+      }
+
+      if (pivot == 0.0f16)
+      {
+        return ARM_MATH_SINGULAR;
+      }
+
+      if (selectedRow != column)
+      {
+        SWAP_ROWS_F16(pSrc, column, column, selectedRow);
+        SWAP_ROWS_F16(pDst, 0, column, selectedRow);
+      }
+
+      /* Unit pivot */
+      pivot = 1.0f16 / pivot;
+      SCALE_ROW_F16(pSrc, column, pivot, column);
+      SCALE_ROW_F16(pDst, 0, pivot, column);
+
+      /* Clear the column in every other row */
+      for (rowNb = 0U; rowNb < numRows; rowNb++)
+      {
+        if (rowNb != column)
+        {
+          factor = (_Float16)pIn[rowNb * numCols + column];
+          if (factor != 0.0f16)
+          {
+            MAS_ROW_F16(column, pSrc, rowNb, factor, pSrc, column);
+            MAS_ROW_F16(0, pDst, rowNb, factor, pDst, column);
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixInv group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
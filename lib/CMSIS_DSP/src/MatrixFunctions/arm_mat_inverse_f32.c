@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_f32.c
+ * Description:  Floating-point matrix inverse
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+#include <math.h>
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixInv Matrix Inverse
+
+  Computes the inverse of a matrix.
+
+  The inverse is defined only if the input matrix is square and non-singular (the determinant
+  is non-zero). The function checks that the input and output matrices are square and of the
+  same size.
+
+  Matrix inversion is numerically sensitive and the CMSIS DSP library only supports matrix
+  inversion of floating-point matrices.
+
+  @par Algorithm
+  The Gauss-Jordan method is used to find the inverse.
+  The algorithm performs a sequence of elementary row-operations until it
+  reduces the input matrix to an identity matrix. Applying the same sequence
+  of elementary row-operations to an identity matrix yields the inverse matrix.
+  Rows are exchanged to use the largest available pivot (partial pivoting).
+  If the input matrix is singular, then the algorithm terminates and returns error status
+  <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+  @addtogroup MatrixInv
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix inverse.
+  @param[in]     pSrc      points to input matrix structure. The source matrix is modified by the function.
+  @param[out]    pDst      points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of input matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of input matrix */
+  float32_t pivot, newPivot, factor;                 /* pivot and row multiplier */
+  uint32_t selectedRow, rowNb, column, i;        /* loop counters */
+  arm_status status;                             /* status of matrix inverse */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Gauss-Jordan elimination: the row operations reducing pSrc to the
+       identity turn the identity in pDst into the inverse */
+    for (i = 0U; i < numRows * numCols; i++)
+    {
+      pOut[i] = 0.0f;
+    }
+    for (i = 0U; i < numRows; i++)
+    {
+      pOut[i * numCols + i] = 1.0f;
+    }
+
+    for (column = 0U; column < numCols; column++)
+    {
+      /* Partial pivoting: largest magnitude in the column, on or below the diagonal */
+      pivot = pIn[column * numCols + column];
+      selectedRow = column;
+      for (rowNb = column + 1U; rowNb < numRows; rowNb++)
+      {
+        newPivot = pIn[rowNb * numCols + column];
+        if (fabsf(newPivot) > fabsf(pivot))
+        {
+          selectedRow = rowNb;
+          pivot = newPivot;
+        }
+      }
+
+      if (pivot == 0.0f)
+      {
+        return ARM_MATH_SINGULAR;
+      }
+
+      if (selectedRow != column)
+      {
+        SWAP_ROWS_F32(pSrc, column, column, selectedRow);
+        SWAP_ROWS_F32(pDst, 0, column, selectedRow);
+      }
+
+      /* Unit pivot */
+      pivot = 1.0f / pivot;
+      SCALE_ROW_F32(pSrc, column, pivot, column);
+      SCALE_ROW_F32(pDst, 0, pivot, column);
+
+      /* Clear the column in every other row */
+      for (rowNb = 0U; rowNb < numRows; rowNb++)
+      {
+        if (rowNb != column)
+        {
+          factor = pIn[rowNb * numCols + column];
+          if (factor != 0.0f)
+          {
+            MAS_ROW_F32(column, pSrc, rowNb, factor, pSrc, column);
+            MAS_ROW_F32(0, pDst, rowNb, factor, pDst, column);
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixInv group
+ */
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f64.c
+ * Description:  Floating-point (double precision) LDL decomposition
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
+#include <math.h>
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Floating-point LDL^t decomposition of positive semi-definite matrix.
+  @param[in]     pSrc   points to the instance of the input floating-point matrix structure.
+  @param[out]    pl   points to the instance of the output floating-point triangular matrix structure.
+  @param[out]    pd   points to the instance of the output floating-point diagonal matrix structure.
+  @param[out]    pp   points to the instance of the output floating-point permutation vector.
+  @return        The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Input matrix cannot be decomposed
+  @par
+                   Computes the LDL^t decomposition of a matrix A such that P A P^t = L D L^t,
+                   that is A(pp[i], pp[j]) = (L D L^t)(i, j).
+                   The largest remaining diagonal term is used as pivot at each step, so a
+                   semi-definite matrix ends with a block of zero pivots: the corresponding
+                   entries of D are zero and the columns of L are those of the identity.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pl,
+        arm_matrix_instance_f64 * pd,
+        uint16_t * pp)
+{
+  const uint32_t n = pSrc->numRows;
+  float64_t *pL = pl->pData;
+  float64_t *pD = pd->pData;
+  uint32_t i, k, w, c, m, diag;
+  uint16_t tmpIdx;
+  float64_t a, x, tol;
+  arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pl->numRows != pl->numCols)     ||
+      (pd->numRows != pd->numCols)     ||
+      (pl->numRows != pd->numRows)     ||
+      (pSrc->numRows != pl->numRows)     )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (i = 0U; i < n * n; i++)
+    {
+      pL[i] = pSrc->pData[i];
+    }
+    /* Pivots below tol, relative to the largest diagonal term, are rounding noise */
+    tol = 0.0;
+    for (k = 0U; k < n; k++)
+    {
+      pp[k] = (uint16_t) k;
+      if (fabs(pL[k * n + k]) > tol)
+      {
+        tol = fabs(pL[k * n + k]);
+      }
+    }
+    tol = tol * 1.0e-14;
+
+    for (k = 0U; k < n; k++)
+    {
+      /* Diagonal pivoting */
+      m = k;
+      a = pL[k * n + k];
+      for (w = k + 1U; w < n; w++)
+      {
+        if (pL[w * n + w] > a)
+        {
+          a = pL[w * n + w];
+          m = w;
+        }
+      }
+
+      if (m != k)
+      {
+        SWAP_ROWS_F64(pl, 0, k, m);
+        SWAP_COLS_F64(pl, k, k, m);
+        tmpIdx = pp[k];
+        pp[k] = pp[m];
+        pp[m] = tmpIdx;
+      }
+
+      a = pL[k * n + k];
+      if (fabs(a) <= tol)
+      {
+        /* The remaining block is zero */
+        break;
+      }
+      if (a < 0.0)
+      {
+        /* Negative pivot: the matrix is not semi-definite */
+        return ARM_MATH_DECOMPOSITION_FAILURE;
+      }
+
+      /* Rank one update of the trailing block, kept symmetric */
+      for (w = k + 1U; w < n; w++)
+      {
+        x = pL[w * n + k] / a;
+        for (c = k + 1U; c < n; c++)
+        {
+          pL[w * n + c] -= x * pL[c * n + k];
+        }
+      }
+      for (w = k + 1U; w < n; w++)
+      {
+        pL[w * n + k] /= a;
+      }
+    }
+    diag = k;
+
+    /* Split into unit lower triangular L and diagonal D */
+    for (i = 0U; i < n * n; i++)
+    {
+      pD[i] = 0.0;
+    }
+    for (i = 0U; i < n; i++)
+    {
+      if (i < diag)
+      {
+        pD[i * n + i] = pL[i * n + i];
+      }
+      pL[i * n + i] = 1.0;
+      for (c = i + 1U; c < n; c++)
+      {
+        pL[i * n + c] = 0.0;
+      }
+      if (i >= diag)
+      {
+        for (c = diag; c < i; c++)
+        {
+          pL[i * n + c] = 0.0;
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_f32.c
+ * Description:  Floating-point matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixMult Matrix Multiplication
+
+  Multiplies two matrices.
+
+  @par Multiplication of two 3x3 matrices:
+
+  \f[
+  \begin{pmatrix}
+   a_{1,1} & a_{1,2} & a_{1,3} \\
+   a_{2,1} & a_{2,2} & a_{2,3} \\
+   a_{3,1} & a_{3,2} & a_{3,3} \\
+  \end{pmatrix}
+
+  \begin{pmatrix}
+   b_{1,1} & b_{1,2} & b_{1,3} \\
+   b_{2,1} & b_{2,2} & b_{2,3} \\
+   b_{3,1} & b_{3,2} & b_{3,3} \\
+  \end{pmatrix}
+  =
+  \begin{pmatrix}
+   a_{1,1} b_{1,1}+a_{1,2} b_{2,1}+a_{1,3} b_{3,1} & a_{1,1} b_{1,2}+a_{1,2} b_{2,2}+a_{1,3} b_{3,2} & a_{1,1} b_{1,3}+a_{1,2} b_{2,3}+a_{1,3} b_{3,3} \\
+   a_{2,1} b_{1,1}+a_{2,2} b_{2,1}+a_{2,3} b_{3,1} & a_{2,1} b_{1,2}+a_{2,2} b_{2,2}+a_{2,3} b_{3,2} & a_{2,1} b_{1,3}+a_{2,2} b_{2,3}+a_{2,3} b_{3,3} \\
+   a_{3,1} b_{1,1}+a_{3,2} b_{2,1}+a_{3,3} b_{3,1} & a_{3,1} b_{1,2}+a_{3,2} b_{2,2}+a_{3,3} b_{3,2} & a_{3,1} b_{1,3}+a_{3,2} b_{2,3}+a_{3,3} b_{3,3} \\
+  \end{pmatrix}
+  \f]
+
+  Matrix multiplication is only defined if the number of columns of the
+  first matrix equals the number of rows of the second matrix.
+  Multiplying an <code>M x N</code> matrix with an <code>N x P</code> matrix results
+  in an <code>M x P</code> matrix.
+  When matrix size checking is enabled, the functions check: (1) that the inner dimensions of
+  <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output
+  matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/*
+  Panel sizes of the blocked loop nest. A KC x NC panel of B (16 KB with the
+  defaults) is reused by every row of A, so it should fit in the L1 data cache
+  of the host; on cores without a data cache the loop nest degenerates to the
+  register-blocked kernel with no extra cost (a 64 x 64 product is one panel).
+ */
+#ifndef ARM_MAT_MULT_F32_KC
+#define ARM_MAT_MULT_F32_KC 64U
+#endif
+#ifndef ARM_MAT_MULT_F32_NC
+#define ARM_MAT_MULT_F32_NC 64U
+#endif
+
+/*
+  C[0..3][0..3] (+)= A[0..3][0..kc-1] * B[0..kc-1][0..3]
+  16 accumulators and 8 operands fit the 32 single-precision registers of
+  the Cortex-M4 FPU: each step does 16 MACs for 8 loads.
+ */
+__STATIC_FORCEINLINE void arm_mat_mult_f32_4x4(
+  const float32_t * pA, uint32_t strideA,
+  const float32_t * pB, uint32_t strideB,
+        float32_t * pC, uint32_t strideC,
+        uint32_t kc, uint32_t accumulate)
+{
+  float32_t c00, c01, c02, c03, c10, c11, c12, c13;
+  float32_t c20, c21, c22, c23, c30, c31, c32, c33;
+  float32_t a0, a1, a2, a3, b0, b1, b2, b3;
+  uint32_t k;
+
+  if (accumulate)
+  {
+    c00 = pC[0];               c01 = pC[1];               c02 = pC[2];               c03 = pC[3];
+    c10 = pC[strideC];         c11 = pC[strideC + 1];     c12 = pC[strideC + 2];     c13 = pC[strideC + 3];
+    c20 = pC[2 * strideC];     c21 = pC[2 * strideC + 1]; c22 = pC[2 * strideC + 2]; c23 = pC[2 * strideC + 3];
+    c30 = pC[3 * strideC];     c31 = pC[3 * strideC + 1]; c32 = pC[3 * strideC + 2]; c33 = pC[3 * strideC + 3];
+  }
+  else
+  {
+    c00 = c01 = c02 = c03 = 0.0f;
+    c10 = c11 = c12 = c13 = 0.0f;
+    c20 = c21 = c22 = c23 = 0.0f;
+    c30 = c31 = c32 = c33 = 0.0f;
+  }
+
+  for (k = 0U; k < kc; k++)
+  {
+    a0 = pA[k];
+    a1 = pA[strideA + k];
+    a2 = pA[2 * strideA + k];
+    a3 = pA[3 * strideA + k];
+    b0 = pB[0];
+    b1 = pB[1];
+    b2 = pB[2];
+    b3 = pB[3];
+    pB += strideB;
+
+    c00 += a0 * b0; c01 += a0 * b1; c02 += a0 * b2; c03 += a0 * b3;
+    c10 += a1 * b0; c11 += a1 * b1; c12 += a1 * b2; c13 += a1 * b3;
+    c20 += a2 * b0; c21 += a2 * b1; c22 += a2 * b2; c23 += a2 * b3;
+    c30 += a3 * b0; c31 += a3 * b1; c32 += a3 * b2; c33 += a3 * b3;
+  }
+
+  pC[0] = c00;               pC[1] = c01;               pC[2] = c02;               pC[3] = c03;
+  pC[strideC] = c10;         pC[strideC + 1] = c11;     pC[strideC + 2] = c12;     pC[strideC + 3] = c13;
+  pC[2 * strideC] = c20;     pC[2 * strideC + 1] = c21; pC[2 * strideC + 2] = c22; pC[2 * strideC + 3] = c23;
+  pC[3 * strideC] = c30;     pC[3 * strideC + 1] = c31; pC[3 * strideC + 2] = c32; pC[3 * strideC + 3] = c33;
+}
+
+/*
+  Edge tiles (fewer than 4 rows or columns): one output row at a time,
+  up to 4 columns, so B is still read along its rows.
+ */
+static void arm_mat_mult_f32_edge(
+  const float32_t * pA, uint32_t strideA,
+  const float32_t * pB, uint32_t strideB,
+        float32_t * pC, uint32_t strideC,
+        uint32_t mr, uint32_t nr, uint32_t kc, uint32_t accumulate)
+{
+  float32_t c0, c1, c2, c3, a;
+  const float32_t *pb;
+  uint32_t i, j, k;
+
+  for (i = 0U; i < mr; i++)
+  {
+    for (j = 0U; j + 4U <= nr; j += 4U)
+    {
+      c0 = accumulate ? pC[j]      : 0.0f;
+      c1 = accumulate ? pC[j + 1U] : 0.0f;
+      c2 = accumulate ? pC[j + 2U] : 0.0f;
+      c3 = accumulate ? pC[j + 3U] : 0.0f;
+      pb = pB + j;
+      for (k = 0U; k < kc; k++)
+      {
+        a = pA[k];
+        c0 += a * pb[0];
+        c1 += a * pb[1];
+        c2 += a * pb[2];
+        c3 += a * pb[3];
+        pb += strideB;
+      }
+      pC[j] = c0;
+      pC[j + 1U] = c1;
+      pC[j + 2U] = c2;
+      pC[j + 3U] = c3;
+    }
+    for (; j < nr; j++)
+    {
+      c0 = accumulate ? pC[j] : 0.0f;
+      pb = pB + j;
+      for (k = 0U; k < kc; k++)
+      {
+        c0 += pA[k] * *pb;
+        pb += strideB;
+      }
+      pC[j] = c0;
+    }
+    pA += strideA;
+    pC += strideC;
+  }
+}
+
+/**
+  @brief         Floating-point matrix multiplication.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Blocking
+                   The product is computed in 4 x 4 output tiles held in registers, each
+                   tile reading 4 rows of A and a 4-column strip of B along its rows.
+                   For large matrices the loop nest is blocked in panels of
+                   ARM_MAT_MULT_F32_KC rows by ARM_MAT_MULT_F32_NC columns of B so that
+                   a panel stays in the data cache while all rows of A use it.
+                   Partial sums of the panels are accumulated in pDst, which must
+                   therefore not overlap the inputs.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;          /* input data matrix pointer B */
+        float32_t *pOut = pDst->pData;           /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t jc, pc, i, j, nc, kc, acc;            /* panel and tile indices */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    if (numColsA == 0U)
+    {
+      /* Empty inner dimension: the product is zero */
+      for (i = 0U; i < numRowsA * numColsB; i++)
+      {
+        pOut[i] = 0.0f;
+      }
+    }
+    else if ((numRowsA < 4U) || (numColsB < 4U))
+    {
+      /* Narrower than one register tile: nothing to block */
+      arm_mat_mult_f32_edge(pInA, numColsA, pInB, numColsB, pOut, numColsB,
+                            numRowsA, numColsB, numColsA, 0U);
+    }
+    else
+    {
+      for (jc = 0U; jc < numColsB; jc += ARM_MAT_MULT_F32_NC)
+      {
+        nc = (numColsB - jc < ARM_MAT_MULT_F32_NC) ? numColsB - jc : ARM_MAT_MULT_F32_NC;
+
+        for (pc = 0U; pc < numColsA; pc += ARM_MAT_MULT_F32_KC)
+        {
+          kc = (numColsA - pc < ARM_MAT_MULT_F32_KC) ? numColsA - pc : ARM_MAT_MULT_F32_KC;
+          /* The first panel initializes the output, the next ones accumulate */
+          acc = (pc != 0U);
+
+          for (i = 0U; i + 4U <= numRowsA; i += 4U)
+          {
+            for (j = 0U; j + 4U <= nc; j += 4U)
+            {
+              arm_mat_mult_f32_4x4(pInA + i * numColsA + pc, numColsA,
+                                   pInB + pc * numColsB + jc + j, numColsB,
+                                   pOut + i * numColsB + jc + j, numColsB, kc, acc);
+            }
+            if (j < nc)
+            {
+              arm_mat_mult_f32_edge(pInA + i * numColsA + pc, numColsA,
+                                    pInB + pc * numColsB + jc + j, numColsB,
+                                    pOut + i * numColsB + jc + j, numColsB, 4U, nc - j, kc, acc);
+            }
+          }
+          if (i < numRowsA)
+          {
+            arm_mat_mult_f32_edge(pInA + i * numColsA + pc, numColsA,
+                                  pInB + pc * numColsB + jc, numColsB,
+                                  pOut + i * numColsB + jc, numColsB, numRowsA - i, nc, kc, acc);
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
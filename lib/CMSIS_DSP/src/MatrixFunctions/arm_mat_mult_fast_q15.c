@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_fast_q15.c
+ * Description:  Q15 matrix multiplication (fast variant)
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix multiplication (fast variant).
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @param[in]     pState     points to the array for storing intermediate results
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The difference between the function \ref arm_mat_mult_q15() and this fast variant is that
+                   the fast variant uses a 32-bit rather than a 64-bit accumulator.
+                   The result of each 1.15 x 1.15 multiplication is a full precision 2.30 value.
+                   These intermediate results are accumulated in a 32-bit register in 2.30 format.
+                   Finally, the accumulator is saturated and converted to a 1.15 result.
+  @par
+                   The fast version has the same overflow behavior as the standard version but provides
+                   fewer guard bits. In order to avoid overflows completely the input signals must be
+                   scaled down. Scale down the inputs by log2(numColsA) bits to avoid overflows,
+                   as a total of numColsA additions are performed internally.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_fast_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pState)
+{
+  const q15_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+        q15_t *pOut = pDst->pData;                /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix B */
+  uint32_t row, col, k;                          /* loop counters */
+  q31_t sum;                                     /* accumulator */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Transpose B into pState so that every dot product reads two contiguous rows */
+    for (row = 0U; row < numRowsB; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        pState[col * numRowsB + row] = pInB[row * numColsB + col];
+      }
+    }
+
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        const q15_t *pA = pSrcA->pData + row * numColsA;
+        const q15_t *pB;
+
+        sum = 0;
+        pB = pState + col * numRowsB;
+        k = 0U;
+#if defined (ARM_MATH_DSP)
+        /* Two MACs per instruction on packed halfwords */
+        for (; k + 2U <= numColsA; k += 2U)
+        {
+          sum = (q31_t) __SMLAD(read_q15x2_ia(&pA), read_q15x2_ia(&pB), sum);
+        }
+#endif
+        for (; k < numColsA; k++)
+        {
+          sum += (q31_t) *pA++ * *pB++;
+        }
+        *pOut++ = (q15_t) __SSAT((sum >> 15), 16);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
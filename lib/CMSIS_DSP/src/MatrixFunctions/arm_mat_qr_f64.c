@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_f64.c
+ * Description:  Floating-point (double precision) matrix QR decomposition
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixQR
+  @{
+ */
+
+/**
+  @brief         QR decomposition of a m x n floating point matrix with m >= n.
+  @param[in]     pSrc      points to input matrix structure. The source matrix is modified by the function.
+  @param[in]     threshold norm2 threshold.
+  @param[out]    pOutR     points to output R matrix structure of dimension m x n
+  @param[out]    pOutQ     points to output Q matrix structure of dimension m x m
+  @param[out]    pOutTau   points to Householder scaling factors of dimension n
+  @param[inout]  pTmpA     points to a temporary vector of dimension m.
+  @param[inout]  pTmpB     points to a temporary vector of dimension n.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par
+                   pSrc = Q R with Q orthogonal and R upper triangular. Column k of R is reduced
+                   by the Householder reflection of \ref arm_householder_f64() (scaling factor
+                   pOutTau[k]); Q is the product of the n reflections.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_qr_f64(
+    const arm_matrix_instance_f64 * pSrc,
+    const float64_t threshold,
+    arm_matrix_instance_f64 * pOutR,
+    arm_matrix_instance_f64 * pOutQ,
+    float64_t * pOutTau,
+    float64_t *pTmpA,
+    float64_t *pTmpB
+    )
+{
+  const uint32_t m = pSrc->numRows;
+  const uint32_t n = pSrc->numCols;
+  float64_t *pR = pOutR->pData;
+  float64_t *pQ = pOutQ->pData;
+  uint32_t col, i, j, nb;
+  int32_t c;
+  float64_t beta, s;
+  arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols)  ||
+      (pOutR->numRows != pSrc->numRows) ||
+      (pOutR->numCols != pSrc->numCols) ||
+      (pOutQ->numRows != pSrc->numRows) ||
+      (pOutQ->numCols != pSrc->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (i = 0U; i < m * n; i++)
+    {
+      pR[i] = pSrc->pData[i];
+    }
+
+    for (col = 0U; col < n; col++)
+    {
+      nb = m - col;
+
+      /* Reflection v, beta of the column from the diagonal down */
+      for (i = 0U; i < nb; i++)
+      {
+        pTmpA[i] = pR[(col + i) * n + col];
+      }
+      beta = arm_householder_f64(pTmpA, threshold, nb, pTmpA);
+      pOutTau[col] = beta;
+
+      /* R(col:, col:) -= beta v (v^t R(col:, col:)) */
+      for (j = col; j < n; j++)
+      {
+        s = 0.0;
+        for (i = 0U; i < nb; i++)
+        {
+          s += pTmpA[i] * pR[(col + i) * n + j];
+        }
+        pTmpB[j - col] = s;
+      }
+      for (i = 0U; i < nb; i++)
+      {
+        s = beta * pTmpA[i];
+        for (j = col; j < n; j++)
+        {
+          pR[(col + i) * n + j] -= s * pTmpB[j - col];
+        }
+      }
+
+      /* Keep v under the diagonal for the accumulation of Q */
+      for (i = 1U; i < nb; i++)
+      {
+        pR[(col + i) * n + col] = pTmpA[i];
+      }
+    }
+
+    /* Q = H(0) H(1) ... H(n-1), applied from the last reflection to the identity */
+    for (i = 0U; i < m * m; i++)
+    {
+      pQ[i] = 0.0;
+    }
+    for (i = 0U; i < m; i++)
+    {
+      pQ[i * m + i] = 1.0;
+    }
+    for (c = (int32_t) n - 1; c >= 0; c--)
+    {
+      col = (uint32_t) c;
+      nb = m - col;
+      beta = pOutTau[col];
+      pTmpA[0] = 1.0;
+      for (i = 1U; i < nb; i++)
+      {
+        pTmpA[i] = pR[(col + i) * n + col];
+      }
+
+      for (j = col; j < m; j++)
+      {
+        s = 0.0;
+        for (i = 0U; i < nb; i++)
+        {
+          s += pTmpA[i] * pQ[(col + i) * m + j];
+        }
+        s = s * beta;
+        for (i = 0U; i < nb; i++)
+        {
+          pQ[(col + i) * m + j] -= s * pTmpA[i];
+        }
+      }
+    }
+
+    /* R is upper triangular */
+    for (i = 1U; i < m; i++)
+    {
+      for (j = 0U; (j < i) && (j < n); j++)
+      {
+        pR[i * n + j] = 0.0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixQR group
+ */
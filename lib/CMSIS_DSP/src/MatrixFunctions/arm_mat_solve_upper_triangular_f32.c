@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f32.c
+ * Description:  Solve upper triangular system
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixSolveUpperTriangular Solve upper triangular system
+
+  Solves UT . X = A where UT is an upper triangular matrix.
+ */
+
+/**
+  @addtogroup MatrixSolveUpperTriangular
+  @{
+ */
+
+/**
+  @brief         Solve UT . X = A where UT is an upper triangular matrix
+  @param[in]     ut  The upper triangular matrix
+  @param[in]     a   The matrix a
+  @param[out]    dst The solution X of UT . X = A
+  @return        The function returns ARM_MATH_SINGULAR, if the system can't be solved.
+  @par
+                   Each column of A is solved by backward substitution.
+                   dst may be the same matrix as a.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+        arm_matrix_instance_f32 * dst)
+{
+  const float32_t *pT = ut->pData;
+  const float32_t *pA = a->pData;
+        float32_t *pX = dst->pData;
+  uint32_t n = dst->numRows;
+  uint32_t cols = dst->numCols;
+  uint32_t j;
+  int32_t i, k;
+  float32_t tmp;
+  arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((ut->numRows != ut->numCols) ||
+      (ut->numRows != a->numRows)   ||
+      (a->numRows != dst->numRows)   ||
+      (a->numCols != dst->numCols)     )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (j = 0U; j < cols; j++)
+    {
+      for (i = (int32_t) n - 1; i >= 0; i--)
+      {
+        tmp = pA[i * cols + j];
+        for (k = i + 1; k < (int32_t) n; k++)
+        {
+          tmp -= pT[i * n + k] * pX[k * cols + j];
+        }
+
+        if (pT[i * n + i] == 0.0f)
+        {
+          return ARM_MATH_SINGULAR;
+        }
+        pX[i * cols + j] = tmp / pT[i * n + i];
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixSolveUpperTriangular group
+ */
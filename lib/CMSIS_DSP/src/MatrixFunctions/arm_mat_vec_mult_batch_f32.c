@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_batch_f32.c
+ * Description:  Floating-point matrix multiplication of a batch of vectors
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix multiplication of a batch of vectors.
+  @param[in]     pSrcMat  points to the input matrix structure (numRows x numCols)
+  @param[in]     pVecs    points to numVecs input vectors of numCols values, stored one after the other
+  @param[out]    pDst     points to numVecs output vectors of numRows values, stored one after the other
+  @param[in]     numVecs  number of vectors
+
+  @par           Description
+                   Output vector v is the product of the matrix with input vector v,
+                   as computed by \ref arm_mat_vec_mult_f32(). The batch is processed
+                   2 matrix rows by 4 vectors at a time: each loaded matrix coefficient
+                   serves 4 vectors and each vector sample 2 rows, which halves the
+                   loads per multiply-accumulate compared to one call per vector and
+                   amortizes the call overhead that dominates for small matrices.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_batch_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVecs,
+        float32_t * pDst,
+        uint32_t numVecs)
+{
+    uint32_t numRows = pSrcMat->numRows;
+    uint32_t numCols = pSrcMat->numCols;
+    const float32_t *pA = pSrcMat->pData;
+    const float32_t *pA0, *pA1, *pX0, *pX1, *pX2, *pX3;
+    float32_t *pY;
+    uint32_t v, row, k;
+    float32_t s00, s01, s02, s03, s10, s11, s12, s13, a0, a1, x0, x1, x2, x3;
+
+    for (v = 0U; v + 4U <= numVecs; v += 4U)
+    {
+        pX0 = pVecs + v * numCols;
+        pX1 = pX0 + numCols;
+        pX2 = pX1 + numCols;
+        pX3 = pX2 + numCols;
+        pY = pDst + v * numRows;
+
+        for (row = 0U; row + 2U <= numRows; row += 2U)
+        {
+            pA0 = pA + row * numCols;
+            pA1 = pA0 + numCols;
+            s00 = s01 = s02 = s03 = 0.0f;
+            s10 = s11 = s12 = s13 = 0.0f;
+            for (k = 0U; k < numCols; k++)
+            {
+                a0 = pA0[k];
+                a1 = pA1[k];
+                x0 = pX0[k];
+                x1 = pX1[k];
+                x2 = pX2[k];
+                x3 = pX3[k];
+                s00 += a0 * x0; s01 += a0 * x1; s02 += a0 * x2; s03 += a0 * x3;
+                s10 += a1 * x0; s11 += a1 * x1; s12 += a1 * x2; s13 += a1 * x3;
+            }
+            pY[row] = s00;                    pY[row + 1U] = s10;
+            pY[numRows + row] = s01;          pY[numRows + row + 1U] = s11;
+            pY[2U * numRows + row] = s02;     pY[2U * numRows + row + 1U] = s12;
+            pY[3U * numRows + row] = s03;     pY[3U * numRows + row + 1U] = s13;
+        }
+
+        if (row < numRows)
+        {
+            pA0 = pA + row * numCols;
+            s00 = s01 = s02 = s03 = 0.0f;
+            for (k = 0U; k < numCols; k++)
+            {
+                a0 = pA0[k];
+                s00 += a0 * pX0[k];
+                s01 += a0 * pX1[k];
+                s02 += a0 * pX2[k];
+                s03 += a0 * pX3[k];
+            }
+            pY[row] = s00;
+            pY[numRows + row] = s01;
+            pY[2U * numRows + row] = s02;
+            pY[3U * numRows + row] = s03;
+        }
+    }
+
+    /* Remaining vectors */
+    for (; v < numVecs; v++)
+    {
+        arm_mat_vec_mult_f32(pSrcMat, pVecs + v * numCols, pDst + v * numRows);
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f16.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_f16(const arm_matrix_instance_f16 *pSrcMat, const float16_t *pVec, float16_t *pDst)
+{
+    uint32_t numRows = pSrcMat->numRows;
+    uint32_t numCols = pSrcMat->numCols;
+    const float16_t *pA = pSrcMat->pData;
+    const float16_t *pA0, *pA1;
+    uint32_t row, k;
+    _Float16 sum0, sum1;
+    _Float16 x;
+
+    /* Two rows per pass share each load of the vector */
+    for (row = 0U; row + 2U <= numRows; row += 2U)
+    {
+        pA0 = pA + row * numCols;
+        pA1 = pA0 + numCols;
+        sum0 = 0.0f16;
+        sum1 = 0.0f16;
+        for (k = 0U; k < numCols; k++)
+        {
+            x = pVec[k];
+            sum0 += (_Float16) pA0[k] * x;
+            sum1 += (_Float16) pA1[k] * x;
+        }
+        *pDst++ = (float16_t) sum0;
+        *pDst++ = (float16_t) sum1;
+    }
+
+    if (row < numRows)
+    {
+        pA0 = pA + row * numCols;
+        sum0 = 0.0f16;
+        for (k = 0U; k < numCols; k++)
+        {
+            sum0 += (_Float16) pA0[k] * pVec[k];
+        }
+        *pDst = (float16_t) sum0;
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
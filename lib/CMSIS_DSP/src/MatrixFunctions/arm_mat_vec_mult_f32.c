@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f32.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixVectMult Matrix Vector Multiplication
+
+  Multiplies a matrix and a vector.
+
+  The batched variant \ref arm_mat_vec_mult_batch_f32() applies the same matrix to
+  many vectors stored one after the other, which is the product <code>X * A^T</code>
+  of the row-major vector block <code>X</code> with the transposed matrix.
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_f32(const arm_matrix_instance_f32 *pSrcMat, const float32_t *pVec, float32_t *pDst)
+{
+    uint32_t numRows = pSrcMat->numRows;
+    uint32_t numCols = pSrcMat->numCols;
+    const float32_t *pA = pSrcMat->pData;
+    const float32_t *pA0, *pA1, *pA2, *pA3;
+    uint32_t row, k;
+    float32_t sum0, sum1, sum2, sum3, x;
+
+    /* Four rows per pass share each load of the vector */
+    for (row = 0U; row + 4U <= numRows; row += 4U)
+    {
+        pA0 = pA + row * numCols;
+        pA1 = pA0 + numCols;
+        pA2 = pA1 + numCols;
+        pA3 = pA2 + numCols;
+        sum0 = sum1 = sum2 = sum3 = 0.0f;
+        for (k = 0U; k < numCols; k++)
+        {
+            x = pVec[k];
+            sum0 += pA0[k] * x;
+            sum1 += pA1[k] * x;
+            sum2 += pA2[k] * x;
+            sum3 += pA3[k] * x;
+        }
+        *pDst++ = sum0;
+        *pDst++ = sum1;
+        *pDst++ = sum2;
+        *pDst++ = sum3;
+    }
+
+    for (; row < numRows; row++)
+    {
+        pA0 = pA + row * numCols;
+        sum0 = 0.0f;
+        for (k = 0U; k < numCols; k++)
+        {
+            sum0 += pA0[k] * pVec[k];
+        }
+        *pDst++ = sum0;
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q31.c
+ * Description:  Q31 matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q31 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator. The inputs to the
+                   multiplications are in 1.31 format and multiplications yield a 2.62 result.
+                   There is no saturation on intermediate additions. The input should be scaled
+                   down by log2(numCols) bits to avoid overflows. The 2.62 accumulator is right
+                   shifted by 31 bits to yield the 1.31 result.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_q31(const arm_matrix_instance_q31 *pSrcMat, const q31_t *pVec, q31_t *pDst)
+{
+    uint32_t numRows = pSrcMat->numRows;
+    uint32_t numCols = pSrcMat->numCols;
+    const q31_t *pA = pSrcMat->pData;
+    const q31_t *pA0, *pA1;
+    uint32_t row, k;
+    q63_t sum0, sum1;
+    q63_t x;
+
+    /* Two rows per pass share each load of the vector */
+    for (row = 0U; row + 2U <= numRows; row += 2U)
+    {
+        pA0 = pA + row * numCols;
+        pA1 = pA0 + numCols;
+        sum0 = 0;
+        sum1 = 0;
+        for (k = 0U; k < numCols; k++)
+        {
+            x = pVec[k];
+            sum0 += (q63_t) pA0[k] * x;
+            sum1 += (q63_t) pA1[k] * x;
+        }
+        *pDst++ = (q31_t) (sum0 >> 31);
+        *pDst++ = (q31_t) (sum1 >> 31);
+    }
+
+    if (row < numRows)
+    {
+        pA0 = pA + row * numCols;
+        sum0 = 0;
+        for (k = 0U; k < numCols; k++)
+        {
+            sum0 += (q63_t) pA0[k] * pVec[k];
+        }
+        *pDst = (q31_t) (sum0 >> 31);
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
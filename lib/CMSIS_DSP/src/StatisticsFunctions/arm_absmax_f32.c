@@ -121,6 +121,171 @@ ARM_DSP_ATTRIBUTE void arm_absmax_f32(
 }
 
 
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+/*
+  First pass: largest magnitude. Second pass: first index holding it, which
+  is the index the generic version reports on ties.
+*/
+ARM_X86_TARGET_SSE2 void arm_absmax_f32_sse2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+  __m128 vMax = _mm_setzero_ps(), v;
+  float32_t out = 0.0f;
+  uint32_t i, bits;
+
+  for (i = 0U; i + 4U <= blockSize; i += 4U)
+  {
+    vMax = _mm_max_ps(vMax, _mm_and_ps(_mm_loadu_ps(pSrc + i), absMask));
+  }
+  out = arm_x86_hmax_sse2(vMax);
+  for (; i < blockSize; i++)
+  {
+    out = fabsf(pSrc[i]) > out ? fabsf(pSrc[i]) : out;
+  }
+
+  *pResult = out;
+  *pIndex = 0U;
+  v = _mm_set1_ps(out);
+  for (i = 0U; i + 4U <= blockSize; i += 4U)
+  {
+    bits = (uint32_t) _mm_movemask_ps(_mm_cmpeq_ps(_mm_and_ps(_mm_loadu_ps(pSrc + i), absMask), v));
+    if (bits)
+    {
+      *pIndex = i + (uint32_t) __builtin_ctz(bits);
+      return;
+    }
+  }
+  for (; i < blockSize; i++)
+  {
+    if (fabsf(pSrc[i]) == out)
+    {
+      *pIndex = i;
+      return;
+    }
+  }
+}
+
+ARM_X86_TARGET_AVX2 void arm_absmax_f32_avx2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+  __m256 vMax0 = _mm256_setzero_ps(), vMax1 = _mm256_setzero_ps(), v;
+  __m128 vMax;
+  float32_t out;
+  uint32_t i, bits;
+
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    vMax0 = _mm256_max_ps(vMax0, _mm256_and_ps(_mm256_loadu_ps(pSrc + i), absMask));
+    vMax1 = _mm256_max_ps(vMax1, _mm256_and_ps(_mm256_loadu_ps(pSrc + i + 8U), absMask));
+  }
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    vMax0 = _mm256_max_ps(vMax0, _mm256_and_ps(_mm256_loadu_ps(pSrc + i), absMask));
+  }
+  vMax0 = _mm256_max_ps(vMax0, vMax1);
+  vMax = _mm_max_ps(_mm256_castps256_ps128(vMax0), _mm256_extractf128_ps(vMax0, 1));
+  if (i + 4U <= blockSize)
+  {
+    vMax = _mm_max_ps(vMax, _mm_and_ps(_mm_loadu_ps(pSrc + i), _mm256_castps256_ps128(absMask)));
+    i += 4U;
+  }
+  out = arm_x86_hmax_sse2(vMax);
+  for (; i < blockSize; i++)
+  {
+    out = fabsf(pSrc[i]) > out ? fabsf(pSrc[i]) : out;
+  }
+
+  *pResult = out;
+  *pIndex = 0U;
+  v = _mm256_set1_ps(out);
+  for (i = 0U; i + 8U <= blockSize; i += 8U)
+  {
+    bits = (uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(_mm256_loadu_ps(pSrc + i), absMask), v, _CMP_EQ_OQ));
+    if (bits)
+    {
+      *pIndex = i + (uint32_t) __builtin_ctz(bits);
+      return;
+    }
+  }
+  if (i + 4U <= blockSize)
+  {
+    bits = (uint32_t) _mm_movemask_ps(_mm_cmpeq_ps(_mm_and_ps(_mm_loadu_ps(pSrc + i), _mm256_castps256_ps128(absMask)),
+                                                   _mm256_castps256_ps128(v)));
+    if (bits)
+    {
+      *pIndex = i + (uint32_t) __builtin_ctz(bits);
+      return;
+    }
+    i += 4U;
+  }
+  for (; i < blockSize; i++)
+  {
+    if (fabsf(pSrc[i]) == out)
+    {
+      *pIndex = i;
+      return;
+    }
+  }
+}
+
+ARM_X86_TARGET_AVX512 void arm_absmax_f32_avx512(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  __m512 vMax = _mm512_setzero_ps(), v;
+  __mmask16 m, eq;
+  float32_t out;
+  uint32_t i;
+
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    vMax = _mm512_max_ps(vMax, _mm512_abs_ps(_mm512_loadu_ps(pSrc + i)));
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    vMax = _mm512_max_ps(vMax, _mm512_abs_ps(_mm512_maskz_loadu_ps(m, pSrc + i)));
+  }
+  out = _mm512_reduce_max_ps(vMax);
+
+  *pResult = out;
+  *pIndex = 0U;
+  v = _mm512_set1_ps(out);
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    eq = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_loadu_ps(pSrc + i)), v, _CMP_EQ_OQ);
+    if (eq)
+    {
+      *pIndex = i + (uint32_t) __builtin_ctz(eq);
+      return;
+    }
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    eq = _mm512_mask_cmp_ps_mask(m, _mm512_abs_ps(_mm512_maskz_loadu_ps(m, pSrc + i)), v, _CMP_EQ_OQ);
+    if (eq)
+    {
+      *pIndex = i + (uint32_t) __builtin_ctz(eq);
+    }
+  }
+}
+
+ARM_X86_DISPATCH(arm_absmax_f32)
+
 #else
 #if defined(ARM_MATH_LOOPUNROLL)
 ARM_DSP_ATTRIBUTE void arm_absmax_f32(
@@ -70,6 +70,45 @@ ARM_DSP_ATTRIBUTE void arm_rms_f32(
     /* Compute Rms and store the result in the destination */
     arm_sqrt_f32(pow / (float32_t) blockSize, pResult);
 }
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+ARM_X86_TARGET_SSE2 void arm_rms_f32_sse2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  float32_t sum;
+
+  arm_dot_prod_f32_sse2(pSrc, pSrc, blockSize, &sum);
+  arm_sqrt_f32(sum / (float32_t) blockSize, pResult);
+}
+
+ARM_X86_TARGET_AVX2 void arm_rms_f32_avx2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  float32_t sum;
+
+  arm_dot_prod_f32_avx2(pSrc, pSrc, blockSize, &sum);
+  arm_sqrt_f32(sum / (float32_t) blockSize, pResult);
+}
+
+ARM_X86_TARGET_AVX512 void arm_rms_f32_avx512(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  float32_t sum;
+
+  arm_dot_prod_f32_avx512(pSrc, pSrc, blockSize, &sum);
+  arm_sqrt_f32(sum / (float32_t) blockSize, pResult);
+}
+
+ARM_X86_DISPATCH(arm_rms_f32)
+
 #else
 #if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
 ARM_DSP_ATTRIBUTE void arm_rms_f32(
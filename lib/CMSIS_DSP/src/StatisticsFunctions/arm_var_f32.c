@@ -115,6 +115,177 @@ ARM_DSP_ATTRIBUTE void arm_var_f32(
     /* Variance */
     *pResult = sum / (float32_t) (blockSize - 1);
 }
+#elif defined(ARM_MATH_X86_DISPATCH) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_x86_dispatch.h"
+
+/* Two passes like the generic version: mean, then sum of squared deviations */
+ARM_X86_TARGET_SSE2 void arm_var_f32_sse2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps(), mean, d0, d1;
+  float32_t sum, fMean, fValue;
+  uint32_t i;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  for (i = 0U; i + 8U <= blockSize; i += 8U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_loadu_ps(pSrc + i));
+    acc1 = _mm_add_ps(acc1, _mm_loadu_ps(pSrc + i + 4U));
+  }
+  sum = arm_x86_hsum_sse2(_mm_add_ps(acc0, acc1));
+  for (; i < blockSize; i++)
+  {
+    sum += pSrc[i];
+  }
+  fMean = sum / (float32_t) blockSize;
+
+  mean = _mm_set1_ps(fMean);
+  acc0 = _mm_setzero_ps();
+  acc1 = _mm_setzero_ps();
+  for (i = 0U; i + 8U <= blockSize; i += 8U)
+  {
+    d0 = _mm_sub_ps(_mm_loadu_ps(pSrc + i), mean);
+    d1 = _mm_sub_ps(_mm_loadu_ps(pSrc + i + 4U), mean);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(d0, d0));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(d1, d1));
+  }
+  sum = arm_x86_hsum_sse2(_mm_add_ps(acc0, acc1));
+  for (; i < blockSize; i++)
+  {
+    fValue = pSrc[i] - fMean;
+    sum += fValue * fValue;
+  }
+
+  *pResult = sum / (float32_t)(blockSize - 1.0f);
+}
+
+ARM_X86_TARGET_AVX2 void arm_var_f32_avx2(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps(), mean, d0, d1;
+  __m128 acc, d;
+  float32_t sum, fMean, fValue;
+  uint32_t i;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(pSrc + i));
+    acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(pSrc + i + 8U));
+  }
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(pSrc + i));
+  }
+  acc0 = _mm256_add_ps(acc0, acc1);
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  if (i + 4U <= blockSize)
+  {
+    acc = _mm_add_ps(acc, _mm_loadu_ps(pSrc + i));
+    i += 4U;
+  }
+  sum = arm_x86_hsum_sse2(acc);
+  for (; i < blockSize; i++)
+  {
+    sum += pSrc[i];
+  }
+  fMean = sum / (float32_t) blockSize;
+
+  mean = _mm256_set1_ps(fMean);
+  acc0 = _mm256_setzero_ps();
+  acc1 = _mm256_setzero_ps();
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    d0 = _mm256_sub_ps(_mm256_loadu_ps(pSrc + i), mean);
+    d1 = _mm256_sub_ps(_mm256_loadu_ps(pSrc + i + 8U), mean);
+    acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+    acc1 = _mm256_fmadd_ps(d1, d1, acc1);
+  }
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    d0 = _mm256_sub_ps(_mm256_loadu_ps(pSrc + i), mean);
+    acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+  }
+  acc0 = _mm256_add_ps(acc0, acc1);
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  if (i + 4U <= blockSize)
+  {
+    d = _mm_sub_ps(_mm_loadu_ps(pSrc + i), _mm256_castps256_ps128(mean));
+    acc = _mm_fmadd_ps(d, d, acc);
+    i += 4U;
+  }
+  sum = arm_x86_hsum_sse2(acc);
+  for (; i < blockSize; i++)
+  {
+    fValue = pSrc[i] - fMean;
+    sum += fValue * fValue;
+  }
+
+  *pResult = sum / (float32_t)(blockSize - 1.0f);
+}
+
+ARM_X86_TARGET_AVX512 void arm_var_f32_avx512(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+  __m512 acc = _mm512_setzero_ps(), mean, d;
+  __mmask16 m;
+  float32_t fMean;
+  uint32_t i;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    acc = _mm512_add_ps(acc, _mm512_loadu_ps(pSrc + i));
+  }
+  if (i < blockSize)
+  {
+    i = arm_x86_tail16(i, blockSize, &m);
+    acc = _mm512_add_ps(acc, _mm512_maskz_loadu_ps(m, pSrc + i));
+  }
+  fMean = _mm512_reduce_add_ps(acc) / (float32_t) blockSize;
+
+  mean = _mm512_set1_ps(fMean);
+  acc = _mm512_setzero_ps();
+  for (i = 0U; i + 16U <= blockSize; i += 16U)
+  {
+    d = _mm512_sub_ps(_mm512_loadu_ps(pSrc + i), mean);
+    acc = _mm512_fmadd_ps(d, d, acc);
+  }
+  if (i < blockSize)
+  {
+    /* Masked-off lanes must stay zero: subtract the mean under the same mask */
+    i = arm_x86_tail16(i, blockSize, &m);
+    d = _mm512_maskz_sub_ps(m, _mm512_maskz_loadu_ps(m, pSrc + i), mean);
+    acc = _mm512_fmadd_ps(d, d, acc);
+  }
+
+  *pResult = _mm512_reduce_add_ps(acc) / (float32_t)(blockSize - 1.0f);
+}
+
+ARM_X86_DISPATCH(arm_var_f32)
+
 #else
 #if defined(ARM_MATH_NEON_EXPERIMENTAL) && !defined(ARM_MATH_AUTOVECTORIZE)
 ARM_DSP_ATTRIBUTE void arm_var_f32(
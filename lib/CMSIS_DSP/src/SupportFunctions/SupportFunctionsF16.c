@@ -0,0 +1,35 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        SupportFunctionsF16.c
+ * Description:  Combination of all support function f16 source files.
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_barycenter_f16.c"
+#include "arm_copy_f16.c"
+#include "arm_f16_to_f64.c"
+#include "arm_f16_to_float.c"
+#include "arm_f16_to_q15.c"
+#include "arm_f64_to_f16.c"
+#include "arm_fill_f16.c"
+#include "arm_float_to_f16.c"
+#include "arm_q15_to_f16.c"
+#include "arm_weighted_average_f16.c"
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bitonic_sort_f32.c
+ * Description:  Floating point bitonic sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+static void arm_bitonic_sort_core_f32(float32_t *pSrc, uint32_t n, uint8_t dir)
+{
+  uint32_t size, stride, i, j;
+  uint8_t up;
+  float32_t temp;
+
+  /* Iterative bitonic network: merge sequences of length size, comparing
+     elements stride apart; each block of size elements is sorted in the
+     direction that makes the enclosing block bitonic */
+  for (size = 2U; size <= n; size <<= 1U)
+  {
+    for (stride = size >> 1U; stride > 0U; stride >>= 1U)
+    {
+      for (i = 0U; i < n; i++)
+      {
+        j = i ^ stride;
+        if (j > i)
+        {
+          up = (uint8_t) (((i & size) == 0U) ? dir : !dir);
+          if (ARM_SORT_AFTER(up, pSrc[i], pSrc[j]))
+          {
+            temp = pSrc[i];
+            pSrc[i] = pSrc[j];
+            pSrc[j] = temp;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                The bitonic sort is an in-place comparison network that
+                recursively builds bitonic sequences (a sequence that first
+                increases then decreases) and merges them. Its comparisons do
+                not depend on the data.
+
+  @par          The block size must be a power of two.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_bitonic_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  arm_bitonic_sort_core_f32(pDst, blockSize, S->dir);
+}
+
+/**
+  @} end of Sorting group
+ */
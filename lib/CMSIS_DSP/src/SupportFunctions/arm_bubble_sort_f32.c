@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bubble_sort_f32.c
+ * Description:  Floating point bubble sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                 The bubble sort algorithm is a simple comparison algorithm that
+                 reads the elements of a vector from the beginning to the end,
+                 compares the adjacent ones and swaps them if they are in the
+                 wrong order. The procedure is repeated until there is nothing
+                 left to swap. Bubble sort is fast for input vectors that are
+                 nearly sorted.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_bubble_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint8_t dir = S->dir;
+  uint32_t i, last;
+  uint8_t swapped = 1U;
+  float32_t temp;
+
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  /* After each pass the last element is in place */
+  last = blockSize;
+  while ((swapped == 1U) && (last > 1U))
+  {
+    swapped = 0U;
+    for (i = 1U; i < last; i++)
+    {
+      if (ARM_SORT_AFTER(dir, pDst[i - 1U], pDst[i]))
+      {
+        temp = pDst[i];
+        pDst[i] = pDst[i - 1U];
+        pDst[i - 1U] = temp;
+        swapped = 1U;
+      }
+    }
+    last--;
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_q15.c
+ * Description:  Splits interleaved Q15 frames into scaled Q15 channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Deinterleave
+  @{
+ */
+
+/**
+  @brief         Splits interleaved Q15 frames into Q15 channels, with a per-channel scale and offset.
+  @param[in]     pSrc         points to the interleaved input frames, <code>numChannels</code> samples per frame
+  @param[in]     numChannels  number of channels per frame
+  @param[in]     pScaleFract  points to the fractional part of the scale of each channel (<code>numChannels</code> values)
+  @param[in]     shift        number of bits to shift the result by
+  @param[in]     pBias        points to the offset of each channel (<code>numChannels</code> values)
+  @param[out]    pDst         points to the first output channel
+  @param[in]     dstStride    distance, in samples, between the starts of two output channels
+  @param[in]     numFrames    number of frames to process
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[c * dstStride + n] = sat(sat((pSrc[n * numChannels + c] * pScaleFract[c]) >> (15 - shift)) + pBias[c]);
+                                0 <= c < numChannels, 0 <= n < numFrames
+  </pre>
+                   As in \ref arm_scale_q15, the scale of channel c is <code>pScaleFract[c] * 2^shift</code>:
+                   <code>pScaleFract[c] = 0x4000</code> with <code>shift = 1</code> leaves the samples unchanged.
+                   <code>dstStride</code> must be at least <code>numFrames</code>.
+
+  @par           Scaling and Overflow Behavior
+                   The product is saturated to 1.15 format, then the sum with the offset.
+
+  @par           Vectorization
+                   The AVX2 version processes 8 frames at a time, with one 32-bit gather
+                   per pair of channels.
+ */
+ARM_DSP_ATTRIBUTE void arm_deinterleave_q15(
+  const q15_t * pSrc,
+        uint16_t numChannels,
+  const q15_t * pScaleFract,
+        int8_t shift,
+  const q15_t * pBias,
+        q15_t * pDst,
+        uint32_t dstStride,
+        uint32_t numFrames)
+{
+  const q15_t *pIn = pSrc;                       /* Source pointer */
+        q15_t *pOut;                             /* Destination pointer */
+        uint32_t blkCnt;                         /* Loop counter */
+        uint32_t n = 0U;                         /* Index of the current frame */
+        uint16_t c;                              /* Channel index */
+        int8_t kShift = 15 - shift;              /* Shift to apply after scaling */
+
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+  if (numChannels >= 2U)
+  {
+    const __m256i qMin = _mm256_set1_epi32(-32768);
+    const __m256i qMax = _mm256_set1_epi32(32767);
+    const __m128i count = _mm_cvtsi32_si128(kShift);
+    __m256i idx, v, x[2];
+    uint16_t c0, l;
+
+    /* Offsets, in samples, of one channel in 8 consecutive frames */
+    idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int32_t) numChannels));
+
+    for (; n + 8U <= numFrames; n += 8U)
+    {
+      pIn = pSrc + n * numChannels;
+      for (c = 0U; c < numChannels; c += 2U)
+      {
+        /* With an odd count, the last channel is the high half of the pair
+           (c - 1, c): reading (c, c + 1) would run past the last frame */
+        c0 = (c + 1U < numChannels) ? c : (uint16_t) (c - 1U);
+        v = _mm256_i32gather_epi32((const int *) (pIn + c0), idx, 2);
+        x[0] = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+        x[1] = _mm256_srai_epi32(v, 16);
+
+        for (l = (c0 == c) ? 0U : 1U; l < 2U; l++)
+        {
+          /* sat((x * scale) >> kShift) + bias, saturated again by the pack */
+          v = _mm256_mullo_epi32(x[l], _mm256_set1_epi32(pScaleFract[c0 + l]));
+          v = _mm256_max_epi32(_mm256_min_epi32(_mm256_sra_epi32(v, count), qMax), qMin);
+          v = _mm256_add_epi32(v, _mm256_set1_epi32(pBias[c0 + l]));
+          v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0x08);
+          _mm_storeu_si128((__m128i *) (pDst + (c0 + l) * dstStride + n), _mm256_castsi256_si128(v));
+        }
+      }
+    }
+    pIn = pSrc + n * numChannels;
+  }
+
+#endif /* #if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+  /* Generic channel count, or frames left over by the vectorized loop */
+  for (c = 0U; c < numChannels; c++)
+  {
+    const q15_t *pCh = pIn + c;
+    q15_t scale = pScaleFract[c];
+    q15_t bias = pBias[c];
+
+    pOut = pDst + c * dstStride + n;
+    blkCnt = numFrames - n;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    while (blkCnt > 1U)
+    {
+      /* Scale, saturate and offset two samples of channel c */
+      *pOut++ = (q15_t) __SSAT((q31_t) __SSAT(((q31_t) pCh[0] * scale) >> kShift, 16) + bias, 16);
+      *pOut++ = (q15_t) __SSAT((q31_t) __SSAT(((q31_t) pCh[numChannels] * scale) >> kShift, 16) + bias, 16);
+      pCh += 2U * numChannels;
+
+      /* Decrement loop counter */
+      blkCnt -= 2U;
+    }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      /* Scale, saturate and offset one sample of channel c */
+      *pOut++ = (q15_t) __SSAT((q31_t) __SSAT(((q31_t) *pCh * scale) >> kShift, 16) + bias, 16);
+      pCh += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of Deinterleave group
+ */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_q15_to_float.c
+ * Description:  Splits interleaved Q15 frames into scaled floating-point channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Deinterleave Deinterleave and scale
+
+  Splits a block of interleaved frames (one sample of each channel per frame,
+  as delivered by a multi-axis sensor) into one contiguous vector per channel,
+  converting and applying a per-channel scale and offset in the same pass.
+  This replaces a conversion, a scale and an offset per sample and channel
+  by one pass over the block.
+ */
+
+/**
+  @addtogroup Deinterleave
+  @{
+ */
+
+/**
+  @brief         Splits interleaved Q15 frames into floating-point channels, with a per-channel scale and offset.
+  @param[in]     pSrc         points to the interleaved input frames, <code>numChannels</code> samples per frame
+  @param[in]     numChannels  number of channels per frame
+  @param[in]     pScale       points to the scale of each channel (<code>numChannels</code> values)
+  @param[in]     pBias        points to the offset of each channel (<code>numChannels</code> values)
+  @param[out]    pDst         points to the first output channel
+  @param[in]     dstStride    distance, in samples, between the starts of two output channels
+  @param[in]     numFrames    number of frames to process
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[c * dstStride + n] = (float32_t) pSrc[n * numChannels + c] * pScale[c] + pBias[c];
+                                0 <= c < numChannels, 0 <= n < numFrames
+  </pre>
+                   The input samples are raw counts: the scale includes the 1/32768
+                   of a Q15 to float conversion when one is wanted. <code>dstStride</code>
+                   must be at least <code>numFrames</code>.
+
+  @par           Vectorization
+                   The AVX2 version processes 8 frames at a time: one 32-bit gather
+                   fetches a pair of channels of 8 frames, which are sign-extended,
+                   converted and scaled with one FMA per channel.
+ */
+ARM_DSP_ATTRIBUTE void arm_deinterleave_q15_to_float(
+  const q15_t * pSrc,
+        uint16_t numChannels,
+  const float32_t * pScale,
+  const float32_t * pBias,
+        float32_t * pDst,
+        uint32_t dstStride,
+        uint32_t numFrames)
+{
+  const q15_t *pIn = pSrc;                       /* Source pointer */
+        float32_t *pOut;                         /* Destination pointer */
+        uint32_t blkCnt;                         /* Loop counter */
+        uint32_t n = 0U;                         /* Index of the current frame */
+        uint16_t c;                              /* Channel index */
+
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+  if (numChannels >= 2U)
+  {
+    __m256i idx, v;
+    __m256 lo, hi;
+    uint16_t c0;
+
+    /* Offsets, in samples, of one channel in 8 consecutive frames */
+    idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int32_t) numChannels));
+
+    for (; n + 8U <= numFrames; n += 8U)
+    {
+      pIn = pSrc + n * numChannels;
+      for (c = 0U; c < numChannels; c += 2U)
+      {
+        /* With an odd count, the last channel is the high half of the pair
+           (c - 1, c): reading (c, c + 1) would run past the last frame */
+        c0 = (c + 1U < numChannels) ? c : (uint16_t) (c - 1U);
+        v = _mm256_i32gather_epi32((const int *) (pIn + c0), idx, 2);
+        lo = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16));
+        hi = _mm256_cvtepi32_ps(_mm256_srai_epi32(v, 16));
+
+        if (c0 == c)
+        {
+          _mm256_storeu_ps(pDst + c * dstStride + n,
+                           _mm256_fmadd_ps(lo, _mm256_broadcast_ss(pScale + c), _mm256_broadcast_ss(pBias + c)));
+        }
+        _mm256_storeu_ps(pDst + (c0 + 1U) * dstStride + n,
+                         _mm256_fmadd_ps(hi, _mm256_broadcast_ss(pScale + c0 + 1U), _mm256_broadcast_ss(pBias + c0 + 1U)));
+      }
+    }
+    pIn = pSrc + n * numChannels;
+  }
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+
+  if (numChannels == 6U)
+  {
+    /* Six channels (3-axis accelerometer and gyroscope): the scales and
+       offsets stay in registers for the whole block */
+    float32_t s0 = pScale[0], s1 = pScale[1], s2 = pScale[2];
+    float32_t s3 = pScale[3], s4 = pScale[4], s5 = pScale[5];
+    float32_t b0 = pBias[0], b1 = pBias[1], b2 = pBias[2];
+    float32_t b3 = pBias[3], b4 = pBias[4], b5 = pBias[5];
+
+    pOut = pDst;
+    blkCnt = numFrames;
+
+    while (blkCnt > 0U)
+    {
+      /* Convert one frame and store each sample in its channel */
+      pOut[0U]             = (float32_t) pIn[0] * s0 + b0;
+      pOut[dstStride]      = (float32_t) pIn[1] * s1 + b1;
+      pOut[2U * dstStride] = (float32_t) pIn[2] * s2 + b2;
+      pOut[3U * dstStride] = (float32_t) pIn[3] * s3 + b3;
+      pOut[4U * dstStride] = (float32_t) pIn[4] * s4 + b4;
+      pOut[5U * dstStride] = (float32_t) pIn[5] * s5 + b5;
+      pIn += 6U;
+      pOut++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    n = numFrames;
+  }
+
+#endif /* #if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+  /* Generic channel count, or frames left over by the vectorized loop */
+  for (c = 0U; c < numChannels; c++)
+  {
+    const q15_t *pCh = pIn + c;
+    float32_t scale = pScale[c];
+    float32_t bias = pBias[c];
+
+    pOut = pDst + c * dstStride + n;
+    blkCnt = numFrames - n;
+
+    while (blkCnt > 0U)
+    {
+      /* Convert, scale and offset one sample of channel c */
+      *pOut++ = (float32_t) *pCh * scale + bias;
+      pCh += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of Deinterleave group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_f64_to_f16.c
+ * Description:  Converts the elements of the 64 bit floating-point vector to 16 bit floating-point vector
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup f64_to_x
+  @{
+ */
+
+/**
+  @brief         Converts the elements of the 64 bit floating-point vector to 16 bit floating-point vector.
+  @param[in]     pSrc       points to the 64 bit floating-point input vector
+  @param[out]    pDst       points to the 16 bit floating-point output vector
+  @param[in]     blockSize  number of samples in each vector
+ */
+ARM_DSP_ATTRIBUTE void arm_f64_to_f16(
+  const float64_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+  const float64_t *pIn = pSrc;                   /* Source pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Convert from f64 to f16 and store result in destination buffer */
+    *pDst++ = (float16_t) *pIn++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of f64_to_x group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_f64_to_q7.c
+ * Description:  Converts the elements of the 64 bit floating-point vector to Q7 vector
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup f64_to_x
+  @{
+ */
+
+/**
+  @brief         Converts the elements of the 64 bit floating-point vector to Q7 vector.
+  @param[in]     pSrc       points to the 64 bit floating-point input vector
+  @param[out]    pDst       points to the Q7 output vector
+  @param[in]     blockSize  number of samples in each vector
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (q7_t)(pSrc[n] * 128);   0 <= n < blockSize.
+  </pre>
+
+  @par           Scaling and Overflow Behavior
+                   The function uses saturating arithmetic.
+                   Results outside of the allowable Q7 range are saturated.
+
+  @note
+                   In order to apply rounding, the library should be rebuilt with the ROUNDING macro
+                   defined in the preprocessor section of project options.
+ */
+ARM_DSP_ATTRIBUTE void arm_f64_to_q7(
+  const float64_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize)
+{
+  const float64_t *pIn = pSrc;                   /* Source pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+#ifdef ARM_MATH_ROUNDING
+  float64_t in;                                  /* Scaled input before rounding */
+#endif
+
+#ifdef ARM_MATH_ROUNDING
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Convert from f64 to q7 and store result in destination buffer */
+    in = (*pIn++ * 128.0);
+    in += in > 0.0 ? 0.5 : -0.5;
+    *pDst++ = (q7_t) (__SSAT((q31_t) (in), 8));
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+#else /* #ifdef ARM_MATH_ROUNDING */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Convert from f64 to q7 and store result in destination buffer */
+    *pDst++ = (q7_t) __SSAT((q31_t) (*pIn++ * 128.0), 8);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifdef ARM_MATH_ROUNDING */
+}
+
+/**
+  @} end of f64_to_x group
+ */
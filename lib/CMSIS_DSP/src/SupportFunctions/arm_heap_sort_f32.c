@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_heap_sort_f32.c
+ * Description:  Floating point heap sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+static void arm_heapify(float32_t * pSrc, uint32_t n, uint32_t i, uint8_t dir)
+{
+  /* Sift pSrc[i] down the heap of n elements */
+  uint32_t k, child;
+  float32_t temp;
+
+  k = i;
+  for (;;)
+  {
+    child = 2U * k + 1U;
+    if (child >= n)
+    {
+      break;
+    }
+    if ((child + 1U < n) && ARM_SORT_AFTER(dir, pSrc[child + 1U], pSrc[child]))
+    {
+      child++;
+    }
+    if (!ARM_SORT_AFTER(dir, pSrc[child], pSrc[k]))
+    {
+      break;
+    }
+    temp = pSrc[k];
+    pSrc[k] = pSrc[child];
+    pSrc[child] = temp;
+    k = child;
+  }
+}
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                 The heap sort algorithm is a comparison algorithm that
+                 divides the input array into a sorted and an unsorted region,
+                 and shrinks the unsorted region by extracting the largest
+                 element and moving it to the sorted region. A heap data
+                 structure is used to find the maximum.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_heap_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint8_t dir = S->dir;
+  uint32_t i;
+  float32_t temp;
+
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  if (blockSize < 2U)
+  {
+    return;
+  }
+
+  /* Build the heap: the root must come last in the sorted vector */
+  for (i = blockSize / 2U; i > 0U; i--)
+  {
+    arm_heapify(pDst, blockSize, i - 1U, dir);
+  }
+
+  /* Move the root to the end of the unsorted region */
+  for (i = blockSize - 1U; i > 0U; i--)
+  {
+    temp = pDst[0];
+    pDst[0] = pDst[i];
+    pDst[i] = temp;
+
+    arm_heapify(pDst, i, 0U, dir);
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
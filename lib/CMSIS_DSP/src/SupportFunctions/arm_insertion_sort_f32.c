@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_insertion_sort_f32.c
+ * Description:  Floating point insertion sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                 The insertion sort is a simple sorting algorithm that
+                 reads all the element of the input array and removes one element
+                 at a time, finds the location it belongs in the final sorted list,
+                 and inserts it there.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_insertion_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint8_t dir = S->dir;
+  uint32_t i, j;
+  float32_t temp;
+
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  for (i = 1U; i < blockSize; i++)
+  {
+    temp = pDst[i];
+    j = i;
+    while ((j > 0U) && ARM_SORT_AFTER(dir, pDst[j - 1U], temp))
+    {
+      pDst[j] = pDst[j - 1U];
+      j--;
+    }
+    pDst[j] = temp;
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
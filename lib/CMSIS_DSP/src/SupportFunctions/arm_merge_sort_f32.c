@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_merge_sort_f32.c
+ * Description:  Floating point merge sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                  The merge sort algorithm is a comparison algorithm that
+                  divides the input array in sublists and merges them to produce
+                  longer sorted sublists until there is only one list remaining.
+
+  @par           A work array is always needed. It must be allocated by the user
+                  linked to the instance at initialization time.
+
+  @par           It's an out-of-place algorithm: pSrc is left untouched. The merge
+                  is stable (equal elements keep their order).
+ */
+ARM_DSP_ATTRIBUTE void arm_merge_sort_f32(
+  const arm_merge_sort_instance_f32 * S,
+        float32_t *pSrc,
+        float32_t *pDst,
+        uint32_t blockSize)
+{
+  uint8_t dir = S->dir;
+  float32_t *pA, *pB, *pT;
+  uint32_t width, lo, mid, hi, i, j, k;
+
+  /* Bottom-up: merge runs of width elements from pA into pB, then swap */
+  pA = pDst;
+  pB = S->buffer;
+  if (pSrc != pDst)
+  {
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  for (width = 1U; width < blockSize; width <<= 1U)
+  {
+    for (lo = 0U; lo < blockSize; lo += 2U * width)
+    {
+      mid = (lo + width < blockSize) ? lo + width : blockSize;
+      hi = (mid + width < blockSize) ? mid + width : blockSize;
+
+      i = lo;
+      j = mid;
+      for (k = lo; k < hi; k++)
+      {
+        /* Take from the right run only when it must come strictly first */
+        if ((j < hi) && ((i >= mid) || ARM_SORT_AFTER(dir, pA[i], pA[j])))
+        {
+          pB[k] = pA[j++];
+        }
+        else
+        {
+          pB[k] = pA[i++];
+        }
+      }
+    }
+
+    pT = pA;
+    pA = pB;
+    pB = pT;
+  }
+
+  if (pA != pDst)
+  {
+    arm_copy_f32(pA, pDst, blockSize);
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
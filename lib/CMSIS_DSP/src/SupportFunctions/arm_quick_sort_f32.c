@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quick_sort_f32.c
+ * Description:  Floating point quick sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+static uint32_t arm_quick_sort_partition_f32(float32_t *pSrc, uint32_t first, uint32_t last, uint8_t dir)
+{
+  /* Hoare partition around the middle element: on return, no element of
+     pSrc[first..p] must come after an element of pSrc[p+1..last] */
+  float32_t pivot = pSrc[first + ((last - first) >> 1U)];
+  float32_t temp;
+  uint32_t i = first;
+  uint32_t j = last;
+
+  for (;;)
+  {
+    while (ARM_SORT_AFTER(dir, pivot, pSrc[i]))
+    {
+      i++;
+    }
+    while (ARM_SORT_AFTER(dir, pSrc[j], pivot))
+    {
+      j--;
+    }
+    if (i >= j)
+    {
+      return j;
+    }
+
+    temp = pSrc[i];
+    pSrc[i] = pSrc[j];
+    pSrc[j] = temp;
+    i++;
+    j--;
+  }
+}
+
+static void arm_quick_sort_core_f32(float32_t *pSrc, uint32_t first, uint32_t last, uint8_t dir)
+{
+  uint32_t p;
+
+  /* Recurse on the smaller part and loop on the larger one: the stack depth
+     stays below log2(blockSize) */
+  while (first < last)
+  {
+    p = arm_quick_sort_partition_f32(pSrc, first, last, dir);
+    if (p - first < last - p)
+    {
+      arm_quick_sort_core_f32(pSrc, first, p, dir);
+      first = p + 1U;
+    }
+    else
+    {
+      arm_quick_sort_core_f32(pSrc, p + 1U, last, dir);
+      last = p;
+    }
+  }
+}
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                The quick sort algorithm is a comparison algorithm that
+                divides the input array into two smaller sub-arrays and
+                recursively sort them. An element of the array (the pivot)
+                is chosen, all the elements with values smaller than the
+                pivot are moved before the pivot, while all elements with
+                values greater than the pivot are moved after it (partition).
+
+  @par
+                In this implementation the Hoare partition scheme has been
+                used, with the middle element as pivot. The pivot is not
+                necessarily at its final place after partitioning.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_quick_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  if (blockSize > 1U)
+  {
+    arm_quick_sort_core_f32(pDst, 0U, blockSize - 1U, S->dir);
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_selection_sort_f32.c
+ * Description:  Floating point selection sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+  @private
+  @param[in]     S          points to an instance of the sorting structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Algorithm
+                 The Selection sort algorithm is a comparison algorithm that
+                 divides the input array into a sorted and an unsorted sublist
+                 (initially the sorted sublist is empty and the unsorted sublist
+                 is the input array), looks for the smallest (or biggest)
+                 element in the unsorted sublist, swapping it with the leftmost
+                 one, and moving the sublists boundary one element to the right.
+
+  @par           It's an in-place algorithm. In order to obtain an out-of-place
+                 function, a memcpy of the source vector is performed.
+ */
+ARM_DSP_ATTRIBUTE void arm_selection_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint8_t dir = S->dir;
+  uint32_t i, j, k;
+  float32_t temp;
+
+  if (pSrc != pDst)
+  {
+    /* Out-of-place: sort a copy, the input is left untouched */
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  for (i = 0U; i + 1U < blockSize; i++)
+  {
+    /* Index of the element that must come first in pDst[i..] */
+    k = i;
+    for (j = i + 1U; j < blockSize; j++)
+    {
+      if (ARM_SORT_AFTER(dir, pDst[k], pDst[j]))
+      {
+        k = j;
+      }
+    }
+
+    if (k != i)
+    {
+      temp = pDst[i];
+      pDst[i] = pDst[k];
+      pDst[k] = temp;
+    }
+  }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -19,6 +19,8 @@ endif()
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix2_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix4_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix8_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_mixed_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_mixed_init_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_init_f32.c)
 
@@ -68,6 +70,11 @@ target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix4_q15.c)
 
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_multi_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_pruned_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_pruned_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_mixed_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_mixed_init_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_init_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix8_f32.c)
@@ -43,10 +43,17 @@
 #include "arm_cfft_radix4_q15.c"
 #include "arm_cfft_radix4_q31.c"
 #include "arm_cfft_radix8_f32.c"
+#include "arm_cfft_mixed_f32.c"
+#include "arm_cfft_mixed_init_f32.c"
 #include "arm_rfft_fast_f32.c"
 #include "arm_rfft_fast_f64.c"
 #include "arm_rfft_fast_init_f32.c"
+#include "arm_rfft_fast_multi_f32.c"
 #include "arm_rfft_fast_init_f64.c"
+#include "arm_rfft_pruned_f32.c"
+#include "arm_rfft_pruned_init_f32.c"
+#include "arm_rfft_mixed_f32.c"
+#include "arm_rfft_mixed_init_f32.c"
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
@@ -86,6 +86,22 @@ ARM_DSP_ATTRIBUTE void arm_bitreversal_32(
   const uint16_t bitRevLen,
   const uint16_t *pBitRevTab)
 {
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+  uint32_t a, b, i;
+  __m128i xa, xb;
+
+  /* Each swap moves a whole complex value (64 bits) instead of two 32-bit words */
+  for (i = 0; i < bitRevLen; i += 2)
+  {
+     a = pBitRevTab[i    ] >> 2;
+     b = pBitRevTab[i + 1] >> 2;
+
+     xa = _mm_loadl_epi64((const __m128i *) (pSrc + a));
+     xb = _mm_loadl_epi64((const __m128i *) (pSrc + b));
+     _mm_storel_epi64((__m128i *) (pSrc + a), xb);
+     _mm_storel_epi64((__m128i *) (pSrc + b), xa);
+  }
+#else
   uint32_t a, b, i, tmp;
 
   for (i = 0; i < bitRevLen; )
@@ -105,6 +121,7 @@ ARM_DSP_ATTRIBUTE void arm_bitreversal_32(
 
     i += 2;
   }
+#endif
 }
 
 void arm_bitreversal_16(
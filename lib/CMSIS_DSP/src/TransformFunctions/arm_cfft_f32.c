@@ -664,6 +664,10 @@ extern void arm_bitreversal_32(
   const uint16_t bitRevLen,
   const uint16_t * pBitRevTable);
 
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_avx2_utils.h"
+#endif
+
 /**
   @ingroup groupTransforms
  */
@@ -843,6 +847,101 @@ extern void arm_bitreversal_32(
        They are described on the page \ref transformbuffers "transform buffers".
  */
 
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/* The quarters hold fftLen/4 >= 4 complex values, i.e. whole vectors */
+static void arm_cfft_radix8by2_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
+{
+  uint32_t    L  = S->fftLen;
+  float32_t * p2 = p1 + L;
+  float32_t * pMid1 = p1 + (L >> 1);
+  float32_t * pMid2 = p2 + (L >> 1);
+  const float32_t * tw = S->pTwiddle;
+  __m256 t1, t2, t3, t4, w;
+  uint32_t l;
+
+  for (l = 0; l < (L >> 1); l += 8)
+  {
+    t1 = _mm256_loadu_ps(p1 + l);
+    t2 = _mm256_loadu_ps(p2 + l);
+    t3 = _mm256_loadu_ps(pMid1 + l);
+    t4 = _mm256_loadu_ps(pMid2 + l);
+    w  = _mm256_loadu_ps(tw + l);
+
+    _mm256_storeu_ps(p1 + l, _mm256_add_ps(t1, t2));
+    _mm256_storeu_ps(pMid1 + l, _mm256_add_ps(t3, t4));
+
+    /* (t1 - t2) * conj(tw) */
+    _mm256_storeu_ps(p2 + l, arm_avx2_cmul_conj_f32(_mm256_sub_ps(t1, t2), w));
+    /* vertical symmetry: (t4 - t3) * (twI + i twR) */
+    _mm256_storeu_ps(pMid2 + l, arm_avx2_cmul_f32(_mm256_sub_ps(t4, t3), arm_avx2_swap_cplx_f32(w)));
+  }
+
+  /* first col */
+  arm_radix8_butterfly_f32 (p1, L >> 1, (float32_t *) S->pTwiddle, 2U);
+
+  /* second col */
+  arm_radix8_butterfly_f32 (p2, L >> 1, (float32_t *) S->pTwiddle, 2U);
+}
+
+/*
+  The scalar version computes the lower half of each quarter from the upper one
+  through the twiddle symmetry. Here the twiddles are read directly (indices n,
+  2n and 3n of the fftLen table), so every quarter is a plain vector loop.
+*/
+static void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
+{
+  uint32_t    L  = S->fftLen >> 1;
+  float32_t * p2 = p1 + L;
+  float32_t * p3 = p2 + L;
+  float32_t * p4 = p3 + L;
+  const float32_t * tw = S->pTwiddle;
+  __m256 a, b, c, d, acp, acm, bdp, bdm;
+  __m128i n;
+  uint32_t l;
+
+  for (l = 0; l < L; l += 8)
+  {
+    a = _mm256_loadu_ps(p1 + l);
+    b = _mm256_loadu_ps(p2 + l);
+    c = _mm256_loadu_ps(p3 + l);
+    d = _mm256_loadu_ps(p4 + l);
+
+    acp = _mm256_add_ps(a, c);
+    acm = _mm256_sub_ps(a, c);
+    bdp = _mm256_add_ps(b, d);
+    bdm = arm_avx2_mul_negj_f32(_mm256_sub_ps(b, d));
+
+    n = _mm_add_epi32(_mm_set1_epi32((int32_t) (l >> 1)), _mm_setr_epi32(0, 1, 2, 3));
+
+    /* col 1 */
+    _mm256_storeu_ps(p1 + l, _mm256_add_ps(acp, bdp));
+    /* col 2 */
+    _mm256_storeu_ps(p2 + l, arm_avx2_cmul_conj_f32(_mm256_add_ps(acm, bdm),
+                                                    _mm256_loadu_ps(tw + l)));
+    /* col 3 */
+    _mm256_storeu_ps(p3 + l, arm_avx2_cmul_conj_f32(_mm256_sub_ps(acp, bdp),
+                                                    arm_avx2_gather_cplx_f32(tw, _mm_add_epi32(n, n))));
+    /* col 4 */
+    _mm256_storeu_ps(p4 + l, arm_avx2_cmul_conj_f32(_mm256_sub_ps(acm, bdm),
+                                                    arm_avx2_gather_cplx_f32(tw, _mm_mullo_epi32(n, _mm_set1_epi32(3)))));
+  }
+
+  /* first col */
+  arm_radix8_butterfly_f32 (p1, L >> 1, (float32_t *) S->pTwiddle, 4U);
+
+  /* second col */
+  arm_radix8_butterfly_f32 (p2, L >> 1, (float32_t *) S->pTwiddle, 4U);
+
+  /* third col */
+  arm_radix8_butterfly_f32 (p3, L >> 1, (float32_t *) S->pTwiddle, 4U);
+
+  /* fourth col */
+  arm_radix8_butterfly_f32 (p4, L >> 1, (float32_t *) S->pTwiddle, 4U);
+}
+
+#else
+
 static void arm_cfft_radix8by2_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
 {
   uint32_t    L  = S->fftLen;
@@ -1200,6 +1299,8 @@ static void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
     arm_radix8_butterfly_f32 (pCol4, L, (float32_t *) S->pTwiddle, 4U);
 }
 
+#endif /* defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
 /**
   @addtogroup ComplexFFTF32
   @{
@@ -1247,17 +1348,27 @@ ARM_DSP_ATTRIBUTE void arm_cfft_f32(
         uint8_t bitReverseFlag)
 {
   uint32_t  L = S->fftLen, l;
-  float32_t invL, * pSrc;
+  float32_t invL;
+#if !(defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE))
+  float32_t * pSrc;
+#endif
 
   if (ifftFlag == 1U)
   {
     /* Conjugate input data */
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+    for (l = 0; l < 2 * L; l += 8)
+    {
+      _mm256_storeu_ps(p1 + l, arm_avx2_conj_f32(_mm256_loadu_ps(p1 + l)));
+    }
+#else
     pSrc = p1 + 1;
     for (l = 0; l < L; l++)
     {
       *pSrc = -*pSrc;
       pSrc += 2;
     }
+#endif
   }
 
   switch (L)
@@ -1287,6 +1398,13 @@ ARM_DSP_ATTRIBUTE void arm_cfft_f32(
     invL = 1.0f / (float32_t)L;
 
     /* Conjugate and scale output data */
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+    const __m256 vScale = _mm256_setr_ps(invL, -invL, invL, -invL, invL, -invL, invL, -invL);
+    for (l = 0; l < 2 * L; l += 8)
+    {
+      _mm256_storeu_ps(p1 + l, _mm256_mul_ps(_mm256_loadu_ps(p1 + l), vScale));
+    }
+#else
     pSrc = p1;
     for (l= 0; l < L; l++)
     {
@@ -1294,6 +1412,7 @@ ARM_DSP_ATTRIBUTE void arm_cfft_f32(
       *pSrc    = -(*pSrc) * invL;
       pSrc++;
     }
+#endif
   }
 }
 #endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
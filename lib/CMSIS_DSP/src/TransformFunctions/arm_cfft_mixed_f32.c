@@ -0,0 +1,338 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Arbitrary-length floating-point complex FFT (mixed radix and Bluestein)
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/* sin(2*pi/3), cos/sin(2*pi/5), cos/sin(4*pi/5) */
+#define C3_S   0.866025403784438647f
+#define C5_C1  0.309016994374947424f
+#define C5_C2 -0.809016994374947424f
+#define C5_S1  0.951056516295153572f
+#define C5_S2  0.587785252292473129f
+
+/*
+  One Stockham decimation-in-frequency stage of radix p.
+  n is the length of the sub-transforms at this stage and s = N / n their
+  stride. For q < n/p and k < s:
+      a_r = x[k + s*(q + r*m)],  r = 0..p-1,  m = n/p
+      y[k + s*(p*q + t)] = W_n^(t*q) * sum_r a_r * W_p^(r*t)
+  and W_n^(t*q) = W_N^(t*q*s), so all twiddles come from the single N-point table.
+  The sign of the imaginary parts is flipped for the inverse transform (dir = -1).
+ */
+static void arm_cfft_mixed_stage_f32(
+  const float32_t * x,
+        float32_t * y,
+        uint32_t fftLen,
+        uint32_t n,
+        uint32_t s,
+        uint32_t p,
+  const float32_t * pTw,
+        float32_t dir)
+{
+  const uint32_t m = n / p;
+  const uint32_t pstride = fftLen / p;
+  float32_t wr[ARM_CFFT_MIXED_MAX_RADIX], wi[ARM_CFFT_MIXED_MAX_RADIX];
+  float32_t ar[ARM_CFFT_MIXED_MAX_RADIX], ai[ARM_CFFT_MIXED_MAX_RADIX];
+  float32_t br[ARM_CFFT_MIXED_MAX_RADIX], bi[ARM_CFFT_MIXED_MAX_RADIX];
+  float32_t cs[ARM_CFFT_MIXED_MAX_RADIX], sn[ARM_CFFT_MIXED_MAX_RADIX];
+  uint32_t q, k, r, t, idx;
+
+  /* cos and sin of 2*pi*j/p for the generic radix, W_p^j = W_N^(j*N/p) */
+  if (p > 5U)
+  {
+    for (t = 0U; t < p; t++)
+    {
+      cs[t] =  pTw[2U * t * pstride];
+      sn[t] = -pTw[2U * t * pstride + 1U];
+    }
+  }
+
+  for (q = 0U; q < m; q++)
+  {
+    /* Output twiddles of this column, shared by all k */
+    for (t = 0U; t < p; t++)
+    {
+      idx = t * q * s;
+      wr[t] = pTw[2U * idx];
+      wi[t] = dir * pTw[2U * idx + 1U];
+    }
+
+    for (k = 0U; k < s; k++)
+    {
+      const float32_t * pIn = x + 2U * (k + s * q);
+            float32_t * pOut = y + 2U * (k + s * p * q);
+
+      for (r = 0U; r < p; r++)
+      {
+        ar[r] = pIn[2U * s * m * r];
+        ai[r] = pIn[2U * s * m * r + 1U];
+      }
+
+      switch (p)
+      {
+      case 2U:
+        br[0] = ar[0] + ar[1];  bi[0] = ai[0] + ai[1];
+        br[1] = ar[0] - ar[1];  bi[1] = ai[0] - ai[1];
+        break;
+
+      case 3U:
+      {
+        float32_t t1r = ar[1] + ar[2], t1i = ai[1] + ai[2];
+        float32_t t2r = ar[0] - 0.5f * t1r, t2i = ai[0] - 0.5f * t1i;
+        /* t3 = -i * dir * sin(2*pi/3) * (a1 - a2) */
+        float32_t t3r =  dir * C3_S * (ai[1] - ai[2]);
+        float32_t t3i = -dir * C3_S * (ar[1] - ar[2]);
+        br[0] = ar[0] + t1r;  bi[0] = ai[0] + t1i;
+        br[1] = t2r + t3r;    bi[1] = t2i + t3i;
+        br[2] = t2r - t3r;    bi[2] = t2i - t3i;
+        break;
+      }
+
+      case 4U:
+      {
+        float32_t s0r = ar[0] + ar[2], s0i = ai[0] + ai[2];
+        float32_t d0r = ar[0] - ar[2], d0i = ai[0] - ai[2];
+        float32_t s1r = ar[1] + ar[3], s1i = ai[1] + ai[3];
+        /* -i * dir * (a1 - a3) */
+        float32_t d1r =  dir * (ai[1] - ai[3]);
+        float32_t d1i = -dir * (ar[1] - ar[3]);
+        br[0] = s0r + s1r;  bi[0] = s0i + s1i;
+        br[1] = d0r + d1r;  bi[1] = d0i + d1i;
+        br[2] = s0r - s1r;  bi[2] = s0i - s1i;
+        br[3] = d0r - d1r;  bi[3] = d0i - d1i;
+        break;
+      }
+
+      case 5U:
+      {
+        float32_t t1r = ar[1] + ar[4], t1i = ai[1] + ai[4];
+        float32_t t2r = ar[2] + ar[3], t2i = ai[2] + ai[3];
+        float32_t t3r = ar[1] - ar[4], t3i = ai[1] - ai[4];
+        float32_t t4r = ar[2] - ar[3], t4i = ai[2] - ai[3];
+        float32_t m1r = ar[0] + C5_C1 * t1r + C5_C2 * t2r;
+        float32_t m1i = ai[0] + C5_C1 * t1i + C5_C2 * t2i;
+        float32_t m2r = ar[0] + C5_C2 * t1r + C5_C1 * t2r;
+        float32_t m2i = ai[0] + C5_C2 * t1i + C5_C1 * t2i;
+        /* n1 = -i*dir*(s1*t3 + s2*t4), n2 = -i*dir*(s2*t3 - s1*t4) */
+        float32_t n1r =  dir * (C5_S1 * t3i + C5_S2 * t4i);
+        float32_t n1i = -dir * (C5_S1 * t3r + C5_S2 * t4r);
+        float32_t n2r =  dir * (C5_S2 * t3i - C5_S1 * t4i);
+        float32_t n2i = -dir * (C5_S2 * t3r - C5_S1 * t4r);
+        br[0] = ar[0] + t1r + t2r;  bi[0] = ai[0] + t1i + t2i;
+        br[1] = m1r + n1r;          bi[1] = m1i + n1i;
+        br[4] = m1r - n1r;          bi[4] = m1i - n1i;
+        br[2] = m2r + n2r;          bi[2] = m2i + n2i;
+        br[3] = m2r - n2r;          bi[3] = m2i - n2i;
+        break;
+      }
+
+      default:
+      {
+        /* Generic odd radix: outputs t and p-t share the sums
+             A_t = a_0 + sum_r (a_r + a_p-r) cos(2*pi*r*t/p)
+             B_t =       sum_r (a_r - a_p-r) sin(2*pi*r*t/p)
+           b_t = A_t - i*dir*B_t,  b_p-t = A_t + i*dir*B_t */
+        const uint32_t h = (p - 1U) / 2U;
+        float32_t sr[ARM_CFFT_MIXED_MAX_RADIX / 2], si[ARM_CFFT_MIXED_MAX_RADIX / 2];
+        float32_t dr[ARM_CFFT_MIXED_MAX_RADIX / 2], di[ARM_CFFT_MIXED_MAX_RADIX / 2];
+
+        br[0] = ar[0];
+        bi[0] = ai[0];
+        for (r = 1U; r <= h; r++)
+        {
+          sr[r - 1U] = ar[r] + ar[p - r];  si[r - 1U] = ai[r] + ai[p - r];
+          dr[r - 1U] = ar[r] - ar[p - r];  di[r - 1U] = ai[r] - ai[p - r];
+          br[0] += sr[r - 1U];
+          bi[0] += si[r - 1U];
+        }
+        for (t = 1U; t <= h; t++)
+        {
+          float32_t Ar = ar[0], Ai = ai[0], Br = 0.0f, Bi = 0.0f;
+          uint32_t j = 0U;
+          for (r = 1U; r <= h; r++)
+          {
+            j += t;
+            if (j >= p)
+            {
+              j -= p;
+            }
+            Ar += sr[r - 1U] * cs[j];  Ai += si[r - 1U] * cs[j];
+            Br += dr[r - 1U] * sn[j];  Bi += di[r - 1U] * sn[j];
+          }
+          /* -i*dir*B = dir * (B_i, -B_r) */
+          br[t]     = Ar + dir * Bi;  bi[t]     = Ai - dir * Br;
+          br[p - t] = Ar - dir * Bi;  bi[p - t] = Ai + dir * Br;
+        }
+        break;
+      }
+      }
+
+      pOut[0] = br[0];
+      pOut[1] = bi[0];
+      for (t = 1U; t < p; t++)
+      {
+        pOut[2U * s * t]      = br[t] * wr[t] - bi[t] * wi[t];
+        pOut[2U * s * t + 1U] = br[t] * wi[t] + bi[t] * wr[t];
+      }
+    }
+  }
+}
+
+/* Bluestein's algorithm: X_k = c_k * sum_n (x_n c_n) conj(c_(k-n)), the
+   convolution being evaluated with power-of-two FFTs of length blueLen.
+   The inverse uses ifft(x) = conj(fft(conj(x))) / N. */
+static void arm_cfft_mixed_bluestein_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint8_t ifftFlag)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t blueLen = S->blueLen;
+  const float32_t * pChirp = S->pChirp;
+  const float32_t sign = ifftFlag ? -1.0f : 1.0f;
+  const float32_t scale = ifftFlag ? 1.0f / (float32_t)fftLen : 1.0f;
+  uint32_t k;
+  float32_t xr, xi, cr, ci;
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    xr = pSrc[2U * k];
+    xi = sign * pSrc[2U * k + 1U];
+    cr = pChirp[2U * k];
+    ci = pChirp[2U * k + 1U];
+    pScratch[2U * k]      = xr * cr - xi * ci;
+    pScratch[2U * k + 1U] = xr * ci + xi * cr;
+  }
+  for (k = 2U * fftLen; k < 2U * blueLen; k++)
+  {
+    pScratch[k] = 0.0f;
+  }
+
+  arm_cfft_f32(&S->blueCfft, pScratch, 0U, 1U);
+  arm_cmplx_mult_cmplx_f32(pScratch, S->pChirpFft, pScratch, blueLen);
+  arm_cfft_f32(&S->blueCfft, pScratch, 1U, 1U);
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    xr = pScratch[2U * k];
+    xi = pScratch[2U * k + 1U];
+    cr = pChirp[2U * k];
+    ci = pChirp[2U * k + 1U];
+    pDst[2U * k]      = scale * (xr * cr - xi * ci);
+    pDst[2U * k + 1U] = scale * sign * (xr * ci + xi * cr);
+  }
+}
+
+/**
+  @ingroup ComplexFFT
+ */
+
+/**
+  @addtogroup ComplexFFTF32
+  @{
+ */
+
+/**
+  @brief         Processing function for the arbitrary-length floating-point complex FFT.
+  @param[in]     S         points to an instance initialized by \ref arm_cfft_mixed_init_f32
+  @param[in]     pSrc      points to the complex input (interleaved, fftLen values), not modified
+  @param[out]    pDst      points to the complex output (interleaved, fftLen values)
+  @param[in]     pScratch  points to a scratch buffer of
+                           \ref arm_cfft_mixed_scratch_len_f32(fftLen) values
+  @param[in]     ifftFlag
+                   - value = 0: forward transform
+                   - value = 1: inverse transform (scaled by 1/fftLen, as \ref arm_cfft_f32)
+
+  @par           Buffers
+                   pSrc, pDst and pScratch must not overlap. The output is in natural order;
+                   there is no separate bit-reversal step.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint8_t ifftFlag)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t numStages = S->numStages;
+  const float32_t dir = ifftFlag ? -1.0f : 1.0f;
+  const float32_t * pIn = pSrc;
+        float32_t * pOut;
+        float32_t * pOther;
+        float32_t * pTmp;
+        uint32_t stage, n, s, k;
+
+  if (numStages == 0U)
+  {
+    arm_cfft_mixed_bluestein_f32(S, pSrc, pDst, pScratch, ifftFlag);
+    return;
+  }
+
+  /* Ping-pong between pDst and pScratch so that the last stage lands in pDst */
+  if (numStages & 1U)
+  {
+    pOut = pDst;
+    pOther = pScratch;
+  }
+  else
+  {
+    pOut = pScratch;
+    pOther = pDst;
+  }
+
+  n = fftLen;
+  s = 1U;
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    arm_cfft_mixed_stage_f32(pIn, pOut, fftLen, n, s, S->factors[stage], S->pTwiddle, dir);
+    n /= S->factors[stage];
+    s *= S->factors[stage];
+    pIn = pOut;
+    pTmp = pOut;
+    pOut = pOther;
+    pOther = pTmp;
+  }
+
+  if (ifftFlag)
+  {
+    const float32_t scale = 1.0f / (float32_t)fftLen;
+    for (k = 0U; k < 2U * fftLen; k++)
+    {
+      pDst[k] *= scale;
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
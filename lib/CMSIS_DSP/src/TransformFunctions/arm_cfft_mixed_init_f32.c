@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization of the arbitrary-length floating-point complex FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+#include <math.h>
+
+/* The plan is computed in double precision; PI from arm_math_types.h is a float */
+#define ARM_CFFT_MIXED_PI 3.14159265358979323846
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup ComplexFFT
+ */
+
+/**
+  @addtogroup ComplexFFTF32
+  @{
+ */
+
+/* Split fftLen into radix stages (4 first, then 2, 3, 5 and odd primes up to
+   ARM_CFFT_MIXED_MAX_RADIX). Returns the number of stages, or 0 when n < 2,
+   when a prime factor is too large or when there are more than
+   ARM_CFFT_MIXED_MAX_FACTORS stages; Bluestein's algorithm is used instead. */
+static uint16_t arm_cfft_mixed_factorize(uint32_t n, uint16_t * pFactors)
+{
+  static const uint16_t first[] = { 4U, 2U, 3U, 5U };
+  uint16_t numStages = 0U;
+  uint32_t i, p;
+
+  if (n < 2U)
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < sizeof(first) / sizeof(first[0]); i++)
+  {
+    while (n % first[i] == 0U)
+    {
+      if (numStages == ARM_CFFT_MIXED_MAX_FACTORS)
+      {
+        return 0U;
+      }
+      pFactors[numStages++] = first[i];
+      n /= first[i];
+    }
+  }
+  for (p = 7U; p <= ARM_CFFT_MIXED_MAX_RADIX && n > 1U; p += 2U)
+  {
+    while (n % p == 0U)
+    {
+      if (numStages == ARM_CFFT_MIXED_MAX_FACTORS)
+      {
+        return 0U;
+      }
+      pFactors[numStages++] = (uint16_t)p;
+      n /= p;
+    }
+  }
+  return n == 1U ? numStages : 0U;
+}
+
+/* Smallest power of two that can hold the linear convolution of Bluestein's
+   algorithm (at least 2*fftLen - 1), or 0 if no power-of-two CFFT exists. */
+static uint32_t arm_cfft_mixed_blue_len(uint32_t fftLen)
+{
+  uint32_t m = 16U;
+
+  while (m < 2U * fftLen - 1U)
+  {
+    m <<= 1U;
+  }
+  return m <= 4096U ? m : 0U;
+}
+
+/**
+  @brief         State buffer length required by \ref arm_cfft_mixed_init_f32.
+  @param[in]     fftLen  length of the FFT
+  @return        number of float32_t values, or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_cfft_mixed_state_len_f32(uint16_t fftLen)
+{
+  uint16_t factors[ARM_CFFT_MIXED_MAX_FACTORS];
+  uint32_t blueLen;
+
+  if (fftLen < 2U)
+  {
+    return 0U;
+  }
+  if (arm_cfft_mixed_factorize(fftLen, factors) != 0U)
+  {
+    return 2U * fftLen;
+  }
+  blueLen = arm_cfft_mixed_blue_len(fftLen);
+  return blueLen ? 2U * fftLen + 2U * blueLen : 0U;
+}
+
+/**
+  @brief         Scratch buffer length required by \ref arm_cfft_mixed_f32.
+  @param[in]     fftLen  length of the FFT
+  @return        number of float32_t values, or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_cfft_mixed_scratch_len_f32(uint16_t fftLen)
+{
+  uint16_t factors[ARM_CFFT_MIXED_MAX_FACTORS];
+
+  if (fftLen < 2U)
+  {
+    return 0U;
+  }
+  if (arm_cfft_mixed_factorize(fftLen, factors) != 0U)
+  {
+    return 2U * fftLen;
+  }
+  return 2U * arm_cfft_mixed_blue_len(fftLen);
+}
+
+/**
+  @brief         Initialization function for the arbitrary-length floating-point complex FFT.
+  @param[in,out] S         points to an arm_cfft_mixed_instance_f32 structure
+  @param[in]     fftLen    length of the FFT (2 to 2048, any factorization)
+  @param[out]    pState    buffer receiving the precomputed plan (twiddles or chirps)
+  @param[in]     stateLen  length of pState in float32_t values,
+                           at least \ref arm_cfft_mixed_state_len_f32(fftLen)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported length or state buffer too small
+
+  @par           Description
+                   Lengths whose prime factors are all at most \ref ARM_CFFT_MIXED_MAX_RADIX
+                   are computed by a self-sorting (Stockham) mixed-radix algorithm with
+                   dedicated radix-2, 3, 4 and 5 butterflies and a generic odd-radix stage.
+                   Other lengths use Bluestein's algorithm on top of a power-of-two
+                   \ref arm_cfft_f32 of at least 2*fftLen-1 points.
+  @par
+                   The plan lives in the caller's pState buffer, so several instances can be
+                   initialized without dynamic memory. The buffer must stay valid while the
+                   instance is used.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pState,
+  uint32_t stateLen)
+{
+  uint32_t k, m, n2, minLen;
+  float32_t * pChirpFft;
+  double a;
+
+  minLen = arm_cfft_mixed_state_len_f32(fftLen);
+  if (!S || !pState || fftLen < 2U || minLen == 0U || stateLen < minLen)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = arm_cfft_mixed_factorize(fftLen, S->factors);
+  S->pTwiddle = NULL;
+  S->blueLen = 0U;
+  S->pChirp = NULL;
+  S->pChirpFft = NULL;
+
+  if (S->numStages != 0U)
+  {
+    /* W_N^k = exp(-2*pi*i*k/N), k = 0..N-1 */
+    for (k = 0U; k < fftLen; k++)
+    {
+      a = 2.0 * ARM_CFFT_MIXED_PI * (double)k / (double)fftLen;
+      pState[2U * k]      = (float32_t)cos(a);
+      pState[2U * k + 1U] = (float32_t)-sin(a);
+    }
+    S->pTwiddle = pState;
+    return ARM_MATH_SUCCESS;
+  }
+
+  /* Bluestein: chirp c_n = exp(-i*pi*n^2/N); n^2 is reduced modulo 2N first so
+     the angle stays accurate for large n */
+  m = arm_cfft_mixed_blue_len(fftLen);
+  if (arm_cfft_init_f32(&S->blueCfft, (uint16_t)m) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  S->blueLen = (uint16_t)m;
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    n2 = (k * k) % (2U * fftLen);
+    a = ARM_CFFT_MIXED_PI * (double)n2 / (double)fftLen;
+    pState[2U * k]      = (float32_t)cos(a);
+    pState[2U * k + 1U] = (float32_t)-sin(a);
+  }
+  S->pChirp = pState;
+
+  /* Filter b_n = conj(c_|n|) wrapped onto the convolution length, transformed once */
+  pChirpFft = pState + 2U * fftLen;
+  for (k = 0U; k < 2U * m; k++)
+  {
+    pChirpFft[k] = 0.0f;
+  }
+  for (k = 0U; k < fftLen; k++)
+  {
+    pChirpFft[2U * k]      =  pState[2U * k];
+    pChirpFft[2U * k + 1U] = -pState[2U * k + 1U];
+    if (k != 0U)
+    {
+      pChirpFft[2U * (m - k)]      =  pState[2U * k];
+      pChirpFft[2U * (m - k) + 1U] = -pState[2U * k + 1U];
+    }
+  }
+  arm_cfft_f32(&S->blueCfft, pChirpFft, 0U, 1U);
+  S->pChirpFft = pChirpFft;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
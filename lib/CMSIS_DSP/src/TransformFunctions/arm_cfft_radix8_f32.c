@@ -28,6 +28,9 @@
 
 #include "dsp/transform_functions.h"
 
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_avx2_utils.h"
+#endif
 
 /* ----------------------------------------------------------------------
  * Internal helper function used by the FFTs
@@ -48,12 +51,140 @@ void arm_radix8_butterfly_f32(
   return        none
 */
 
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/* Radix-8 butterfly without twiddles on 8 vectors of 4 complex values */
+__STATIC_FORCEINLINE void arm_radix8_core_avx2(__m256 * x)
+{
+   const __m256 C81 = _mm256_set1_ps(0.70710678118f);
+   __m256 a, b, c, d, e, f, g, h, t, p, q;
+
+   a = _mm256_add_ps(x[0], x[4]);
+   e = _mm256_sub_ps(x[0], x[4]);
+   b = _mm256_add_ps(x[1], x[5]);
+   f = _mm256_sub_ps(x[1], x[5]);
+   c = _mm256_add_ps(x[2], x[6]);
+   g = _mm256_sub_ps(x[2], x[6]);
+   d = _mm256_add_ps(x[3], x[7]);
+   h = _mm256_sub_ps(x[3], x[7]);
+
+   t = _mm256_sub_ps(a, c);
+   a = _mm256_add_ps(a, c);
+   c = arm_avx2_mul_negj_f32(_mm256_sub_ps(b, d));
+   b = _mm256_add_ps(b, d);
+   x[0] = _mm256_add_ps(a, b);
+   x[4] = _mm256_sub_ps(a, b);
+   x[2] = _mm256_add_ps(t, c);
+   x[6] = _mm256_sub_ps(t, c);
+
+   p = _mm256_mul_ps(_mm256_sub_ps(f, h), C81);
+   q = _mm256_mul_ps(_mm256_add_ps(f, h), C81);
+   a = _mm256_add_ps(e, p);
+   e = _mm256_sub_ps(e, p);
+   b = arm_avx2_mul_negj_f32(_mm256_add_ps(g, q));
+   g = arm_avx2_mul_negj_f32(_mm256_sub_ps(g, q));
+   x[1] = _mm256_add_ps(a, b);
+   x[7] = _mm256_sub_ps(a, b);
+   x[5] = _mm256_add_ps(e, g);
+   x[3] = _mm256_sub_ps(e, g);
+}
+
+/*
+  AVX2 variant, used when fftLen >= 64 (fftLen/8 butterflies per group is then
+  a multiple of 4). Stages with n2 >= 8 process 4 consecutive butterfly indices
+  per vector with gathered twiddles. The last stage (unit twiddles, 8 adjacent
+  points per butterfly) transposes 4 butterflies into 8 vectors.
+*/
+static void arm_radix8_butterfly_avx2(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+   uint32_t n1, n2, i1, j, k;
+   __m256 x[8], w[7];
+
+   n2 = fftLen;
+
+   while (n2 > 8)
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      for (j = 0; j < n2; j += 4)
+      {
+         const __m128i jv = _mm_add_epi32(_mm_set1_epi32((int32_t) j), _mm_setr_epi32(0, 1, 2, 3));
+
+         for (k = 0; k < 7; k++)
+         {
+            w[k] = arm_avx2_gather_cplx_f32(pCoef,
+                      _mm_mullo_epi32(jv, _mm_set1_epi32((int32_t) ((k + 1) * twidCoefModifier))));
+         }
+
+         for (i1 = j; i1 < fftLen; i1 += n1)
+         {
+            float32_t * p = pSrc + 2 * i1;
+
+            for (k = 0; k < 8; k++)
+               x[k] = _mm256_loadu_ps(p + 2 * k * n2);
+
+            arm_radix8_core_avx2(x);
+
+            _mm256_storeu_ps(p, x[0]);
+            for (k = 1; k < 8; k++)
+               _mm256_storeu_ps(p + 2 * k * n2, arm_avx2_cmul_conj_f32(x[k], w[k - 1]));
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   }
+
+   for (i1 = 0; i1 < fftLen; i1 += 32)
+   {
+      float32_t * p = pSrc + 2 * i1;
+
+      /* x[k] = point k of butterflies 0..3 */
+      x[0] = _mm256_loadu_ps(p);
+      x[4] = _mm256_loadu_ps(p + 8);
+      x[1] = _mm256_loadu_ps(p + 16);
+      x[5] = _mm256_loadu_ps(p + 24);
+      x[2] = _mm256_loadu_ps(p + 32);
+      x[6] = _mm256_loadu_ps(p + 40);
+      x[3] = _mm256_loadu_ps(p + 48);
+      x[7] = _mm256_loadu_ps(p + 56);
+      arm_avx2_transpose4_cplx_f32(&x[0], &x[1], &x[2], &x[3]);
+      arm_avx2_transpose4_cplx_f32(&x[4], &x[5], &x[6], &x[7]);
+
+      arm_radix8_core_avx2(x);
+
+      arm_avx2_transpose4_cplx_f32(&x[0], &x[1], &x[2], &x[3]);
+      arm_avx2_transpose4_cplx_f32(&x[4], &x[5], &x[6], &x[7]);
+      _mm256_storeu_ps(p,      x[0]);
+      _mm256_storeu_ps(p + 8,  x[4]);
+      _mm256_storeu_ps(p + 16, x[1]);
+      _mm256_storeu_ps(p + 24, x[5]);
+      _mm256_storeu_ps(p + 32, x[2]);
+      _mm256_storeu_ps(p + 40, x[6]);
+      _mm256_storeu_ps(p + 48, x[3]);
+      _mm256_storeu_ps(p + 56, x[7]);
+   }
+}
+#endif /* defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
 ARM_DSP_ATTRIBUTE void arm_radix8_butterfly_f32(
   float32_t * pSrc,
   uint16_t fftLen,
   const float32_t * pCoef,
   uint16_t twidCoefModifier)
 {
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+   if (fftLen >= 64U)
+   {
+      arm_radix8_butterfly_avx2(pSrc, fftLen, pCoef, twidCoefModifier);
+      return;
+   }
+#endif
+
    uint32_t ia1, ia2, ia3, ia4, ia5, ia6, ia7;
    uint32_t i1, i2, i3, i4, i5, i6, i7, i8;
    uint32_t id;
@@ -312,6 +312,106 @@ static void merge_rfft_f32(
 No stage merge functions defined here for Neon.
 
 */
+#elif defined(ARM_MATH_AVX2) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_avx2_utils.h"
+
+/*
+  Bins k = 1 .. fftLen-1 are processed 4 at a time, pairing XA(k..k+3) with the
+  reversed XB(fftLen-k-3 .. fftLen-k). The last (fftLen-1) % 4 bins use the
+  scalar formulas.
+*/
+static void stage_rfft_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+  const uint32_t  L = (S->Sint).fftLen;
+  const float32_t * pCoeff = S->pTwiddleRFFT;
+  const __m256    half = _mm256_set1_ps(0.5f);
+        float32_t xAR, xAI, xBR, xBI, twR, twI, t1a, t1b;
+        __m256    xA, xB, sum;
+        uint32_t  k;
+
+  /* Pack first and last sample of the frequency domain together */
+  xAR = p[0];
+  xAI = p[1];
+  pOut[0] = 0.5f * ( (xAR + xAR) + (xAI + xAI) );
+  pOut[1] = 0.5f * ( (xAR + xAR) - (xAI + xAI) );
+
+  for (k = 1; k + 3 < L; k += 4)
+  {
+    xA = _mm256_loadu_ps(p + 2 * k);
+    xB = arm_avx2_conj_f32(arm_avx2_rev_cplx_f32(_mm256_loadu_ps(p + 2 * (L - k - 3))));
+
+    /* 1/2 * (XA + conj(XB) + tw * (conj(XB) - XA)) */
+    sum = _mm256_add_ps(xA, xB);
+    sum = _mm256_add_ps(sum, arm_avx2_cmul_f32(_mm256_sub_ps(xB, xA), _mm256_loadu_ps(pCoeff + 2 * k)));
+    _mm256_storeu_ps(pOut + 2 * k, _mm256_mul_ps(sum, half));
+  }
+
+  for (; k < L; k++)
+  {
+    xAR = p[2 * k];
+    xAI = p[2 * k + 1];
+    xBR = p[2 * (L - k)];
+    xBI = p[2 * (L - k) + 1];
+    twR = pCoeff[2 * k];
+    twI = pCoeff[2 * k + 1];
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    pOut[2 * k]     = 0.5f * (xAR + xBR + twR * t1a + twI * t1b);
+    pOut[2 * k + 1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+  }
+}
+
+/* Prepares data for inverse cfft */
+static void merge_rfft_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+  const uint32_t  L = (S->Sint).fftLen;
+  const float32_t * pCoeff = S->pTwiddleRFFT;
+  const __m256    half = _mm256_set1_ps(0.5f);
+        float32_t xAR, xAI, xBR, xBI, twR, twI, t1a, t1b;
+        __m256    xA, xB, m;
+        uint32_t  k;
+
+  xAR = p[0];
+  xAI = p[1];
+  pOut[0] = 0.5f * ( xAR + xAI );
+  pOut[1] = 0.5f * ( xAR - xAI );
+
+  for (k = 1; k + 3 < L; k += 4)
+  {
+    xA = _mm256_loadu_ps(p + 2 * k);
+    xB = arm_avx2_conj_f32(arm_avx2_rev_cplx_f32(_mm256_loadu_ps(p + 2 * (L - k - 3))));
+
+    /* 1/2 * (XA + conj(XB) - conj(tw) * (XA - conj(XB))) */
+    m = arm_avx2_cmul_conj_f32(_mm256_sub_ps(xA, xB), _mm256_loadu_ps(pCoeff + 2 * k));
+    m = _mm256_sub_ps(_mm256_add_ps(xA, xB), m);
+    _mm256_storeu_ps(pOut + 2 * k, _mm256_mul_ps(m, half));
+  }
+
+  for (; k < L; k++)
+  {
+    xAR = p[2 * k];
+    xAI = p[2 * k + 1];
+    xBR = p[2 * (L - k)];
+    xBI = p[2 * (L - k) + 1];
+    twR = pCoeff[2 * k];
+    twI = pCoeff[2 * k + 1];
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    pOut[2 * k]     = 0.5f * (xAR + xBR - twR * t1a - twI * t1b);
+    pOut[2 * k + 1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+  }
+}
 #else
 static void stage_rfft_f32(
   const arm_rfft_fast_instance_f32 * S,
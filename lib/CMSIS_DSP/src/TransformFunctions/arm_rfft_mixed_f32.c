@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Arbitrary even-length floating-point real FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/* Z = CFFT(z) of the packed sequence z_n = x_2n + i*x_2n+1 (h = N/2 values) gives
+     A_k = (Z_k + conj(Z_h-k)) / 2,  B_k = -i (Z_k - conj(Z_h-k)) / 2
+     X_k = A_k + W_N^k B_k
+   Bins k and h-k are computed together so the split can run in place. */
+static void arm_rfft_mixed_split_f32(const float32_t * pTw, float32_t * p, uint32_t h)
+{
+  uint32_t k, j;
+  float32_t zkr, zki, zjr, zji;
+  float32_t ar, ai, br, bi, wr, wi;
+  float32_t xkr, xki, xjr, xji;
+
+  /* DC and Nyquist are real: packed as p[0] and p[1] like arm_rfft_fast_f32 */
+  zkr = p[0];
+  zki = p[1];
+  p[0] = zkr + zki;
+  p[1] = zkr - zki;
+
+  for (k = 1U; k <= h / 2U; k++)
+  {
+    j = h - k;
+    zkr = p[2U * k];  zki = p[2U * k + 1U];
+    zjr = p[2U * j];  zji = p[2U * j + 1U];
+
+    /* bin k */
+    ar = 0.5f * (zkr + zjr);  ai = 0.5f * (zki - zji);
+    br = 0.5f * (zki + zji);  bi = -0.5f * (zkr - zjr);
+    wr = pTw[2U * k];  wi = pTw[2U * k + 1U];
+    xkr = ar + br * wr - bi * wi;
+    xki = ai + br * wi + bi * wr;
+
+    /* bin h-k: A_j = conj(A_k), B_j = conj(B_k) */
+    wr = pTw[2U * j];  wi = pTw[2U * j + 1U];
+    xjr = ar + br * wr + bi * wi;
+    xji = -ai + br * wi - bi * wr;
+
+    p[2U * k] = xkr;  p[2U * k + 1U] = xki;
+    p[2U * j] = xjr;  p[2U * j + 1U] = xji;
+  }
+}
+
+/* Inverse of the split: A_k = (X_k + conj(X_h-k)) / 2,
+   B_k = conj(W_N^k) (X_k - conj(X_h-k)) / 2,  Z_k = A_k + i B_k */
+static void arm_rfft_mixed_merge_f32(const float32_t * pTw, const float32_t * pSrc,
+                                     float32_t * pDst, uint32_t h)
+{
+  uint32_t k, j;
+  float32_t xkr, xki, xjr, xji;
+  float32_t ar, ai, dr, di, br, bi, wr, wi;
+
+  pDst[0] = 0.5f * (pSrc[0] + pSrc[1]);
+  pDst[1] = 0.5f * (pSrc[0] - pSrc[1]);
+
+  for (k = 1U; k < h; k++)
+  {
+    j = h - k;
+    xkr = pSrc[2U * k];  xki = pSrc[2U * k + 1U];
+    xjr = pSrc[2U * j];  xji = pSrc[2U * j + 1U];
+
+    ar = 0.5f * (xkr + xjr);  ai = 0.5f * (xki - xji);
+    dr = 0.5f * (xkr - xjr);  di = 0.5f * (xki + xji);
+    wr = pTw[2U * k];  wi = -pTw[2U * k + 1U];
+    br = dr * wr - di * wi;
+    bi = dr * wi + di * wr;
+
+    pDst[2U * k]      = ar - bi;
+    pDst[2U * k + 1U] = ai + br;
+  }
+}
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/**
+  @brief         Processing function for the arbitrary even-length floating-point real FFT.
+  @param[in]     S         points to an instance initialized by \ref arm_rfft_mixed_init_f32
+  @param[in]     pSrc      points to the input buffer (fftLen values), not modified
+  @param[out]    pDst      points to the output buffer (fftLen values)
+  @param[in]     pScratch  points to a scratch buffer of
+                           \ref arm_rfft_mixed_scratch_len_f32(fftLen) values
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+
+  @par           Format
+                   Same packing as \ref arm_rfft_fast_f32: the spectrum holds fftLen/2
+                   complex values, with the real Nyquist bin stored in the imaginary part
+                   of bin 0. The inverse transform returns the original sequence.
+  @par
+                   pSrc, pDst and pScratch must not overlap.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint8_t ifftFlag)
+{
+  const uint32_t h = S->fftLenRFFT / 2U;
+
+  if (ifftFlag)
+  {
+    /* Rebuild Z in the first fftLen values of the scratch buffer */
+    arm_rfft_mixed_merge_f32(S->pTwiddleRFFT, pSrc, pScratch, h);
+    arm_cfft_mixed_f32(&S->Sint, pScratch, pDst, pScratch + 2U * h, 1U);
+  }
+  else
+  {
+    arm_cfft_mixed_f32(&S->Sint, pSrc, pDst, pScratch, 0U);
+    arm_rfft_mixed_split_f32(S->pTwiddleRFFT, pDst, h);
+  }
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
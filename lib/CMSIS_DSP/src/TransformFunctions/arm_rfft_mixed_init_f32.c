@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization of the arbitrary even-length floating-point real FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+#include <math.h>
+
+/* The plan is computed in double precision; PI from arm_math_types.h is a float */
+#define ARM_RFFT_MIXED_PI 3.14159265358979323846
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/**
+  @brief         State buffer length required by \ref arm_rfft_mixed_init_f32.
+  @param[in]     fftLen  length of the real sequence (even)
+  @return        number of float32_t values, or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_rfft_mixed_state_len_f32(uint16_t fftLen)
+{
+  uint32_t cfftLen;
+
+  if ((fftLen & 1U) || fftLen < 4U)
+  {
+    return 0U;
+  }
+  cfftLen = arm_cfft_mixed_state_len_f32(fftLen / 2U);
+  return cfftLen ? cfftLen + fftLen : 0U;
+}
+
+/**
+  @brief         Scratch buffer length required by \ref arm_rfft_mixed_f32.
+  @param[in]     fftLen  length of the real sequence (even)
+  @return        number of float32_t values, or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_rfft_mixed_scratch_len_f32(uint16_t fftLen)
+{
+  uint32_t cfftLen;
+
+  if ((fftLen & 1U) || fftLen < 4U)
+  {
+    return 0U;
+  }
+  cfftLen = arm_cfft_mixed_scratch_len_f32(fftLen / 2U);
+  return cfftLen ? cfftLen + fftLen : 0U;
+}
+
+/**
+  @brief         Initialization function for the arbitrary even-length floating-point real FFT.
+  @param[in,out] S         points to an arm_rfft_mixed_instance_f32 structure
+  @param[in]     fftLen    length of the real sequence (even, 4 to 4096)
+  @param[out]    pState    buffer receiving the precomputed plan
+  @param[in]     stateLen  length of pState in float32_t values,
+                           at least \ref arm_rfft_mixed_state_len_f32(fftLen)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported length or state buffer too small
+
+  @par           Description
+                   The real sequence is processed as a complex sequence of fftLen/2 values
+                   with \ref arm_cfft_mixed_f32, followed by the usual split step. Lengths such
+                   as 104, 208 or 312 (one or more seconds at 104 Hz) therefore need no zero
+                   padding and give bins on an exact 1 Hz grid.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pState,
+  uint32_t stateLen)
+{
+  uint32_t cfftLen, k;
+  float32_t * pTw;
+  double a;
+
+  cfftLen = arm_rfft_mixed_state_len_f32(fftLen);
+  if (!S || !pState || cfftLen == 0U || stateLen < cfftLen)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  cfftLen -= fftLen;
+
+  if (arm_cfft_mixed_init_f32(&S->Sint, fftLen / 2U, pState, cfftLen) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Split twiddles W_N^k = exp(-2*pi*i*k/N), k = 0..N/2-1 */
+  pTw = pState + cfftLen;
+  for (k = 0U; k < fftLen / 2U; k++)
+  {
+    a = 2.0 * ARM_RFFT_MIXED_PI * (double)k / (double)fftLen;
+    pTw[2U * k]      = (float32_t)cos(a);
+    pTw[2U * k + 1U] = (float32_t)-sin(a);
+  }
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTw;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_pruned_f32.c
+ * Description:  Output-pruned floating-point real FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <string.h>
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/**
+  @brief         Processing function for the output-pruned floating-point real FFT.
+  @param[in]     S         points to an arm_rfft_pruned_instance_f32 structure
+  @param[in]     pSrc      points to the real input buffer of <code>fftLen</code> values
+                           (not modified)
+  @param[out]    pDst      points to the output buffer of <code>numBins</code> complex values
+  @param[in]     pScratch  points to a scratch buffer of <code>2 * fftLenSub</code> values
+
+  @par           Output format
+                   Bins 0..maxBin are written as interleaved complex values. Unlike
+                   \ref arm_rfft_fast_f32, the imaginary part of bin 0 is 0 (the Nyquist
+                   bin is never produced), so the result can be passed directly to
+                   \ref arm_cmplx_mag_f32.
+  @par           Full-transform plans
+                   When <code>S->numSub</code> is 1 the input is copied to the scratch buffer
+                   so that <code>pSrc</code> is preserved. A caller that does not need its input
+                   afterwards can skip the copy by calling \ref arm_rfft_fast_f32 on
+                   <code>S->Sub</code> directly (that function overwrites its input).
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_pruned_f32(
+  const arm_rfft_pruned_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  const uint32_t subLen  = S->fftLenSub;
+  const uint32_t numSub  = S->numSub;
+  const uint32_t numBins = S->numBins;
+  const uint32_t mask    = S->fftLen - 1U;
+  const float32_t * pTw  = S->pTwiddle;
+        float32_t * pIn  = pScratch;
+        float32_t * pSub = pScratch + subLen;
+        uint32_t q, m, k, tw;
+        float32_t xr, xi, wr, wi;
+
+  /* Sub-transform 0 has unit twiddles: copy its bins directly */
+  if (numSub == 1U)
+  {
+    memcpy(pIn, pSrc, subLen * sizeof(float32_t));
+  }
+  else
+  {
+    for (m = 0U; m < subLen; m++)
+    {
+      pIn[m] = pSrc[m * numSub];
+    }
+  }
+  arm_rfft_fast_f32(&S->Sub, pIn, pSub, 0U);
+  pDst[0] = pSub[0];
+  pDst[1] = 0.0f;
+  for (k = 1U; k < numBins; k++)
+  {
+    pDst[2U * k]      = pSub[2U * k];
+    pDst[2U * k + 1U] = pSub[2U * k + 1U];
+  }
+
+  for (q = 1U; q < numSub; q++)
+  {
+    /* Decimation in time: x_q[m] = x[m*Q + q] */
+    for (m = 0U; m < subLen; m++)
+    {
+      pIn[m] = pSrc[m * numSub + q];
+    }
+    arm_rfft_fast_f32(&S->Sub, pIn, pSub, 0U);
+
+    /* X[k] += W_N^(q*k) * X_q[k]; numBins <= fftLenSub/2, so X_q[k] is read
+       straight from the packed output (bin 0 real part only) */
+    pDst[0] += pSub[0];
+    tw = q;
+    for (k = 1U; k < numBins; k++)
+    {
+      xr = pSub[2U * k];
+      xi = pSub[2U * k + 1U];
+      /* Twiddle table holds (cos, sin) of +2*pi*i/N; forward transform uses the conjugate */
+      wr = pTw[2U * tw];
+      wi = pTw[2U * tw + 1U];
+      pDst[2U * k]      += xr * wr + xi * wi;
+      pDst[2U * k + 1U] += xi * wr - xr * wi;
+      tw = (tw + q) & mask;
+    }
+  }
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_pruned_init_f32.c
+ * Description:  Initialization function for the output-pruned floating-point real FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 The tremor detector project contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_common_tables.h"
+
+#if !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/* Estimated run time of the pruned transform, in units of a quarter of the
+   per-point cost of arm_rfft_fast_f32 (time ~ P*log2(P) plus a fixed call
+   overhead). The weights were fitted to bench_fft timings over N = 256..1024,
+   P = 32..N and 5..147 output bins:
+     - each sub-transform of length P : 4*P*log2(P) + 100
+     - strided gather of the input    : 5 per input sample
+     - twiddle combination            : 15 per output bin and per sub-transform
+   The optimized radix-8 butterflies make one full-length transform nearly as
+   cheap per point as the short ones, so the gather and the combination, not
+   the shorter sub-transforms, decide whether a split pays off. */
+static uint32_t arm_rfft_pruned_cost(uint32_t fftLen, uint32_t subLen, uint32_t numBins)
+{
+  uint32_t log2P = 0;
+  uint32_t numSub = fftLen / subLen;
+
+  while ((1U << log2P) < subLen)
+  {
+    log2P++;
+  }
+
+  if (numSub == 1U)
+  {
+    return 4U * subLen * log2P + 100U;
+  }
+
+  return numSub * (4U * subLen * log2P + 100U + 15U * numBins) + 5U * fftLen;
+}
+
+/**
+  @brief         Initialization function for the output-pruned floating-point real FFT.
+  @param[in,out] S       points to an arm_rfft_pruned_instance_f32 structure
+  @param[in]     fftLen  length of the real input sequence
+  @param[in]     maxBin  highest output bin that is needed (must be below fftLen/2)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+                                                    or <code>maxBin</code> is out of range
+
+  @par           Description
+                   The transform length is split as fftLen = P * Q. The input is decimated
+                   in time into Q interleaved sequences of length P, each transformed with
+                   \ref arm_rfft_fast_f32, and only bins 0..maxBin of the full transform are
+                   rebuilt from them. This is a decimation-in-time split with selective
+                   recombination: every sub-transform is computed in full, and only the final
+                   twiddle combination is restricted to the requested bins.
+  @par
+                   P is chosen by a cost model calibrated against \ref arm_rfft_fast_f32 and
+                   is reported in <code>S->fftLenSub</code>. A split is only taken when its
+                   estimated cost is at least 1/16 below the full transform; otherwise P equals
+                   <code>fftLen</code> and the function falls back to a full transform
+                   (<code>S->numSub</code> == 1). A split pays off for narrow bands (roughly
+                   maxBin < fftLen/40); for wider bands the gather and the twiddle combination
+                   cost more than the shorter sub-transforms save.
+  @par
+                   Supported FFT lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+                   The combination twiddles are taken from the complex FFT table of length
+                   <code>fftLen</code> in CommonTables.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_pruned_init_f32(
+  arm_rfft_pruned_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t maxBin)
+{
+  uint32_t subLen, bestLen, bestCost, fullCost, cost;
+
+  if (!S)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  switch (fftLen)
+  {
+  case 32U:   S->pTwiddle = twiddleCoef_32;   break;
+  case 64U:   S->pTwiddle = twiddleCoef_64;   break;
+  case 128U:  S->pTwiddle = twiddleCoef_128;  break;
+  case 256U:  S->pTwiddle = twiddleCoef_256;  break;
+  case 512U:  S->pTwiddle = twiddleCoef_512;  break;
+  case 1024U: S->pTwiddle = twiddleCoef_1024; break;
+  case 2048U: S->pTwiddle = twiddleCoef_2048; break;
+  case 4096U: S->pTwiddle = twiddleCoef_4096; break;
+  default:
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if (maxBin >= fftLen / 2U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Pick the sub-transform length with the lowest estimated cost. Every
+     requested bin must lie below the Nyquist bin of the sub-transform, and a
+     split must beat the full transform by the model's margin of error. */
+  bestLen = fftLen;
+  fullCost = arm_rfft_pruned_cost(fftLen, fftLen, maxBin + 1U);
+  bestCost = fullCost - fullCost / 16U;
+  for (subLen = 32U; subLen < fftLen; subLen <<= 1U)
+  {
+    if (maxBin >= subLen / 2U)
+    {
+      continue;
+    }
+    cost = arm_rfft_pruned_cost(fftLen, subLen, maxBin + 1U);
+    if (cost < bestCost)
+    {
+      bestCost = cost;
+      bestLen = subLen;
+    }
+  }
+
+  S->fftLen = fftLen;
+  S->fftLenSub = (uint16_t)bestLen;
+  S->numSub = (uint16_t)(fftLen / bestLen);
+  S->numBins = (uint16_t)(maxBin + 1U);
+
+  return arm_rfft_fast_init_f32(&S->Sub, (uint16_t)bestLen);
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
+
+#endif /* !(defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)) */
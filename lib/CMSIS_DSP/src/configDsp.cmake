@@ -35,6 +35,18 @@ if (NEONEXPERIMENTAL)
     target_compile_definitions(${project} PUBLIC ARM_MATH_NEON_EXPERIMENTAL)
 endif()
 
+if (AVX2)
+    # Host only: the intrinsics replace the generic C code for some transforms
+    target_compile_definitions(${project} PUBLIC ARM_MATH_AVX2)
+    target_compile_options(${project} PUBLIC -mavx2 -mfma)
+endif()
+
+if (X86DISPATCH)
+    # Host only: per-function variants are compiled with target attributes,
+    # so no -m flags are needed
+    target_compile_definitions(${project} PUBLIC ARM_MATH_X86_DISPATCH)
+endif()
+
 if (MVEFLOAT16)
     target_compile_definitions(${project} PRIVATE ARM_MATH_MVE_FLOAT16) 
 endif()
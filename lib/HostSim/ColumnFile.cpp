@@ -0,0 +1,112 @@
+#include "ColumnFile.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char MAGIC[8] = {'C', 'O', 'L', 'F', '0', '0', '0', '1'};
+static const size_t ALIGN = 64;
+
+size_t columnTypeSize(char type) {
+    switch (type) {
+    case 'f': case 'i': case 'I': return 4;
+    case 'h': case 'H': return 2;
+    case 'B': return 1;
+    default: return 0;
+    }
+}
+
+/*********** 写入 ***********/
+void ColumnWriter::add(const char *name, char type, const void *data, size_t count) {
+    cols_.push_back({name, type, data, count});
+}
+
+bool ColumnWriter::write(const char *path) const {
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return false;
+
+    // 先排好目录，再依次写出对齐后的列数据
+    std::vector<ColumnInfo> dir(cols_.size());
+    uint64_t off = 16 + dir.size() * sizeof(ColumnInfo);
+    for (size_t i = 0; i < cols_.size(); i++) {
+        const Column &c = cols_[i];
+        ColumnInfo &d = dir[i];
+        memset(&d, 0, sizeof(d));
+        strncpy(d.name, c.name.c_str(), sizeof(d.name) - 1);
+        d.type = (uint32_t)c.type;
+        d.elemSize = (uint32_t)columnTypeSize(c.type);
+        d.count = c.count;
+        off = (off + ALIGN - 1) / ALIGN * ALIGN;
+        d.offset = off;
+        off += d.count * d.elemSize;
+    }
+
+    uint32_t hdr[2] = {(uint32_t)dir.size(), 0};
+    bool ok = fwrite(MAGIC, 1, 8, fp) == 8 && fwrite(hdr, 4, 2, fp) == 2 &&
+              fwrite(dir.data(), sizeof(ColumnInfo), dir.size(), fp) == dir.size();
+    uint64_t pos = 16 + dir.size() * sizeof(ColumnInfo);
+    static const uint8_t zeros[ALIGN] = {0};
+    for (size_t i = 0; ok && i < cols_.size(); i++) {
+        ok = fwrite(zeros, 1, dir[i].offset - pos, fp) == dir[i].offset - pos;
+        size_t bytes = dir[i].count * dir[i].elemSize;
+        ok = ok && (bytes == 0 || fwrite(cols_[i].data, 1, bytes, fp) == bytes);
+        pos = dir[i].offset + bytes;
+    }
+    return fclose(fp) == 0 && ok;
+}
+
+/*********** 读取 ***********/
+bool ColumnReader::open(const char *path) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 16) {
+        ::close(fd);
+        return false;
+    }
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) return false;
+    base_ = (const uint8_t *)p;
+    size_ = st.st_size;
+
+    uint32_t n;
+    memcpy(&n, base_ + 8, 4);
+    if (memcmp(base_, MAGIC, 8) != 0 || 16 + (uint64_t)n * sizeof(ColumnInfo) > size_) {
+        close();
+        return false;
+    }
+    dir_ = (const ColumnInfo *)(base_ + 16);
+    count_ = n;
+    for (size_t i = 0; i < count_; i++) {
+        const ColumnInfo &c = dir_[i];
+        if (c.elemSize != columnTypeSize((char)c.type) || c.offset > size_ ||
+            c.count * c.elemSize > size_ - c.offset) {
+            close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ColumnReader::close() {
+    if (base_) munmap((void *)base_, size_);
+    base_ = nullptr;
+    size_ = 0;
+    count_ = 0;
+    dir_ = nullptr;
+}
+
+const void *ColumnReader::find(const char *name, char type, size_t *count) const {
+    for (size_t i = 0; i < count_; i++) {
+        if (strncmp(dir_[i].name, name, sizeof(dir_[i].name)) == 0) {
+            if (dir_[i].type != (uint32_t)type) return nullptr;
+            if (count) *count = dir_[i].count;
+            return base_ + dir_[i].offset;
+        }
+    }
+    return nullptr;
+}
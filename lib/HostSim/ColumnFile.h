@@ -0,0 +1,91 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*************************************
+ *  列式二进制文件（主机端）          *
+ *  每列连续存放、64 字节对齐，读取时  *
+ *  mmap 后直接按指针访问，无需解析    *
+ *************************************/
+// 文件布局（小端）：
+//   [magic "COLF0001"][列数 u32][保留 u32]
+//   列目录 × 列数：[名称 char[24]，'\0' 结尾][类型 u32][元素字节 u32][行数 u64][数据偏移 u64]
+//   各列数据
+// 类型码：'f' float32  'i' int32  'I' uint32  'h' int16  'H' uint16  'B' uint8
+// numpy: np.memmap(path, dtype, 'r', offset, (count,)) 即可按列读取
+
+struct ColumnInfo {
+    char name[24];
+    uint32_t type;
+    uint32_t elemSize;
+    uint64_t count;
+    uint64_t offset;
+};
+
+static_assert(sizeof(ColumnInfo) == 48, "column directory entry must stay 48 bytes");
+
+/*********** 写入 ***********/
+class ColumnWriter {
+public:
+    // data 在 write() 之前必须保持有效
+    void add(const char *name, char type, const void *data, size_t count);
+
+    template <class T>
+    void add(const char *name, const std::vector<T> &v) {
+        add(name, typeCode<T>(), v.data(), v.size());
+    }
+
+    bool write(const char *path) const;
+
+private:
+    template <class T> static char typeCode();
+
+    struct Column {
+        std::string name;
+        char type;
+        const void *data;
+        size_t count;
+    };
+    std::vector<Column> cols_;
+};
+
+template <> inline char ColumnWriter::typeCode<float>()    { return 'f'; }
+template <> inline char ColumnWriter::typeCode<int32_t>()  { return 'i'; }
+template <> inline char ColumnWriter::typeCode<uint32_t>() { return 'I'; }
+template <> inline char ColumnWriter::typeCode<int16_t>()  { return 'h'; }
+template <> inline char ColumnWriter::typeCode<uint16_t>() { return 'H'; }
+template <> inline char ColumnWriter::typeCode<uint8_t>()  { return 'B'; }
+
+size_t columnTypeSize(char type);  // 未知类型返回 0
+
+/*********** 读取（mmap） ***********/
+class ColumnReader {
+public:
+    ColumnReader() : base_(nullptr), size_(0), count_(0), dir_(nullptr) {}
+    ~ColumnReader() { close(); }
+    ColumnReader(const ColumnReader &) = delete;
+    ColumnReader &operator=(const ColumnReader &) = delete;
+
+    // 映射并校验文件；失败返回 false
+    bool open(const char *path);
+    void close();
+
+    size_t columns() const { return count_; }
+    const ColumnInfo &info(size_t i) const { return dir_[i]; }
+
+    // 按名称查找；类型不符或不存在时返回 nullptr
+    const void *find(const char *name, char type, size_t *count) const;
+
+    template <class T>
+    const T *get(const char *name, char type, size_t *count) const {
+        return (const T *)find(name, type, count);
+    }
+
+private:
+    const uint8_t *base_;
+    size_t size_;
+    size_t count_;
+    const ColumnInfo *dir_;
+};
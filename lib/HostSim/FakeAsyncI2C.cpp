@@ -0,0 +1,29 @@
+#include "FakeAsyncI2C.h"
+
+int FakeAsyncI2C::transfer(int address, const char *tx, int tx_len, char *rx, int rx_len,
+                           const Callback &cb, int event, bool repeated) {
+    if (pending_) return -1;
+    ++transfers_;
+
+    int rc = 0;
+    if (fail_next_) {
+        rc = -1;
+        fail_next_ = false;
+    } else {
+        if (tx_len > 0) rc = dev_.write(address, tx, tx_len, rx_len > 0);
+        if (rc == 0 && rx_len > 0) rc = dev_.read(address, rx, rx_len, repeated);
+    }
+
+    pending_ = true;
+    pending_event_ = rc == 0 ? I2C_EVENT_TRANSFER_COMPLETE : I2C_EVENT_ERROR_NO_SLAVE;
+    event_mask_ = event;
+    cb_ = cb;
+    return 0;
+}
+
+bool FakeAsyncI2C::completePending() {
+    if (!pending_) return false;
+    pending_ = false;
+    if (pending_event_ & event_mask_) cb_(pending_event_);
+    return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <functional>
+#include "Lsm6dslAsync.h"
+#include "Lsm6dslMock.h"
+
+/*************************************
+ *  mbed::I2C 异步传输的主机端替身     *
+ *  transfer() 立即对寄存器模型完成读写，*
+ *  但回调延迟到 completePending()，    *
+ *  以模拟 DMA 完成中断的时序           *
+ *************************************/
+class FakeAsyncI2C {
+public:
+    // 与 mbed::Callback<void(int)> 相同的 (对象, 成员函数) 构造方式
+    class Callback {
+    public:
+        Callback() {}
+        template <class T>
+        Callback(T *obj, void (T::*method)(int))
+            : fn_([obj, method](int ev) { (obj->*method)(ev); }) {}
+        void operator()(int ev) const { if (fn_) fn_(ev); }
+    private:
+        std::function<void(int)> fn_;
+    };
+
+    explicit FakeAsyncI2C(Lsm6dslMock &dev) : dev_(dev) {}
+
+    /*********** 阻塞接口（直接转发给寄存器模型） ***********/
+    void frequency(int) {}
+    int write(int address, const char *data, int length, bool repeated = false) {
+        return dev_.write(address, data, length, repeated);
+    }
+    int read(int address, char *data, int length, bool repeated = false) {
+        return dev_.read(address, data, length, repeated);
+    }
+
+    /*********** 异步接口 ***********/
+    // 总线忙时返回 -1，与 mbed 行为一致
+    int transfer(int address, const char *tx, int tx_len, char *rx, int rx_len,
+                 const Callback &cb, int event = I2C_EVENT_TRANSFER_COMPLETE,
+                 bool repeated = false);
+
+    bool pending() const { return pending_; }
+    // 触发挂起传输的完成回调，没有挂起传输时返回 false
+    bool completePending();
+    // 让下一次传输以 NACK 结束
+    void failNext() { fail_next_ = true; }
+
+    uint32_t transfers() const { return transfers_; }
+
+private:
+    Lsm6dslMock &dev_;
+    bool pending_ = false;
+    bool fail_next_ = false;
+    int pending_event_ = 0;
+    int event_mask_ = 0;
+    Callback cb_;
+    uint32_t transfers_ = 0;
+};
@@ -0,0 +1,194 @@
+#include "Lsm6dslMock.h"
+#include <math.h>
+#include <string.h>
+
+Lsm6dslMock::Lsm6dslMock(int addr7)
+    : addr7_(addr7), ptr_(0), transactions_(0), fifo_head_(0), fifo_count_(0),
+      pattern_(0), out_word_(0), overrun_(false), fifo_dropped_(0), bdu_pending_(0) {
+    memset(regs_, 0, sizeof(regs_));
+    memset(fifo_, 0, sizeof(fifo_));
+    memset(bdu_read_, 0, sizeof(bdu_read_));
+    memset(bdu_value_, 0, sizeof(bdu_value_));
+    regs_[WHO_AM_I] = LSM6DSL_ID;
+    regs_[CTRL3_C] = CTRL3_C_IF_INC;  // 上电默认值
+}
+
+/*********** I²C 事务 ***********/
+int Lsm6dslMock::write(int address, const char *data, int length, bool) {
+    ++transactions_;
+    if ((address >> 1) != addr7_) return -1;  // NACK
+    if (length <= 0) return 0;
+
+    // 第一个字节为寄存器地址，其余为数据
+    ptr_ = data[0] & 0x7F;
+    for (int i = 1; i < length; i++) {
+        writeReg(ptr_, (uint8_t)data[i]);
+        if (regs_[CTRL3_C] & CTRL3_C_IF_INC) ptr_ = (ptr_ + 1) & 0x7F;
+    }
+    return 0;
+}
+
+int Lsm6dslMock::read(int address, char *data, int length, bool) {
+    ++transactions_;
+    if ((address >> 1) != addr7_) return -1;
+
+    for (int i = 0; i < length; i++) {
+        data[i] = (char)readReg(ptr_);
+        if (!(regs_[CTRL3_C] & CTRL3_C_IF_INC)) continue;
+        // FIFO 输出寄存器读完高字节后回到低字节，可连续突发读取
+        ptr_ = (ptr_ == FIFO_DATA_OUT_H) ? FIFO_DATA_OUT_L : ((ptr_ + 1) & 0x7F);
+    }
+    return 0;
+}
+
+/*********** 寄存器访问 ***********/
+void Lsm6dslMock::writeReg(uint8_t r, uint8_t v) {
+    if (r == WHO_AM_I || (r >= STATUS_REG && r <= FIFO_DATA_OUT_H)) return;  // 只读
+    regs_[r] = v;
+    // 进入 bypass 模式时清空 FIFO
+    if (r == FIFO_CTRL5 && (v & 0x07) == FIFO_MODE_BYPASS) {
+        fifo_head_ = fifo_count_ = 0;
+        pattern_ = 0;
+        overrun_ = false;
+    }
+}
+
+uint8_t Lsm6dslMock::readReg(uint8_t r) {
+    switch (r) {
+    case FIFO_STATUS1:
+        return diffWords() & 0xFF;
+    case FIFO_STATUS2: {
+        uint8_t v = (diffWords() >> 8) & FIFO_STATUS2_DIFF_HI;
+        if (fifo_count_ == 0) v |= FIFO_STATUS2_EMPTY;
+        if (fifoThreshold() && fifo_count_ >= fifoThreshold()) v |= FIFO_STATUS2_WTM;
+        if (overrun_) v |= FIFO_STATUS2_OVER;
+        return v;
+    }
+    case FIFO_STATUS3:
+        return pattern_ & 0xFF;
+    case FIFO_STATUS4:
+        return (pattern_ >> 8) & 0x03;
+    case FIFO_DATA_OUT_L:
+        // 锁存队首的字；FIFO 为空时读出 0
+        out_word_ = fifo_count_ ? fifo_[fifo_head_] : 0;
+        return out_word_ & 0xFF;
+    case FIFO_DATA_OUT_H:
+        // 读完高字节后出队
+        if (fifo_count_) {
+            fifo_head_ = (fifo_head_ + 1) % FIFO_CAPACITY_WORDS;
+            --fifo_count_;
+            pattern_ = (pattern_ + 1) % FIFO_FRAME_WORDS;
+            overrun_ = false;
+        }
+        return out_word_ >> 8;
+    default:
+        break;
+    }
+    if (r >= OUT_G_L && r < OUT_XL_L + 6) {
+        const uint8_t v = regs_[r];
+        const int axis = (r - OUT_G_L) >> 1;
+        regs_[STATUS_REG] &= axis < 3 ? ~STATUS_GDA : ~STATUS_XLDA;
+        if (regs_[CTRL3_C] & CTRL3_C_BDU) {
+            bdu_read_[axis] |= 1 << ((r - OUT_G_L) & 1);
+            if (bdu_read_[axis] == 3) {
+                bdu_read_[axis] = 0;
+                if (bdu_pending_ & (1 << axis)) {
+                    bdu_pending_ &= ~(1 << axis);
+                    regs_[OUT_G_L + 2 * axis] = bdu_value_[axis] & 0xFF;
+                    regs_[OUT_G_L + 2 * axis + 1] = (bdu_value_[axis] >> 8) & 0xFF;
+                }
+            }
+        }
+        return v;
+    }
+    return regs_[r & 0x7F];
+}
+
+/*********** FIFO ***********/
+// DIFF_FIFO 只有 11 位，FIFO 满时饱和为 2047
+uint16_t Lsm6dslMock::diffWords() const {
+    return fifo_count_ > 0x7FF ? 0x7FF : (uint16_t)fifo_count_;
+}
+
+bool Lsm6dslMock::fifoEnabled() const {
+    uint8_t c5 = regs_[FIFO_CTRL5];
+    return (c5 & 0x07) == FIFO_MODE_CONTINUOUS && (c5 & 0x78) != 0;
+}
+
+uint16_t Lsm6dslMock::fifoThreshold() const {
+    return regs_[FIFO_CTRL1] | ((regs_[FIFO_CTRL2] & 0x07) << 8);
+}
+
+void Lsm6dslMock::fifoPush(int16_t w) {
+    if (fifo_count_ == FIFO_CAPACITY_WORDS) {
+        // 连续模式：覆盖最旧的数据
+        fifo_head_ = (fifo_head_ + 1) % FIFO_CAPACITY_WORDS;
+        --fifo_count_;
+        pattern_ = (pattern_ + 1) % FIFO_FRAME_WORDS;
+        overrun_ = true;
+        ++fifo_dropped_;
+    }
+    fifo_[(fifo_head_ + fifo_count_) % FIFO_CAPACITY_WORDS] = (uint16_t)w;
+    ++fifo_count_;
+}
+
+// 输出寄存器：OUT_G (0x22..0x27) 与 OUT_XL (0x28..0x2D)，每轴两个字节
+void Lsm6dslMock::setOutput(int axis, int16_t v) {
+    if ((regs_[CTRL3_C] & CTRL3_C_BDU) && bdu_read_[axis]) {
+        bdu_value_[axis] = v;
+        bdu_pending_ |= 1 << axis;
+        return;
+    }
+    regs_[OUT_G_L + 2 * axis] = v & 0xFF;
+    regs_[OUT_G_L + 2 * axis + 1] = (v >> 8) & 0xFF;
+}
+
+void Lsm6dslMock::pushSample(const ImuFrame &f) {
+    for (int i = 0; i < 3; i++) {
+        setOutput(i, f.gyr[i]);
+        setOutput(3 + i, f.acc[i]);
+    }
+    regs_[STATUS_REG] |= STATUS_GDA | STATUS_XLDA;
+
+    if (!fifoEnabled()) return;
+    for (int i = 0; i < 3; i++) fifoPush(f.gyr[i]);
+    for (int i = 0; i < 3; i++) fifoPush(f.acc[i]);
+}
+
+bool Lsm6dslMock::int1() const {
+    const uint8_t route = regs_[INT1_CTRL];
+    const uint8_t status = regs_[STATUS_REG];
+    if ((route & INT1_DRDY_XL) && (status & STATUS_XLDA)) return true;
+    if ((route & INT1_DRDY_G) && (status & STATUS_GDA)) return true;
+    uint16_t fth = fifoThreshold();
+    return (route & INT1_FTH) && fth && fifo_count_ >= fth;
+}
+
+/*********** 量程与量化 ***********/
+float Lsm6dslMock::accLsbG() const {
+    static const float LSB[4] = {0.061e-3f, 0.488e-3f, 0.122e-3f, 0.244e-3f};  // ±2/16/4/8 g
+    return LSB[(regs_[CTRL1_XL] & CTRL1_XL_FS_MASK) >> 2];
+}
+
+float Lsm6dslMock::gyrLsbDps() const {
+    static const float LSB[4] = {8.75e-3f, 17.5e-3f, 35e-3f, 70e-3f};  // 245/500/1000/2000 dps
+    if (regs_[CTRL2_G] & CTRL2_G_FS_125) return 4.375e-3f;
+    return LSB[(regs_[CTRL2_G] & CTRL2_G_FS_MASK) >> 2];
+}
+
+// 超出量程时饱和到 int16 边界，与实际器件一致
+static int16_t saturate(float counts) {
+    if (counts >= 32767.0f) return 32767;
+    if (counts <= -32768.0f) return -32768;
+    return (int16_t)lrintf(counts);
+}
+
+ImuFrame Lsm6dslMock::quantize(const MotionSample &m) const {
+    const float ka = 1.0f / accLsbG(), kg = 1.0f / gyrLsbDps();
+    ImuFrame f;
+    for (int i = 0; i < 3; i++) {
+        f.acc[i] = saturate(m.acc[i] * ka);
+        f.gyr[i] = saturate(m.gyr[i] * kg);
+    }
+    return f;
+}
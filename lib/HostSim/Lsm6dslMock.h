@@ -0,0 +1,67 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "ImuFrame.h"
+#include "Lsm6dslRegs.h"
+#include "MotionSource.h"
+
+/*************************************
+ *  LSM6DSL 寄存器级模拟（主机端）     *
+ *  提供与 mbed::I2C 相同的 write/read *
+ *  接口，可直接作为 Lsm6dsl<Bus> 的总线 *
+ *************************************/
+// 已模拟：WHO_AM_I；CTRL3_C 的 IF_INC（突发读写地址自增）与 BDU（读完一个轴的高低字节前
+// 不更新该轴输出）；STATUS_REG 的 XLDA/GDA（读对应输出寄存器后清除）；CTRL1_XL/CTRL2_G
+// 的量程（pushMotion 按量程量化并饱和）；连续模式 FIFO、水位与 DRDY 路由到 INT1。
+// ODR 不影响本类，由调用方按 CTRL1_XL 决定何时产生样本（见 MbedSim/SimBoard）
+class Lsm6dslMock {
+public:
+    explicit Lsm6dslMock(int addr7 = 0x6A);
+
+    /*********** mbed::I2C 兼容接口（返回 0 表示 ACK） ***********/
+    void frequency(int) {}
+    int write(int address, const char *data, int length, bool repeated = false);
+    int read(int address, char *data, int length, bool repeated = false);
+
+    /*********** 仿真侧接口 ***********/
+    // 产生一个新样本：更新输出寄存器，FIFO 使能时按 Gx..XLz 顺序入队
+    void pushSample(const ImuFrame &f);
+    // 物理量样本按当前量程量化（饱和到 ±满量程）后产生
+    void pushMotion(const MotionSample &m) { pushSample(quantize(m)); }
+    ImuFrame quantize(const MotionSample &m) const;
+    float accLsbG() const;    // 当前量程的灵敏度（g/LSB）
+    float gyrLsbDps() const;  // （dps/LSB）
+
+    bool int1() const;                      // INT1 引脚电平
+    size_t fifoWords() const { return fifo_count_; }
+    uint8_t reg(uint8_t r) const { return regs_[r & 0x7F]; }
+    uint32_t transactions() const { return transactions_; }
+    uint32_t fifoDropped() const { return fifo_dropped_; }  // 溢出时被覆盖的字数
+
+protected:
+    uint8_t readReg(uint8_t r);  // 带副作用的寄存器读（FIFO 出队等）
+    void writeReg(uint8_t r, uint8_t v);
+    bool fifoEnabled() const;
+    uint16_t fifoThreshold() const;
+    uint16_t diffWords() const;
+    void fifoPush(int16_t w);
+    void setOutput(int axis, int16_t v);  // axis: 0..2 陀螺，3..5 加速度计
+
+    int addr7_;
+    uint8_t regs_[128];
+    uint8_t ptr_;  // 当前寄存器地址指针
+    uint32_t transactions_;
+
+    // FIFO：按 16 位字存储的环形缓冲
+    uint16_t fifo_[FIFO_CAPACITY_WORDS];
+    size_t fifo_head_, fifo_count_;
+    uint16_t pattern_;   // 下一个读出字在数据组内的序号
+    uint16_t out_word_;  // 读 FIFO_DATA_OUT_L 时锁存的字
+    bool overrun_;
+    uint32_t fifo_dropped_;
+
+    // BDU：已读过一个字节的轴被锁定，期间的新值暂存，两个字节都读完后生效
+    uint8_t bdu_read_[6];  // bit0 低字节已读，bit1 高字节已读
+    uint8_t bdu_pending_;  // 有暂存值的轴
+    int16_t bdu_value_[6];
+};
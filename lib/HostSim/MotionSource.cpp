@@ -0,0 +1,185 @@
+#include "MotionSource.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********** 轨迹回放 ***********/
+TraceMotion::TraceMotion(const std::vector<ImuFrame> &frames, bool loop, float accLsbG,
+                         float gyrLsbDps)
+    : frames_(frames), next_(0), loop_(loop), acc_lsb_(accLsbG), gyr_lsb_(gyrLsbDps) {}
+
+size_t TraceMotion::generate(MotionSample *out, size_t n, double) {
+    size_t k = 0;
+    while (k < n) {
+        if (next_ == frames_.size()) {
+            if (!loop_ || frames_.empty()) break;
+            next_ = 0;
+        }
+        const ImuFrame &f = frames_[next_++];
+        for (int i = 0; i < 3; i++) {
+            out[k].acc[i] = f.acc[i] * acc_lsb_;
+            out[k].gyr[i] = f.gyr[i] * gyr_lsb_;
+        }
+        ++k;
+    }
+    return k;
+}
+
+/*********** 合成震颤 ***********/
+TremorParams::TremorParams()
+    : gravity{0, 0, 1}, accNoise(0), gyrNoise(0), accDrift(0), gyrDrift(0), seed(1) {}
+
+// "a:b:c" → 3 个浮点数
+static bool parseVec3(const char *s, float v[3]) {
+    char *end;
+    for (int i = 0; i < 3; i++) {
+        v[i] = strtof(s, &end);
+        if (end == s || (i < 2 && *end != ':')) return false;
+        s = end + 1;
+    }
+    return *end == '\0' || *end == ',';
+}
+
+bool parseTremorSpec(const char *spec, TremorParams &p) {
+    const char *s = spec;
+    while (*s) {
+        const char *eq = strchr(s, '=');
+        if (!eq) return false;
+        const size_t klen = eq - s;
+        const char *v = eq + 1;
+        char *end;
+        auto key = [&](const char *k) { return strlen(k) == klen && !strncmp(s, k, klen); };
+        TremorComponent *c = p.components.empty() ? nullptr : &p.components.back();
+        if (key("f")) {
+            TremorComponent n = {strtof(v, &end), 0, 0, {1, 0, 0}};
+            p.components.push_back(n);
+        } else if (key("axis") || key("g")) {
+            float vec[3];
+            if (!parseVec3(v, vec) || (key("axis") && !c)) return false;
+            memcpy(key("g") ? p.gravity : c->axis, vec, sizeof(vec));
+            end = (char *)v + strcspn(v, ",");
+        } else {
+            const float x = strtof(v, &end);
+            if (key("acc") && c) c->accG = x;
+            else if (key("gyr") && c) c->gyrDps = x;
+            else if (key("noise")) p.accNoise = x;
+            else if (key("gnoise")) p.gyrNoise = x;
+            else if (key("drift")) p.accDrift = x;
+            else if (key("gdrift")) p.gyrDrift = x;
+            else if (key("seed")) p.seed = (uint32_t)x;
+            else return false;
+        }
+        if (end == v || (*end != ',' && *end != '\0')) return false;
+        s = *end ? end + 1 : end;
+    }
+    return true;
+}
+
+// 标准正态分布的分位数表：以均匀随机数查表，每样本只需一次移位与访存
+static const int GAUSS_BITS = 12;
+static float gaussTable[1 << GAUSS_BITS];
+
+static void buildGaussTable() {
+    if (gaussTable[(1 << GAUSS_BITS) - 1] != 0) return;
+    const int n = 1 << GAUSS_BITS;
+    double sumSq = 0;
+    for (int i = 0; i < n; i++) {
+        // 二分求解 Φ(x) = (i + 0.5) / n
+        const double q = (i + 0.5) / n;
+        double lo = -8, hi = 8;
+        for (int it = 0; it < 60; it++) {
+            const double mid = 0.5 * (lo + hi);
+            if (0.5 * erfc(-mid / sqrt(2.0)) < q) lo = mid;
+            else hi = mid;
+        }
+        gaussTable[i] = (float)(0.5 * (lo + hi));
+        sumSq += gaussTable[i] * (double)gaussTable[i];
+    }
+    // 截断的尾部使方差略小于 1，整体放大补偿
+    const float k = (float)(1.0 / sqrt(sumSq / n));
+    for (int i = 0; i < n; i++) gaussTable[i] *= k;
+}
+
+TremorMotion::TremorMotion(const TremorParams &p)
+    : p_(p), rng_(p.seed * 0x9E3779B97F4A7C15ull + 1), renorm_(0) {
+    buildGaussTable();
+    for (int i = 0; i < 3; i++) acc_bias_[i] = gyr_bias_[i] = 0;
+    for (const TremorComponent &c : p_.components) {
+        Osc o;
+        o.c = 1;
+        o.s = 0;
+        o.stepC = 1;
+        o.stepS = 0;
+        o.dt = 0;
+        o.freqHz = c.freqHz;
+        for (int i = 0; i < 3; i++) {
+            o.acc[i] = c.accG * c.axis[i];
+            o.gyr[i] = c.gyrDps * c.axis[i];
+        }
+        osc_.push_back(o);
+    }
+}
+
+// xorshift64*
+float TremorMotion::gauss() {
+    rng_ ^= rng_ >> 12;
+    rng_ ^= rng_ << 25;
+    rng_ ^= rng_ >> 27;
+    return gaussTable[(rng_ * 0x2545F4914F6CDD1Dull) >> (64 - GAUSS_BITS)];
+}
+
+size_t TremorMotion::generate(MotionSample *out, size_t n, double dt) {
+    const float accWalk = p_.accDrift * (float)sqrt(dt);
+    const float gyrWalk = p_.gyrDrift * (float)sqrt(dt);
+    const bool noisy = p_.accNoise > 0 || p_.gyrNoise > 0;
+    const bool drifting = p_.accDrift > 0 || p_.gyrDrift > 0;
+    for (Osc &o : osc_) {
+        if (o.dt != dt) {
+            o.dt = dt;
+            o.stepC = cos(2 * M_PI * o.freqHz * dt);
+            o.stepS = sin(2 * M_PI * o.freqHz * dt);
+        }
+    }
+
+    for (size_t k = 0; k < n; k++) {
+        MotionSample &m = out[k];
+        for (int i = 0; i < 3; i++) {
+            m.acc[i] = p_.gravity[i] + acc_bias_[i];
+            m.gyr[i] = gyr_bias_[i];
+        }
+        for (Osc &o : osc_) {
+            const float s = (float)o.s, c = (float)o.c;
+            for (int i = 0; i < 3; i++) {
+                m.acc[i] += o.acc[i] * s;
+                m.gyr[i] += o.gyr[i] * c;
+            }
+            const double nc = o.c * o.stepC - o.s * o.stepS;
+            o.s = o.s * o.stepC + o.c * o.stepS;
+            o.c = nc;
+        }
+        if (noisy) {
+            for (int i = 0; i < 3; i++) {
+                m.acc[i] += p_.accNoise * gauss();
+                m.gyr[i] += p_.gyrNoise * gauss();
+            }
+        }
+        if (drifting) {
+            for (int i = 0; i < 3; i++) {
+                acc_bias_[i] += accWalk * gauss();
+                gyr_bias_[i] += gyrWalk * gauss();
+            }
+        }
+    }
+
+    // 相量递推的幅度误差会累积，定期归一化
+    renorm_ += (uint32_t)n;
+    if (renorm_ >= 4096) {
+        renorm_ = 0;
+        for (Osc &o : osc_) {
+            const double r = 1.0 / sqrt(o.c * o.c + o.s * o.s);
+            o.c *= r;
+            o.s *= r;
+        }
+    }
+    return n;
+}
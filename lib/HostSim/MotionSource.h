@@ -0,0 +1,90 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "ImuFrame.h"
+
+/*************************************
+ *  运动源（主机端）                  *
+ *  为 LSM6DSL 模拟器提供物理量样本：  *
+ *  回放录制轨迹，或合成震颤信号       *
+ *************************************/
+
+// 物理量样本：加速度 g，角速度 dps（传感器坐标系）
+struct MotionSample {
+    float acc[3];
+    float gyr[3];
+};
+
+class MotionSource {
+public:
+    virtual ~MotionSource() {}
+    // 以采样间隔 dt 秒生成最多 n 个样本，返回实际数量；0 表示结束
+    virtual size_t generate(MotionSample *out, size_t n, double dt) = 0;
+};
+
+/*********** 轨迹回放 ***********/
+// 轨迹为原始计数，按录制时的灵敏度换回物理量（默认 ±2 g / 245 dps，与固件配置一致），
+// 同量程下经模拟器再量化可逐位还原
+class TraceMotion : public MotionSource {
+public:
+    TraceMotion(const std::vector<ImuFrame> &frames, bool loop,
+                float accLsbG = 0.061e-3f, float gyrLsbDps = 8.75e-3f);
+    size_t generate(MotionSample *out, size_t n, double dt) override;
+
+private:
+    const std::vector<ImuFrame> &frames_;
+    size_t next_;
+    bool loop_;
+    float acc_lsb_, gyr_lsb_;
+};
+
+/*********** 合成震颤 ***********/
+// 每个分量：加速度与角速度在 axis 方向上以 freqHz 正弦振荡（角速度超前 90°）。
+// 另叠加重力、白噪声与随机游走的零偏漂移；量程饱和由模拟器按 FS 设置完成
+struct TremorComponent {
+    float freqHz;
+    float accG;      // 加速度幅度（g）
+    float gyrDps;    // 角速度幅度（dps）
+    float axis[3];   // 各轴分配（不要求归一化）
+};
+
+struct TremorParams {
+    std::vector<TremorComponent> components;
+    float gravity[3];    // 重力在传感器坐标系中的分量（g）
+    float accNoise;      // 加速度白噪声 RMS（g）
+    float gyrNoise;      // 角速度白噪声 RMS（dps）
+    float accDrift;      // 加速度零偏随机游走（g/√s）
+    float gyrDrift;      // 角速度零偏随机游走（dps/√s）
+    uint32_t seed;
+
+    TremorParams();
+};
+
+// 解析 "f=5,acc=0.05,gyr=20,axis=1:0.5:0,noise=0.002,gnoise=0.3,drift=1e-4,gdrift=0.01,seed=7"。
+// 每个 f= 开始一个新分量，其后的 acc / gyr / axis 作用于该分量；
+// g=x:y:z 设置重力方向。失败返回 false
+bool parseTremorSpec(const char *spec, TremorParams &p);
+
+class TremorMotion : public MotionSource {
+public:
+    explicit TremorMotion(const TremorParams &p);
+    size_t generate(MotionSample *out, size_t n, double dt) override;
+
+private:
+    float gauss();
+
+    struct Osc {
+        double c, s;        // 当前相位的 cos / sin（相量递推，避免逐样本调用 sin）
+        double stepC, stepS;
+        double dt;          // 相量步长对应的采样间隔
+        float acc[3], gyr[3];
+        float freqHz;
+    };
+
+    TremorParams p_;
+    std::vector<Osc> osc_;
+    float acc_bias_[3], gyr_bias_[3];
+    uint64_t rng_;
+    uint32_t renorm_;
+};
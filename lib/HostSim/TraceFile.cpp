@@ -0,0 +1,48 @@
+#include "TraceFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 解析一行，成功返回 true
+static bool parseLine(const char *line, ImuFrame &f) {
+    while (*line == ' ' || *line == '\t') line++;
+    if (strncmp(line, "RAW", 3) == 0) line += 3;
+
+    long v[6];
+    char *end;
+    for (int i = 0; i < 6; i++) {
+        v[i] = strtol(line, &end, 10);
+        if (end == line || v[i] < -32768 || v[i] > 32767) return false;
+        line = end;
+    }
+    for (int i = 0; i < 3; i++) {
+        f.acc[i] = (int16_t)v[i];
+        f.gyr[i] = (int16_t)v[3 + i];
+    }
+    return true;
+}
+
+bool loadTrace(const char *path, std::vector<ImuFrame> &out) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return false;
+
+    char line[256];
+    ImuFrame f;
+    while (fgets(line, sizeof(line), fp)) {
+        if (parseLine(line, f)) out.push_back(f);
+    }
+    fclose(fp);
+    return true;
+}
+
+bool saveTrace(const char *path, const ImuFrame *frames, size_t count) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) return false;
+
+    for (size_t i = 0; i < count; i++) {
+        const ImuFrame &f = frames[i];
+        fprintf(fp, "%d %d %d %d %d %d\n",
+                f.acc[0], f.acc[1], f.acc[2], f.gyr[0], f.gyr[1], f.gyr[2]);
+    }
+    return fclose(fp) == 0;
+}
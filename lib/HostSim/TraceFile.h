@@ -0,0 +1,16 @@
+#pragma once
+#include <stddef.h>
+#include <vector>
+#include "ImuFrame.h"
+
+/*************************************
+ *  采样轨迹文件（主机端）            *
+ *************************************/
+// 文本格式：每行 6 个整数 "ax ay az gx gy gz"，
+// 也接受串口日志中的 "RAW ax ay az gx gy gz" 行；其它行忽略。
+
+// 读取整个轨迹文件，失败返回 false
+bool loadTrace(const char *path, std::vector<ImuFrame> &out);
+
+// 以文本格式写出轨迹，失败返回 false
+bool saveTrace(const char *path, const ImuFrame *frames, size_t count);
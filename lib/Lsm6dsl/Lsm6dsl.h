@@ -0,0 +1,131 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <initializer_list>
+#include "ImuFrame.h"
+#include "Lsm6dslRegs.h"
+
+/*************************************
+ *  LSM6DSL I²C 驱动                  *
+ *  Bus 为 mbed::I2C 或具有相同        *
+ *  write/read 接口的主机端模拟器       *
+ *************************************/
+template <class Bus>
+class Lsm6dsl {
+public:
+    explicit Lsm6dsl(Bus &bus) : bus_(bus), addr_(0), overruns_(0) {}
+
+    // 自动检测传感器地址（0x6A / 0x6B），找到返回 true
+    bool probe() {
+        for (int addr : {0x6A, 0x6B}) {
+            addr_ = addr << 1;
+            if (r8(WHO_AM_I) == LSM6DSL_ID) return true;
+        }
+        return false;
+    }
+    int address() const { return addr_ >> 1; }
+
+    /*********** 寄存器访问 ***********/
+    // 写入一个字节到指定寄存器
+    void w8(uint8_t reg, uint8_t val) {
+        char b[2] = { (char)reg, (char)val };
+        bus_.write(addr_, b, 2);
+    }
+
+    // 从指定寄存器读取一个字节
+    uint8_t r8(uint8_t reg) {
+        uint8_t v = 0;
+        bus_.write(addr_, (char *)&reg, 1, true);
+        bus_.read(addr_, (char *)&v, 1);
+        return v;
+    }
+
+    // 从指定寄存器开始连续读取 len 个字节（需要 IF_INC=1），成功返回 0
+    int rN(uint8_t reg, uint8_t *dst, int len) {
+        if (bus_.write(addr_, (char *)&reg, 1, true) != 0) return -1;
+        return bus_.read(addr_, (char *)dst, len);
+    }
+
+    // 逐样本读取：加速度计、陀螺仪各一次事务
+    bool readFrame(ImuFrame &f) {
+        uint8_t data[6];
+
+        // 读取加速度计数据
+        if (rN(OUT_XL_L, data, 6) != 0) return false;
+        f.acc[0] = le16(data + 0);
+        f.acc[1] = le16(data + 2);
+        f.acc[2] = le16(data + 4);
+
+        // 读取陀螺仪数据
+        if (rN(OUT_G_L, data, 6) != 0) return false;
+        f.gyr[0] = le16(data + 0);
+        f.gyr[1] = le16(data + 2);
+        f.gyr[2] = le16(data + 4);
+        return true;
+    }
+
+    /*********** FIFO 批量采集 ***********/
+    // 连续模式、104Hz、陀螺 + 加速度计不抽取，水位中断输出到 INT1
+    void enableFifo(uint16_t watermarkFrames) {
+        uint16_t fth = watermarkFrames * FIFO_FRAME_WORDS;
+        if (fth > FIFO_CAPACITY_WORDS - FIFO_FRAME_WORDS) {
+            fth = FIFO_CAPACITY_WORDS - FIFO_FRAME_WORDS;
+        }
+        w8(FIFO_CTRL5, FIFO_MODE_BYPASS);  // 先进入 bypass 清空 FIFO
+        w8(FIFO_CTRL1, fth & 0xFF);
+        w8(FIFO_CTRL2, (fth >> 8) & 0x07);
+        w8(FIFO_CTRL3, FIFO_DEC_NONE_G_XL);
+        w8(FIFO_CTRL4, 0x00);
+        w8(INT1_CTRL, INT1_FTH);
+        w8(FIFO_CTRL5, FIFO_ODR_104HZ | FIFO_MODE_CONTINUOUS);
+    }
+
+    // 读出 FIFO 中所有完整的数据组：一次状态读取 + 一次自增突发读取
+    // 返回写入 out 的帧数
+    size_t readFifo(ImuFrame *out, size_t maxFrames) {
+        uint8_t st[4];
+        if (rN(FIFO_STATUS1, st, 4) != 0) return 0;
+        if (st[1] & FIFO_STATUS2_OVER) ++overruns_;
+        if (st[1] & FIFO_STATUS2_EMPTY) return 0;
+
+        size_t words = st[0] | ((st[1] & FIFO_STATUS2_DIFF_HI) << 8);
+        uint16_t pattern = st[2] | ((st[3] & 0x03) << 8);
+
+        // 未对齐到数据组起点（启动或溢出后）：丢弃残缺的一组
+        if (pattern != 0) {
+            size_t skip = FIFO_FRAME_WORDS - pattern;
+            if (skip > words) return 0;
+            uint8_t junk[2 * FIFO_FRAME_WORDS];
+            if (rN(FIFO_DATA_OUT_L, junk, 2 * skip) != 0) return 0;
+            words -= skip;
+        }
+
+        size_t n = words / FIFO_FRAME_WORDS;
+        if (n > maxFrames) n = maxFrames;
+        if (n == 0) return 0;
+
+        // FIFO_DATA_OUT_H 之后地址自动回到 FIFO_DATA_OUT_L，
+        // 因此整块数据可以一次突发读出，直接落在 out 的内存中
+        uint8_t *raw = (uint8_t *)out;
+        if (rN(FIFO_DATA_OUT_L, raw, (int)(n * sizeof(ImuFrame))) != 0) return 0;
+
+        // 每组顺序为 Gx Gy Gz XLx XLy XLz，原地转换为 ImuFrame
+        for (size_t i = 0; i < n; i++) {
+            const uint8_t *w = raw + i * sizeof(ImuFrame);
+            int16_t g0 = le16(w + 0), g1 = le16(w + 2), g2 = le16(w + 4);
+            int16_t a0 = le16(w + 6), a1 = le16(w + 8), a2 = le16(w + 10);
+            out[i].acc[0] = a0; out[i].acc[1] = a1; out[i].acc[2] = a2;
+            out[i].gyr[0] = g0; out[i].gyr[1] = g1; out[i].gyr[2] = g2;
+        }
+        return n;
+    }
+
+    uint32_t fifoOverruns() const { return overruns_; }
+
+private:
+    static int16_t le16(const uint8_t *p) { return (int16_t)(p[0] | (p[1] << 8)); }
+
+    Bus &bus_;
+    int addr_;  // 8 位地址（7 位地址左移一位）
+    uint32_t overruns_;
+};
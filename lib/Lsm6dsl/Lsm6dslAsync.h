@@ -0,0 +1,126 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "ImuFrame.h"
+#include "Lsm6dslRegs.h"
+
+/*********** mbed I2C 异步事件（与 hal/i2c_api.h 一致） ***********/
+#ifndef I2C_EVENT_ERROR
+#define I2C_EVENT_ERROR               (1 << 1)
+#define I2C_EVENT_ERROR_NO_SLAVE      (1 << 2)
+#define I2C_EVENT_TRANSFER_COMPLETE   (1 << 3)
+#define I2C_EVENT_TRANSFER_EARLY_NACK (1 << 4)
+#define I2C_EVENT_ALL (I2C_EVENT_ERROR | I2C_EVENT_TRANSFER_COMPLETE | \
+                       I2C_EVENT_ERROR_NO_SLAVE | I2C_EVENT_TRANSFER_EARLY_NACK)
+#endif
+
+/*************************************
+ *  LSM6DSL 异步 (DMA) 采集           *
+ *  每个采样节拍发起一次 12 字节突发读  *
+ *  (OUT_G_L..OUT_XL_H)，完成回调把帧  *
+ *  写入乒乓缓冲，整块交给分析线程      *
+ *************************************/
+// Bus      : mbed::I2C 或主机端 FakeAsyncI2C
+// Callback : Bus::transfer 使用的回调类型（mbed 中为 event_callback_t）
+template <class Bus, class Callback, size_t BlockFrames>
+class Lsm6dslAsyncReader {
+public:
+    explicit Lsm6dslAsyncReader(Bus &bus)
+        : bus_(bus), addr_(0), active_(0), fill_(0), busy_(false),
+          missed_(0), errors_(0), overruns_(0), blocks_done_(0) {
+        state_[0] = FILLING;
+        state_[1] = FREE;
+    }
+
+    void begin(int addr7) { addr_ = addr7 << 1; }
+
+    /*********** 生产者：采样节拍 ***********/
+    // 在采样线程中每个节拍调用一次；上一次传输未完成时记为丢失
+    void kick() {
+        if (busy_.exchange(true)) {
+            ++missed_;
+            return;
+        }
+        tx_reg_ = (char)OUT_G_L;
+        if (bus_.transfer(addr_, &tx_reg_, 1, rx_, sizeof(rx_),
+                          Callback(this, &Lsm6dslAsyncReader::onTransfer),
+                          I2C_EVENT_ALL) != 0) {
+            busy_ = false;
+            ++errors_;
+        }
+    }
+
+    /*********** 消费者：分析线程 ***********/
+    // 取得一个已写满的数据块，没有时返回 nullptr
+    const ImuFrame *acquire() {
+        for (int i = 0; i < 2; i++) {
+            uint8_t expect = READY;
+            if (state_[i].compare_exchange_strong(expect, READING)) {
+                reading_ = i;
+                return blocks_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // 处理完毕后归还数据块
+    void release() { state_[reading_] = FREE; }
+
+    static constexpr size_t blockFrames() { return BlockFrames; }
+    uint32_t missed() const { return missed_; }      // 传输未完成而跳过的节拍
+    uint32_t errors() const { return errors_; }      // NACK/总线错误
+    uint32_t overruns() const { return overruns_; }  // 分析未及时归还而丢弃的块
+    uint32_t blocks() const { return blocks_done_; }
+
+private:
+    enum : uint8_t { FREE, FILLING, READY, READING };
+
+    // 传输完成回调（中断上下文）
+    void onTransfer(int event) {
+        if (event & I2C_EVENT_TRANSFER_COMPLETE) {
+            // 突发读顺序为 Gx Gy Gz XLx XLy XLz
+            ImuFrame &f = blocks_[active_][fill_];
+            for (int i = 0; i < 3; i++) {
+                f.gyr[i] = le16(rx_ + 2 * i);
+                f.acc[i] = le16(rx_ + 6 + 2 * i);
+            }
+            if (++fill_ == BlockFrames) publish();
+        } else {
+            ++errors_;
+        }
+        busy_ = false;
+    }
+
+    // 当前块写满：另一块空闲则交给消费者并切换，否则丢弃当前块重新写
+    void publish() {
+        uint8_t other = active_ ^ 1;
+        fill_ = 0;
+        if (state_[other] != FREE) {
+            ++overruns_;
+            return;
+        }
+        state_[active_] = READY;
+        state_[other] = FILLING;
+        active_ = other;
+        ++blocks_done_;
+    }
+
+    static int16_t le16(const char *p) {
+        return (int16_t)((uint8_t)p[0] | ((uint8_t)p[1] << 8));
+    }
+
+    Bus &bus_;
+    int addr_;
+    char tx_reg_;
+    char rx_[12];
+
+    ImuFrame blocks_[2][BlockFrames];
+    std::atomic<uint8_t> state_[2];
+    uint8_t active_;   // 生产者正在写的块
+    size_t fill_;      // 生产者写入位置
+    int reading_ = 0;  // 消费者持有的块
+    std::atomic<bool> busy_;
+
+    volatile uint32_t missed_, errors_, overruns_, blocks_done_;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <stdint.h>
+
+/*********** LSM6DSL 寄存器地址定义 ***********/
+constexpr uint8_t FIFO_CTRL1      = 0x06;  // FIFO 水位阈值 FTH[7:0]
+constexpr uint8_t FIFO_CTRL2      = 0x07;  // FIFO 水位阈值 FTH[10:8]
+constexpr uint8_t FIFO_CTRL3      = 0x08;  // 陀螺/加速度计 FIFO 抽取系数
+constexpr uint8_t FIFO_CTRL4      = 0x09;  // 第三/四数据集抽取系数
+constexpr uint8_t FIFO_CTRL5      = 0x0A;  // FIFO ODR 与工作模式
+constexpr uint8_t INT1_CTRL       = 0x0D;  // INT1 中断路由
+constexpr uint8_t WHO_AM_I        = 0x0F;  // 器件ID寄存器
+constexpr uint8_t CTRL1_XL        = 0x10;  // 加速度计控制寄存器
+constexpr uint8_t CTRL2_G         = 0x11;  // 陀螺仪控制寄存器
+constexpr uint8_t CTRL3_C         = 0x12;  // 通用控制寄存器
+constexpr uint8_t STATUS_REG      = 0x1E;  // 数据就绪状态
+constexpr uint8_t OUT_G_L         = 0x22;  // 陀螺仪数据输出寄存器（低字节）
+constexpr uint8_t OUT_XL_L        = 0x28;  // 加速度计数据输出寄存器（低字节）
+constexpr uint8_t FIFO_STATUS1    = 0x3A;  // DIFF_FIFO[7:0]：未读字数
+constexpr uint8_t FIFO_STATUS2    = 0x3B;  // 水位/溢出/空标志 + DIFF_FIFO[10:8]
+constexpr uint8_t FIFO_STATUS3    = 0x3C;  // FIFO_PATTERN[7:0]：下一个要读出的字
+constexpr uint8_t FIFO_STATUS4    = 0x3D;  // FIFO_PATTERN[9:8]
+constexpr uint8_t FIFO_DATA_OUT_L = 0x3E;  // FIFO 数据输出（低字节）
+constexpr uint8_t FIFO_DATA_OUT_H = 0x3F;  // FIFO 数据输出（高字节）
+
+constexpr uint8_t LSM6DSL_ID = 0x6A;  // WHO_AM_I 期望值
+
+/*********** 位定义 ***********/
+constexpr uint8_t CTRL3_C_BDU    = 0x40;  // 块数据更新
+constexpr uint8_t CTRL3_C_IF_INC = 0x04;  // 多字节访问地址自增
+
+constexpr uint8_t INT1_DRDY_XL = 0x01;  // 加速度计数据就绪路由到 INT1
+constexpr uint8_t INT1_DRDY_G  = 0x02;  // 陀螺仪数据就绪路由到 INT1
+constexpr uint8_t INT1_FTH     = 0x08;  // FIFO 水位中断路由到 INT1
+
+constexpr uint8_t STATUS_XLDA = 0x01;  // 加速度计有新数据（读输出寄存器后清除）
+constexpr uint8_t STATUS_GDA  = 0x02;  // 陀螺仪有新数据
+
+constexpr uint8_t CTRL1_XL_FS_MASK = 0x0C;  // FS_XL: 00 ±2g, 01 ±16g, 10 ±4g, 11 ±8g
+constexpr uint8_t CTRL2_G_FS_MASK  = 0x0C;  // FS_G: 00 245, 01 500, 10 1000, 11 2000 dps
+constexpr uint8_t CTRL2_G_FS_125   = 0x02;  // ±125 dps（优先于 FS_G）
+
+constexpr uint8_t FIFO_STATUS2_WTM     = 0x80;  // 达到水位
+constexpr uint8_t FIFO_STATUS2_OVER    = 0x40;  // FIFO 溢出
+constexpr uint8_t FIFO_STATUS2_EMPTY   = 0x10;  // FIFO 为空
+constexpr uint8_t FIFO_STATUS2_DIFF_HI = 0x07;  // DIFF_FIFO[10:8]
+
+constexpr uint8_t FIFO_MODE_BYPASS     = 0x00;
+constexpr uint8_t FIFO_MODE_CONTINUOUS = 0x06;
+constexpr uint8_t FIFO_ODR_104HZ       = 0x04 << 3;  // ODR_FIFO[3:0] = 0100
+constexpr uint8_t FIFO_DEC_NONE_G_XL   = (0x01 << 3) | 0x01;  // 陀螺 + 加速度计均不抽取
+
+constexpr uint16_t FIFO_CAPACITY_WORDS = 2048;  // 4 KB FIFO，按 16 位字计
+constexpr uint8_t  FIFO_FRAME_WORDS    = 6;     // 每组: Gx Gy Gz XLx XLy XLz
@@ -0,0 +1,219 @@
+#include "mbed.h"
+#include "hal/us_ticker_api.h"
+#include "SimBoard.h"
+#include "SimKernel.h"
+
+// main.cpp 中的全局对象可能先于本文件的静态变量构造，因此每次都经 instance() 取得
+static SimBoard &board() { return SimBoard::instance(); }
+static SimKernel &kernel() { return SimKernel::instance(); }
+
+// 即使程序没有构造任何外设对象，也在 main() 之前解析命令行并启动传感器时钟
+static const bool board_ready = (SimBoard::instance(), true);
+
+uint32_t us_ticker_read(void) {
+    kernel().enter();
+    return (uint32_t)kernel().now();
+}
+
+namespace mbed {
+
+/*********** 输出引脚 ***********/
+DigitalOut::DigitalOut(PinName pin, int value) : stat_(board().addPin(pin, false)), value_(value) {
+    stat_->level = value ? 1.0f : 0.0f;
+}
+
+void DigitalOut::write(int value) {
+    kernel().enter();
+    value_ = value;
+    board().setPin(stat_, value ? 1.0f : 0.0f);
+}
+
+PwmOut::PwmOut(PinName pin) : stat_(board().addPin(pin, true)), duty_(0), period_us_(20000) {}
+
+void PwmOut::write(float duty) {
+    kernel().enter();
+    duty_ = duty < 0 ? 0 : (duty > 1 ? 1 : duty);
+    board().setPin(stat_, duty_);
+}
+
+/*********** 输入中断 ***********/
+void InterruptIn::rise(Callback<void()> fn) {
+    board().onRise(pin_, [fn] { fn(); });
+    board().pollInt1();
+}
+
+int InterruptIn::read() {
+    kernel().enter();
+    return board().pinLevel(pin_);
+}
+
+/*********** I²C ***********/
+void I2C::frequency(int hz) { board().setI2cHz(hz); }
+
+int I2C::write(int address, const char *data, int length, bool repeated) {
+    kernel().enter();
+    const int rc = board().sensor().write(address, data, length, repeated);
+    board().noteI2c(length);
+    board().pollInt1();
+    kernel().busy(board().i2cUs(length));
+    return rc;
+}
+
+int I2C::read(int address, char *data, int length, bool repeated) {
+    kernel().enter();
+    const int rc = board().sensor().read(address, data, length, repeated);
+    board().noteI2c(length);
+    board().pollInt1();
+    kernel().busy(board().i2cUs(length));
+    return rc;
+}
+
+// 总线忙时返回 -1，与 mbed 一致；DMA 传输不占用 CPU
+int I2C::transfer(int address, const char *tx, int tx_len, char *rx, int rx_len,
+                  const event_callback_t &callback, int event, bool repeated) {
+    kernel().enter();
+    if (pending_) return -1;
+    pending_ = true;
+
+    int rc = 0;
+    if (tx_len > 0) rc = board().sensor().write(address, tx, tx_len, rx_len > 0);
+    if (rc == 0 && rx_len > 0) rc = board().sensor().read(address, rx, rx_len, repeated);
+    uint64_t us = board().i2cUs(tx_len);
+    board().noteI2c(tx_len);
+    if (rx_len > 0) {
+        us += board().i2cUs(rx_len);
+        board().noteI2c(rx_len);
+    }
+    board().pollInt1();
+
+    const int ev = rc == 0 ? I2C_EVENT_TRANSFER_COMPLETE : I2C_EVENT_ERROR_NO_SLAVE;
+    kernel().at(kernel().now() + us, [this, callback, ev, event] {
+        pending_ = false;
+        if (ev & event) callback(ev);
+    });
+    return 0;
+}
+
+/*********** 串口 ***********/
+UnbufferedSerial::UnbufferedSerial(PinName, PinName, int baud) { board().setBaud(baud); }
+
+ssize_t UnbufferedSerial::write(const void *buffer, size_t length) {
+    kernel().enter();
+    board().uartWrite(buffer, length);
+    return (ssize_t)length;
+}
+
+void UnbufferedSerial::baud(int baud) { board().setBaud(baud); }
+
+/*********** 周期定时器 ***********/
+void Ticker::attach(Callback<void()> fn, std::chrono::microseconds period) {
+    detach();
+    fn_ = fn;
+    period_us_ = period.count() > 0 ? (uint64_t)period.count() : 1;
+    armed_ = true;
+    const uint64_t t = kernel().now() + period_us_;
+    id_ = kernel().at(t, [this, t] { fire(t); });
+}
+
+void Ticker::fire(uint64_t t) {
+    board().noteTick();
+    const uint64_t next = t + period_us_;
+    id_ = kernel().at(next, [this, next] { fire(next); });
+    fn_();
+}
+
+void Ticker::detach() {
+    if (armed_) kernel().cancel(id_);
+    armed_ = false;
+}
+
+}  // namespace mbed
+
+namespace rtos {
+
+/*********** 线程 ***********/
+osStatus Thread::start(mbed::Callback<void()> task) {
+    if (thread_) return -1;
+    const char *name = name_;
+    if (!name) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "thread%zu", kernel().threads().size());
+        name = strdup(buf);
+    }
+    thread_ = kernel().spawn(priority_, name, [task] { task(); });
+    return osOK;
+}
+
+/*********** 事件标志 ***********/
+uint32_t EventFlags::set(uint32_t flags) {
+    kernel().enter();
+    flags_ |= flags;
+    if (waiter_) kernel().wake(waiter_);
+    return flags_;
+}
+
+uint32_t EventFlags::clear(uint32_t flags) {
+    const uint32_t old = flags_;
+    flags_ &= ~flags;
+    return old;
+}
+
+uint32_t EventFlags::wait_any(uint32_t flags, uint32_t millisec, bool clear) {
+    kernel().enter();
+    SimThread *self = kernel().current();
+    bool timedOut = false;
+    uint64_t timer = 0;
+    if (!(flags_ & flags) && millisec != osWaitForever) {
+        timer = kernel().at(kernel().now() + (uint64_t)millisec * 1000, [this, self, &timedOut] {
+            if (waiter_ == self) {
+                timedOut = true;
+                kernel().wake(self);
+            }
+        });
+    }
+    while (!(flags_ & flags) && !timedOut) {
+        waiter_ = self;
+        kernel().block();
+        waiter_ = nullptr;
+    }
+    if (timer && !timedOut) kernel().cancel(timer);
+    if (timedOut) return 0xFFFFFFFEu;  // osFlagsErrorTimeout
+    const uint32_t r = flags_;
+    if (clear) flags_ &= ~flags;
+    return r;
+}
+
+void ThisThread::sleep_for(std::chrono::microseconds rel_time) {
+    kernel().sleep(rel_time.count() > 0 ? (uint64_t)rel_time.count() : 0);
+}
+
+}  // namespace rtos
+
+namespace events {
+
+/*********** 事件队列 ***********/
+int EventQueue::post(mbed::Callback<void()> fn) {
+    if (items_.size() >= capacity_) {
+        board().noteQueueFull();
+        return 0;
+    }
+    items_.push_back({fn, kernel().now()});
+    if (dispatcher_) kernel().wake(dispatcher_);
+    return next_id_++;
+}
+
+void EventQueue::dispatch_forever() {
+    while (true) {
+        while (items_.empty()) {
+            dispatcher_ = kernel().current();
+            kernel().block();
+            dispatcher_ = nullptr;
+        }
+        Item it = items_.front();
+        items_.pop_front();
+        board().noteLatency(kernel().now() - it.posted);
+        it.fn();
+    }
+}
+
+}  // namespace events
@@ -0,0 +1,22 @@
+#pragma once
+
+/*********** STM32L475 引脚编码（端口 << 4 | 引脚号，与 mbed 目标一致） ***********/
+typedef enum {
+    PA_5  = 0x05,
+    PA_8  = 0x08,
+    PB_6  = 0x16,
+    PB_7  = 0x17,
+    PB_10 = 0x1A,
+    PB_11 = 0x1B,
+    PB_14 = 0x1E,
+    PC_9  = 0x29,
+    PC_13 = 0x2D,
+    PD_11 = 0x3B,
+
+    LED1    = PA_5,
+    LED2    = PB_14,
+    BUTTON1 = PC_13,
+    USBTX   = PB_6,
+    USBRX   = PB_7,
+    NC      = -1,
+} PinName;
@@ -0,0 +1,255 @@
+#include "SimBoard.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include "SimKernel.h"
+#include "TraceFile.h"
+
+// CTRL1_XL.ODR_XL[3:0] → Hz（0 为掉电）
+static const double ODR_HZ[16] = {0, 12.5, 26, 52, 104, 208, 416, 833, 1660, 3330, 6660, 1.6,
+                                  0, 0, 0, 0};
+
+static double wallSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void usage() {
+    fprintf(stderr, "usage: program <trace.txt | --synth SPEC> [--seconds S] [--uart FILE] "
+                    "[--cpu-scale K] [--json FILE]\n");
+    _exit(2);
+}
+
+SimBoard &SimBoard::instance() {
+    static SimBoard *b = new SimBoard();
+    return *b;
+}
+
+SimBoard::SimBoard()
+    : source_(nullptr), samples_(0), odr_t0_(0), odr_k_(0), odr_code_(0), loop_(false),
+      stop_us_(0), int1_level_(false), i2c_hz_(100000), i2c_transfers_(0), i2c_busy_us_(0),
+      uart_(nullptr), uart_baud_(9600), uart_bytes_(0), uart_busy_us_(0), ticks_(0),
+      queue_full_(0), max_latency_us_(0), trace_path_(nullptr), synth_spec_(nullptr),
+      json_path_(nullptr), cpu_scale_(0), wall_t0_(wallSeconds()) {
+    parseArgs();
+    if (synth_spec_) {
+        TremorParams tp;
+        if (!parseTremorSpec(synth_spec_, tp)) {
+            fprintf(stderr, "sim: bad --synth spec %s\n", synth_spec_);
+            _exit(2);
+        }
+        source_ = new TremorMotion(tp);
+    } else {
+        if (!loadTrace(trace_path_, trace_) || trace_.empty()) {
+            fprintf(stderr, "sim: cannot read trace %s\n", trace_path_);
+            _exit(2);
+        }
+        source_ = new TraceMotion(trace_, loop_);
+    }
+
+    SimKernel &k = SimKernel::instance();
+    k.setCpuScale(cpu_scale_);
+    k.setFinishHook([this](const char *why) { return report(why); });
+    k.at(0, [this] { sampleEvent(); });
+    if (stop_us_) k.at(stop_us_, [&k] { k.finish("time limit"); });
+    // main() 返回时同样输出统计
+    atexit([] { SimKernel::instance().finish("main returned"); });
+}
+
+// main() 没有参数，从 /proc/self/cmdline 取命令行
+void SimBoard::parseArgs() {
+    static std::string cmdline;
+    FILE *fp = fopen("/proc/self/cmdline", "rb");
+    if (fp) {
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) cmdline.append(buf, n);
+        fclose(fp);
+    }
+    std::vector<const char *> argv;
+    for (size_t i = 0; i < cmdline.size(); i += strlen(cmdline.c_str() + i) + 1) {
+        argv.push_back(cmdline.c_str() + i);
+    }
+
+    const char *uartPath = nullptr;
+    for (size_t i = 1; i < argv.size(); i++) {
+        const bool more = i + 1 < argv.size();
+        if (!strcmp(argv[i], "--seconds") && more) {
+            stop_us_ = (uint64_t)(atof(argv[++i]) * 1e6);
+            loop_ = true;
+        } else if (!strcmp(argv[i], "--uart") && more) {
+            uartPath = argv[++i];
+        } else if (!strcmp(argv[i], "--cpu-scale") && more) {
+            cpu_scale_ = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--synth") && more) {
+            synth_spec_ = argv[++i];
+        } else if (!strcmp(argv[i], "--json") && more) {
+            json_path_ = argv[++i];
+        } else if (argv[i][0] != '-' && !trace_path_) {
+            trace_path_ = argv[i];
+        } else {
+            usage();
+        }
+    }
+    if (!trace_path_ == !synth_spec_ || (loop_ && stop_us_ == 0) || (synth_spec_ && !loop_)) usage();
+    if (uartPath && !(uart_ = fopen(uartPath, "wb"))) {
+        fprintf(stderr, "sim: cannot create %s\n", uartPath);
+        _exit(2);
+    }
+}
+
+/*********** 传感器 ***********/
+// 按 CTRL1_XL 的 ODR 产生样本；ODR 改变时重新对齐，掉电时每 1 ms 查询一次
+void SimBoard::sampleEvent() {
+    SimKernel &k = SimKernel::instance();
+    const int code = sensor_.reg(CTRL1_XL) >> 4;
+    const double hz = ODR_HZ[code];
+    if (code != odr_code_) {
+        odr_code_ = code;
+        odr_t0_ = (double)k.now();
+        odr_k_ = 0;
+    } else if (hz > 0) {
+        MotionSample m;
+        if (source_->generate(&m, 1, 1.0 / hz) == 0) {
+            k.at(k.now() + 1000000, [&k] { k.finish("trace end"); });
+            return;
+        }
+        sensor_.pushMotion(m);
+        ++samples_;
+        pollInt1();
+    }
+    if (hz <= 0) {
+        k.at(k.now() + 1000, [this] { sampleEvent(); });
+        return;
+    }
+    ++odr_k_;
+    k.at((uint64_t)llround(odr_t0_ + odr_k_ * 1e6 / hz), [this] { sampleEvent(); });
+}
+
+void SimBoard::pollInt1() {
+    const bool level = sensor_.int1();
+    const bool rose = level && !int1_level_;
+    int1_level_ = level;
+    if (rose && int1_rise_) SimKernel::instance().isr(int1_rise_);
+}
+
+void SimBoard::onRise(PinName pin, std::function<void()> fn) {
+    if (pin == PD_11) int1_rise_ = std::move(fn);
+}
+
+int SimBoard::pinLevel(PinName pin) const {
+    return pin == PD_11 ? sensor_.int1() : 0;
+}
+
+uint64_t SimBoard::i2cUs(int len) const {
+    return (uint64_t)(len + 1) * 9 * 1000000 / i2c_hz_ + 1;
+}
+
+/*********** 串口 ***********/
+// UnbufferedSerial::write 逐字节忙等发送
+void SimBoard::uartWrite(const void *buf, size_t n) {
+    if (uart_) fwrite(buf, 1, n, uart_);
+    uart_bytes_ += n;
+    const uint64_t us = uartUs(n);
+    uart_busy_us_ += us;
+    SimKernel::instance().busy(us);
+}
+
+/*********** 输出引脚 ***********/
+SimPinStat *SimBoard::addPin(PinName pin, bool pwm) {
+    SimPinStat *p = new SimPinStat();
+    snprintf(p->name, sizeof(p->name), "P%c_%d", 'A' + (pin >> 4), pin & 0x0F);
+    p->pwm = pwm;
+    p->level = 0;
+    p->since = SimKernel::instance().now();
+    p->integral = 0;
+    p->onUs = 0;
+    p->writes = 0;
+    pins_.push_back(p);
+    return p;
+}
+
+void SimBoard::setPin(SimPinStat *p, float level) {
+    const uint64_t now = SimKernel::instance().now();
+    const uint64_t dt = now - p->since;
+    p->integral += (double)p->level * dt;
+    if (p->level > 0) p->onUs += dt;
+    p->since = now;
+    p->level = level;
+    ++p->writes;
+}
+
+/*********** 结束统计 ***********/
+int SimBoard::report(const char *why) {
+    SimKernel &k = SimKernel::instance();
+    const double wall = wallSeconds() - wall_t0_;
+    const uint64_t now = k.now();
+    const double sec = now / 1e6;
+    for (SimPinStat *p : pins_) {
+        --p->writes;  // 结算不计为一次写入
+        setPin(p, p->level);
+    }
+    const uint32_t fifoDropped = sensor_.fifoDropped() / FIFO_FRAME_WORDS;
+    const double span = now ? (double)now : 1.0;
+    if (uart_) fclose(uart_);
+
+    fprintf(stderr, "sim: stopped (%s) at %.2f s virtual after %.2f s wall, %.0fx real time\n",
+            why, sec, wall, wall > 0 ? sec / wall : 0.0);
+    fprintf(stderr, "sim: sensor %llu samples @%.1f Hz, FIFO overwritten %u frames\n",
+            (unsigned long long)samples_, ODR_HZ[odr_code_], fifoDropped);
+    fprintf(stderr, "sim: I2C %llu transfers @%d Hz, bus busy %.2f%%\n",
+            (unsigned long long)i2c_transfers_, i2c_hz_, 100.0 * i2c_busy_us_ / span);
+    fprintf(stderr, "sim: ticker %llu ticks, event queue full %llu (missed ticks), "
+                    "max dispatch latency %llu us\n",
+            (unsigned long long)ticks_, (unsigned long long)queue_full_,
+            (unsigned long long)max_latency_us_);
+    fprintf(stderr, "sim: UART %llu bytes @%d baud, busy %.2f%%\n",
+            (unsigned long long)uart_bytes_, uart_baud_, 100.0 * uart_busy_us_ / span);
+    for (SimThread *t : k.threads()) {
+        fprintf(stderr, "sim: thread %-8s prio %2d busy %.2f%%\n", t->name, t->priority,
+                100.0 * t->busyUs / span);
+    }
+    for (SimPinStat *p : pins_) {
+        fprintf(stderr, "sim: %-10s %-5s mean %.3f, on %.2f%%, %u writes\n",
+                p->pwm ? "PwmOut" : "DigitalOut", p->name, p->integral / span,
+                100.0 * p->onUs / span, p->writes);
+    }
+
+    if (json_path_) {
+        FILE *fp = fopen(json_path_, "w");
+        if (fp) {
+            fprintf(fp, "{\n  \"stop\": \"%s\",\n  \"virtual_s\": %.6f,\n  \"wall_s\": %.3f,\n",
+                    why, sec, wall);
+            fprintf(fp, "  \"samples\": %llu,\n  \"fifo_overwritten_frames\": %u,\n",
+                    (unsigned long long)samples_, fifoDropped);
+            fprintf(fp, "  \"i2c_transfers\": %llu,\n  \"i2c_busy\": %.6f,\n",
+                    (unsigned long long)i2c_transfers_, i2c_busy_us_ / span);
+            fprintf(fp, "  \"ticks\": %llu,\n  \"missed_ticks\": %llu,\n  \"max_latency_us\": %llu,\n",
+                    (unsigned long long)ticks_, (unsigned long long)queue_full_,
+                    (unsigned long long)max_latency_us_);
+            fprintf(fp, "  \"uart_bytes\": %llu,\n  \"uart_busy\": %.6f,\n",
+                    (unsigned long long)uart_bytes_, uart_busy_us_ / span);
+            fprintf(fp, "  \"threads\": {");
+            const char *sep = "";
+            for (SimThread *t : k.threads()) {
+                fprintf(fp, "%s\"%s\": %.6f", sep, t->name, t->busyUs / span);
+                sep = ", ";
+            }
+            fprintf(fp, "},\n  \"pins\": {");
+            sep = "";
+            for (SimPinStat *p : pins_) {
+                fprintf(fp, "%s\n    \"%s\": {\"mean\": %.6f, \"on\": %.6f, \"writes\": %u}", sep,
+                        p->name, p->integral / span, p->onUs / span, p->writes);
+                sep = ",";
+            }
+            fprintf(fp, "\n  }\n}\n");
+            fclose(fp);
+        }
+    }
+
+    const bool deadlock = !strncmp(why, "deadlock", 8);
+    if (deadlock) fprintf(stderr, "sim: %s\n", why);
+    return queue_full_ || fifoDropped || deadlock ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <functional>
+#include <vector>
+#include "ImuFrame.h"
+#include "Lsm6dslMock.h"
+#include "MotionSource.h"
+#include "PinNames.h"
+
+/*************************************
+ *  B-L475E-IOT01A 板级模型（主机端）  *
+ *  LSM6DSL 按 ODR 从轨迹取样，INT1    *
+ *  接 PD_11；记录串口输出、I²C 总线   *
+ *  占用、LED 占空比与丢拍             *
+ *************************************/
+// 命令行（由 /proc/self/cmdline 读取，main() 保持固件原样）：
+//   program <trace.txt | --synth SPEC> [--seconds S] [--uart FILE] [--cpu-scale K] [--json FILE]
+// 不给 --seconds 时轨迹播放一遍后再运行 1 s 收尾；给出时循环播放轨迹直到 S 秒。
+// --synth 改用合成震颤（SPEC 格式见 MotionSource.h 的 parseTremorSpec），此时必须给出 --seconds。
+
+// 记录输出引脚的电平 / 占空比随虚拟时间的积分
+struct SimPinStat {
+    char name[8];       // "PA_5"
+    bool pwm;
+    float level;        // DigitalOut: 0/1；PwmOut: 占空比
+    uint64_t since;     // 当前电平开始的时刻
+    double integral;    // ∫level dt（微秒）
+    uint64_t onUs;      // level > 0 的总时长
+    uint32_t writes;
+};
+
+class SimBoard {
+public:
+    static SimBoard &instance();
+
+    /*********** 传感器 / I²C ***********/
+    Lsm6dslMock &sensor() { return sensor_; }
+    // 一次阻塞 I²C 传输的总线时间：起始 + 地址 + len 字节，每字节 9 位
+    uint64_t i2cUs(int len) const;
+    void setI2cHz(int hz) { i2c_hz_ = hz > 0 ? hz : 100000; }
+    void noteI2c(int len) { ++i2c_transfers_; i2c_busy_us_ += i2cUs(len); }
+    // 传感器寄存器被访问后调用：检查 INT1 上升沿
+    void pollInt1();
+    void onRise(PinName pin, std::function<void()> fn);
+    int pinLevel(PinName pin) const;
+
+    /*********** 串口 ***********/
+    void uartWrite(const void *buf, size_t n);
+    uint64_t uartUs(size_t n) const { return (uint64_t)n * 10 * 1000000 / uart_baud_; }
+    void setBaud(int baud) { uart_baud_ = baud > 0 ? baud : 9600; }
+
+    /*********** 输出引脚 ***********/
+    SimPinStat *addPin(PinName pin, bool pwm);
+    void setPin(SimPinStat *p, float level);
+
+    /*********** 统计 ***********/
+    void noteTick() { ++ticks_; }
+    void noteQueueFull() { ++queue_full_; }
+    void noteLatency(uint64_t us) { if (us > max_latency_us_) max_latency_us_ = us; }
+
+private:
+    SimBoard();
+    void parseArgs();
+    void sampleEvent();
+    int report(const char *why);
+
+    Lsm6dslMock sensor_;
+    std::vector<ImuFrame> trace_;
+    MotionSource *source_;
+    uint64_t samples_;
+    double odr_t0_;        // 当前 ODR 下第 0 个样本的时刻
+    uint64_t odr_k_;
+    int odr_code_;
+    bool loop_;
+    uint64_t stop_us_;
+
+    bool int1_level_;
+    std::function<void()> int1_rise_;
+
+    int i2c_hz_;
+    uint64_t i2c_transfers_, i2c_busy_us_;
+
+    FILE *uart_;
+    int uart_baud_;
+    uint64_t uart_bytes_, uart_busy_us_;
+
+    std::vector<SimPinStat *> pins_;
+    uint64_t ticks_, queue_full_, max_latency_us_;
+
+    const char *trace_path_;
+    const char *synth_spec_;
+    const char *json_path_;
+    double cpu_scale_;
+    double wall_t0_;
+};
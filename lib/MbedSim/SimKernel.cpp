@@ -0,0 +1,210 @@
+#include "SimKernel.h"
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <thread>
+
+static const int PRIORITY_NORMAL = 24;  // osPriorityNormal
+
+SimKernel &SimKernel::instance() {
+    // 永不析构：退出时其它线程仍阻塞在条件变量上
+    static SimKernel *k = new SimKernel();
+    return *k;
+}
+
+// 第一次调用 instance() 的线程（静态初始化时的进程主线程）即 main 线程
+SimKernel::SimKernel()
+    : now_(0), seq_(0), ready_back_(0), ready_front_(0), in_isr_(false),
+      cpu_scale_(0), cpu_rem_ns_(0) {
+    SimThread *main = new SimThread();
+    main->priority = PRIORITY_NORMAL;
+    main->state = SimThread::RUNNING;
+    main->name = "main";
+    main->readySeq = 0;
+    main->busyUs = 0;
+    main->cpuMarkNs = 0;
+    main->go = false;
+    threads_.push_back(main);
+    current_ = main;
+}
+
+static uint64_t threadCpuNs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/*********** 定时事件 ***********/
+uint64_t SimKernel::at(uint64_t t, std::function<void()> fn) {
+    const uint64_t id = ++seq_;
+    events_.push({t < now_ ? now_ : t, id, id, std::move(fn)});
+    return id;
+}
+
+void SimKernel::cancel(uint64_t id) { cancelled_.insert(id); }
+
+void SimKernel::fireDue() {
+    while (!events_.empty() && events_.top().t <= now_) {
+        Event e = events_.top();
+        events_.pop();
+        if (cancelled_.erase(e.id)) continue;
+        const bool nested = in_isr_;
+        in_isr_ = true;
+        e.fn();
+        in_isr_ = nested;
+    }
+}
+
+void SimKernel::isr(const std::function<void()> &fn) {
+    const bool nested = in_isr_;
+    in_isr_ = true;
+    fn();
+    in_isr_ = nested;
+    if (!in_isr_) preemptIfNeeded();
+}
+
+/*********** 调度 ***********/
+SimThread *SimKernel::pickReady() const {
+    SimThread *best = nullptr;
+    for (SimThread *t : threads_) {
+        if (t->state != SimThread::READY) continue;
+        if (!best || t->priority > best->priority ||
+            (t->priority == best->priority && t->readySeq < best->readySeq)) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+// 被抢占的线程排在同优先级队首，与 RTX 一致
+void SimKernel::makeReady(SimThread *t, bool front) {
+    t->state = SimThread::READY;
+    t->readySeq = front ? --ready_front_ : ++ready_back_;
+}
+
+void SimKernel::switchTo(SimThread *next) {
+    SimThread *self = current_;
+    next->state = SimThread::RUNNING;
+    current_ = next;
+    if (next == self) return;
+    {
+        std::lock_guard<std::mutex> l(m_);
+        next->go = true;
+    }
+    next->cv.notify_one();
+    if (self->state == SimThread::DONE) return;
+    std::unique_lock<std::mutex> l(m_);
+    self->cv.wait(l, [self] { return self->go; });
+    self->go = false;
+}
+
+// 当前线程不能继续（阻塞或结束）：交给最高优先级的就绪线程；
+// 没有就绪线程时推进到下一个事件（空闲）
+void SimKernel::schedule() {
+    while (true) {
+        if (SimThread *t = pickReady()) {
+            switchTo(t);
+            return;
+        }
+        if (events_.empty()) finish("deadlock: all threads blocked and no pending events");
+        if (events_.top().t > now_) now_ = events_.top().t;
+        fireDue();
+    }
+}
+
+void SimKernel::preemptIfNeeded() {
+    SimThread *t = pickReady();
+    if (t && t->priority > current_->priority) {
+        makeReady(current_, true);
+        switchTo(t);
+    }
+}
+
+/*********** 线程 ***********/
+SimThread *SimKernel::spawn(int priority, const char *name, std::function<void()> fn) {
+    SimThread *t = new SimThread();
+    t->priority = priority;
+    t->state = SimThread::BLOCKED;
+    t->name = name;
+    t->readySeq = 0;
+    t->busyUs = 0;
+    t->cpuMarkNs = 0;
+    t->go = false;
+    t->fn = std::move(fn);
+    threads_.push_back(t);
+
+    std::thread([this, t] {
+        {
+            std::unique_lock<std::mutex> l(m_);
+            t->cv.wait(l, [t] { return t->go; });
+            t->go = false;
+        }
+        t->cpuMarkNs = threadCpuNs();
+        t->fn();
+        enter();
+        t->state = SimThread::DONE;
+        schedule();
+    }).detach();
+
+    wake(t);
+    return t;
+}
+
+void SimKernel::block() {
+    enter();
+    current_->state = SimThread::BLOCKED;
+    schedule();
+    if (cpu_scale_ > 0) current_->cpuMarkNs = threadCpuNs();
+}
+
+void SimKernel::wake(SimThread *t) {
+    if (t->state != SimThread::BLOCKED) return;
+    makeReady(t, false);
+    if (!in_isr_ && t->priority > current_->priority) {
+        enter();
+        preemptIfNeeded();
+    }
+}
+
+void SimKernel::sleep(uint64_t us) {
+    SimThread *self = current_;
+    at(now_ + us, [this, self] { wake(self); });
+    block();
+}
+
+void SimKernel::busy(uint64_t us) {
+    current_->busyUs += us;
+    while (us > 0) {
+        const uint64_t te = events_.empty() ? UINT64_MAX : events_.top().t;
+        if (te >= now_ + us) {
+            now_ += us;
+            break;
+        }
+        if (te > now_) {
+            us -= te - now_;
+            now_ = te;
+        }
+        fireDue();
+        preemptIfNeeded();
+    }
+}
+
+void SimKernel::enter() {
+    if (cpu_scale_ <= 0 || in_isr_) return;
+    const uint64_t ns = threadCpuNs();
+    cpu_rem_ns_ += (uint64_t)((ns - current_->cpuMarkNs) * cpu_scale_);
+    current_->cpuMarkNs = ns;
+    const uint64_t us = cpu_rem_ns_ / 1000;
+    cpu_rem_ns_ %= 1000;
+    if (us) {
+        busy(us);
+        current_->cpuMarkNs = threadCpuNs();
+    }
+}
+
+void SimKernel::finish(const char *why) {
+    const int rc = finish_hook_ ? finish_hook_(why) : 0;
+    fflush(stdout);
+    fflush(stderr);
+    _exit(rc);
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <stdint.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <unordered_set>
+#include <vector>
+
+/*************************************
+ *  虚拟时间内核（主机端 mbed 替身）   *
+ *  单 CPU、按优先级抢占：任一时刻只有  *
+ *  一个线程在运行，虚拟时间只在所有线程 *
+ *  阻塞（空闲）或线程忙等时推进，中断  *
+ *  是按时间排序的事件                 *
+ *************************************/
+// 每个 mbed 线程对应一个真实的 std::thread，但只有持有“接力棒”的线程在执行，
+// 其余线程阻塞在各自的条件变量上，因此结果与主机调度无关、完全可复现。
+// 计算本身不消耗虚拟时间；I²C / 串口忙等通过 busy() 计时。
+// cpuScale > 0 时把线程消耗的主机 CPU 时间乘以该系数计入虚拟时间（不再可复现），
+// 用于模拟较慢的 MCU 上的中断延迟与丢拍。
+
+struct SimThread {
+    enum State { READY, RUNNING, BLOCKED, DONE };
+
+    int priority;
+    State state;
+    const char *name;
+    int64_t readySeq;    // 同优先级按就绪先后执行
+    uint64_t busyUs;     // 忙等（含折算的计算时间）累计
+    uint64_t cpuMarkNs;  // 上次折算时的线程 CPU 时间
+    bool go;             // 接力棒
+    std::condition_variable cv;
+    std::function<void()> fn;
+};
+
+class SimKernel {
+public:
+    static SimKernel &instance();
+
+    uint64_t now() const { return now_; }  // 虚拟时间（微秒）
+    bool inIsr() const { return in_isr_; }
+    SimThread *current() const { return current_; }
+    const std::vector<SimThread *> &threads() const { return threads_; }
+
+    /*********** 定时事件（在中断上下文中执行） ***********/
+    uint64_t at(uint64_t t, std::function<void()> fn);  // 返回事件 ID
+    void cancel(uint64_t id);
+    // 立即以中断上下文执行 fn；在线程中调用时随后检查抢占
+    void isr(const std::function<void()> &fn);
+
+    /*********** 线程 ***********/
+    SimThread *spawn(int priority, const char *name, std::function<void()> fn);
+    void block();               // 当前线程阻塞，直到 wake()
+    void wake(SimThread *t);    // 唤醒；在线程上下文中唤醒更高优先级线程时立即切换
+    void sleep(uint64_t us);
+    void busy(uint64_t us);     // 当前线程占用 CPU us 微秒，期间中断照常发生
+    void enter();               // API 入口：cpuScale > 0 时折算计算时间
+
+    void setCpuScale(double k) { cpu_scale_ = k; }
+    // 仿真结束时调用，返回进程退出码
+    void setFinishHook(std::function<int(const char *)> hook) { finish_hook_ = hook; }
+    [[noreturn]] void finish(const char *why);
+
+private:
+    SimKernel();
+
+    struct Event {
+        uint64_t t, seq, id;
+        std::function<void()> fn;
+        bool operator>(const Event &o) const { return t != o.t ? t > o.t : seq > o.seq; }
+    };
+
+    SimThread *pickReady() const;
+    void makeReady(SimThread *t, bool front);
+    void schedule();
+    void switchTo(SimThread *next);
+    void fireDue();
+    void preemptIfNeeded();
+
+    std::mutex m_;
+    std::vector<SimThread *> threads_;
+    SimThread *current_;
+    uint64_t now_;
+    uint64_t seq_;
+    int64_t ready_back_, ready_front_;
+    bool in_isr_;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events_;
+    std::unordered_set<uint64_t> cancelled_;
+    double cpu_scale_;
+    uint64_t cpu_rem_ns_;
+    std::function<int(const char *)> finish_hook_;
+};
@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+/*********** 微秒计数器（虚拟时间，32 位回绕） ***********/
+uint32_t us_ticker_read(void);
@@ -0,0 +1,236 @@
+#pragma once
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "PinNames.h"
+
+/*************************************
+ *  mbed OS API 主机端替身            *
+ *  只覆盖 main.cpp 用到的部分，全部由  *
+ *  SimKernel 的虚拟时钟驱动，使固件    *
+ *  主程序无需修改即可在 Linux 上运行   *
+ *************************************/
+// pio run -e sim && .pio/build/sim/program trace.txt [--seconds S] [--uart FILE] ...
+// 板级连接与命令行见 SimBoard.h
+
+struct SimThread;
+struct SimPinStat;
+
+namespace mbed {
+
+/*********** Callback ***********/
+template <class F> class Callback;
+
+template <class R, class... A>
+class Callback<R(A...)> {
+public:
+    Callback() {}
+    template <class F, class = typename std::enable_if<
+                           !std::is_same<typename std::decay<F>::type, Callback>::value>::type>
+    Callback(F f) : fn_(std::move(f)) {}
+    template <class T, class U>
+    Callback(U *obj, R (T::*method)(A...))
+        : fn_([obj, method](A... a) { return (obj->*method)(a...); }) {}
+
+    R operator()(A... a) const { return fn_(a...); }
+    explicit operator bool() const { return (bool)fn_; }
+
+private:
+    std::function<R(A...)> fn_;
+};
+
+template <class R, class... A>
+Callback<R(A...)> callback(R (*fn)(A...)) { return Callback<R(A...)>(fn); }
+
+template <class T, class U, class R, class... A>
+Callback<R(A...)> callback(U *obj, R (T::*method)(A...)) { return Callback<R(A...)>(obj, method); }
+
+typedef Callback<void(int)> event_callback_t;
+
+/*********** 数字 / PWM 输出（记录电平与占空比） ***********/
+class DigitalOut {
+public:
+    explicit DigitalOut(PinName pin, int value = 0);
+    void write(int value);
+    int read() const { return value_; }
+    DigitalOut &operator=(int value) { write(value); return *this; }
+    operator int() const { return value_; }
+
+private:
+    SimPinStat *stat_;
+    int value_;
+};
+
+class PwmOut {
+public:
+    explicit PwmOut(PinName pin);
+    void write(float duty);
+    float read() const { return duty_; }
+    void period(float seconds) { period_us_ = (int)(seconds * 1e6f); }
+    void period_ms(int ms) { period_us_ = ms * 1000; }
+    void period_us(int us) { period_us_ = us; }
+    PwmOut &operator=(float duty) { write(duty); return *this; }
+    operator float() const { return duty_; }
+
+private:
+    SimPinStat *stat_;
+    float duty_;
+    int period_us_;
+};
+
+/*********** 输入中断（PD_11 接 LSM6DSL INT1） ***********/
+class InterruptIn {
+public:
+    explicit InterruptIn(PinName pin) : pin_(pin) {}
+    void rise(Callback<void()> fn);
+    int read();
+    operator int() { return read(); }
+
+private:
+    PinName pin_;
+};
+
+/*********** I²C（总线上挂 LSM6DSL 模型） ***********/
+#define I2C_EVENT_ERROR               (1 << 1)
+#define I2C_EVENT_ERROR_NO_SLAVE      (1 << 2)
+#define I2C_EVENT_TRANSFER_COMPLETE   (1 << 3)
+#define I2C_EVENT_TRANSFER_EARLY_NACK (1 << 4)
+#define I2C_EVENT_ALL (I2C_EVENT_ERROR | I2C_EVENT_TRANSFER_COMPLETE | \
+                       I2C_EVENT_ERROR_NO_SLAVE | I2C_EVENT_TRANSFER_EARLY_NACK)
+
+class I2C {
+public:
+    I2C(PinName, PinName) {}
+    void frequency(int hz);
+    int write(int address, const char *data, int length, bool repeated = false);
+    int read(int address, char *data, int length, bool repeated = false);
+    // 异步传输：立即访问寄存器模型，回调在总线时间结束后于中断上下文执行
+    int transfer(int address, const char *tx, int tx_len, char *rx, int rx_len,
+                 const event_callback_t &callback, int event = 0, bool repeated = false);
+
+private:
+    bool pending_ = false;
+};
+
+/*********** 串口（写入时按波特率忙等） ***********/
+class UnbufferedSerial {
+public:
+    UnbufferedSerial(PinName tx, PinName rx, int baud = 9600);
+    ssize_t write(const void *buffer, size_t length);
+    ssize_t read(void *, size_t) { return 0; }
+    void baud(int baud);
+};
+
+/*********** 周期定时器 ***********/
+class Ticker {
+public:
+    Ticker() : id_(0), period_us_(0), armed_(false) {}
+    ~Ticker() { detach(); }
+    void attach(Callback<void()> fn, std::chrono::microseconds period);
+    void detach();
+
+private:
+    void fire(uint64_t t);
+
+    Callback<void()> fn_;
+    uint64_t id_;
+    uint64_t period_us_;
+    bool armed_;
+};
+
+}  // namespace mbed
+
+/*********** RTOS ***********/
+typedef enum {
+    osPriorityIdle        = 1,
+    osPriorityLow         = 8,
+    osPriorityBelowNormal = 16,
+    osPriorityNormal      = 24,
+    osPriorityAboveNormal = 32,
+    osPriorityHigh        = 40,
+    osPriorityRealtime    = 48,
+} osPriority_t;
+typedef osPriority_t osPriority;
+typedef int32_t osStatus;
+#define osOK             0
+#define osWaitForever    0xFFFFFFFFu
+#define OS_STACK_SIZE    4096
+
+namespace rtos {
+
+class Thread {
+public:
+    explicit Thread(osPriority priority = osPriorityNormal, uint32_t /*stack_size*/ = OS_STACK_SIZE,
+                    unsigned char * /*stack_mem*/ = nullptr, const char *name = nullptr)
+        : priority_(priority), name_(name), thread_(nullptr) {}
+    osStatus start(mbed::Callback<void()> task);
+
+private:
+    osPriority priority_;
+    const char *name_;
+    SimThread *thread_;
+};
+
+class EventFlags {
+public:
+    EventFlags() : flags_(0), waiter_(nullptr) {}
+    uint32_t set(uint32_t flags);
+    uint32_t clear(uint32_t flags = 0x7FFFFFFF);
+    uint32_t get() const { return flags_; }
+    uint32_t wait_any(uint32_t flags, uint32_t millisec = osWaitForever, bool clear = true);
+
+private:
+    uint32_t flags_;
+    SimThread *waiter_;
+};
+
+namespace ThisThread {
+void sleep_for(std::chrono::microseconds rel_time);
+}
+
+}  // namespace rtos
+
+/*********** 事件队列 ***********/
+namespace events {
+
+class EventQueue {
+public:
+    // 默认容量与 mbed 的 EVENTS_QUEUE_SIZE 相当（32 个事件）
+    explicit EventQueue(size_t events = 32) : capacity_(events), dispatcher_(nullptr) {}
+
+    template <class F>
+    int call(F f) { return post(mbed::Callback<void()>(f)); }
+    // 投递 f 的事件对象（可作为中断回调）
+    template <class F>
+    mbed::Callback<void()> event(F f) {
+        mbed::Callback<void()> cb(f);
+        return mbed::Callback<void()>([this, cb] { post(cb); });
+    }
+    void dispatch_forever();
+
+private:
+    int post(mbed::Callback<void()> fn);
+
+    struct Item {
+        mbed::Callback<void()> fn;
+        uint64_t posted;
+    };
+    std::deque<Item> items_;
+    size_t capacity_;
+    SimThread *dispatcher_;
+    int next_id_ = 1;
+};
+
+}  // namespace events
+
+using namespace mbed;
+using namespace rtos;
+using namespace events;
@@ -0,0 +1,82 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/*************************************
+ *  单生产者 / 单消费者无锁环形缓冲    *
+ *  生产者与消费者可以分别位于中断、   *
+ *  不同线程（固件）或 std::thread     *
+ *  （主机）中，无需加锁               *
+ *************************************/
+// Capacity 必须为 2 的幂；读写索引自由递增，取模时用掩码
+template <class T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head_(0), tail_(0), overruns_(0) {}
+
+    /*********** 生产者 ***********/
+    // 写入一个元素；缓冲已满时丢弃并计入溢出
+    bool push(const T &v) {
+        uint32_t h = head_.load(std::memory_order_relaxed);
+        if (h - tail_.load(std::memory_order_acquire) >= Capacity) {
+            overruns_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        buf_[h & MASK] = v;
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 整块写入：空间不足时一个都不写（保证记录完整），计入溢出
+    bool pushAll(const T *src, size_t n) {
+        uint32_t h = head_.load(std::memory_order_relaxed);
+        if (Capacity - (h - tail_.load(std::memory_order_acquire)) < n) {
+            overruns_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        for (size_t i = 0; i < n; i++) buf_[(h + i) & MASK] = src[i];
+        head_.store(h + (uint32_t)n, std::memory_order_release);
+        return true;
+    }
+
+    /*********** 消费者 ***********/
+    // 读出一个元素；为空时返回 false
+    bool pop(T &v) {
+        uint32_t t = tail_.load(std::memory_order_relaxed);
+        if (head_.load(std::memory_order_acquire) == t) return false;
+        v = buf_[t & MASK];
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 最多读出 max 个元素，返回实际数量
+    size_t popMany(T *dst, size_t max) {
+        uint32_t t = tail_.load(std::memory_order_relaxed);
+        size_t n = head_.load(std::memory_order_acquire) - t;
+        if (n > max) n = max;
+        for (size_t i = 0; i < n; i++) dst[i] = buf_[(t + i) & MASK];
+        tail_.store(t + (uint32_t)n, std::memory_order_release);
+        return n;
+    }
+
+    /*********** 状态（任意一侧均可读取，结果为近似值） ***********/
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return Capacity; }
+    uint32_t overruns() const { return overruns_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t MASK = Capacity - 1;
+
+    // 生产者与消费者的索引分开放置，避免主机上的伪共享
+    alignas(64) std::atomic<uint32_t> head_;  // 写索引（仅生产者修改）
+    alignas(64) std::atomic<uint32_t> tail_;  // 读索引（仅消费者修改）
+    std::atomic<uint32_t> overruns_;          // 因缓冲已满而丢弃的次数
+    T buf_[Capacity];
+};
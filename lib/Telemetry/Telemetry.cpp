@@ -0,0 +1,162 @@
+#include "Telemetry.h"
+#include <string.h>
+
+/*********** CRC / COBS ***********/
+uint16_t telCrc16(const uint8_t *p, size_t n, uint16_t crc) {
+    while (n--) {
+        crc ^= (uint16_t)(*p++) << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+size_t cobsEncode(const uint8_t *src, size_t n, uint8_t *dst) {
+    size_t code = 0, out = 1;  // dst[code] 为当前段的长度字节
+    uint8_t run = 1;
+    for (size_t i = 0; i < n; i++) {
+        if (src[i] == 0) {
+            dst[code] = run;
+            code = out++;
+            run = 1;
+            continue;
+        }
+        dst[out++] = src[i];
+        if (++run == 0xFF) {
+            dst[code] = run;
+            code = out++;
+            run = 1;
+        }
+    }
+    dst[code] = run;
+    return out;
+}
+
+size_t cobsDecode(const uint8_t *src, size_t n, uint8_t *dst) {
+    size_t in = 0, out = 0;
+    while (in < n) {
+        const uint8_t code = src[in++];
+        if (code == 0 || in + code - 1 > n) return 0;
+        for (uint8_t k = 1; k < code; k++) {
+            if (src[in] == 0) return 0;
+            dst[out++] = src[in++];
+        }
+        // 0xFF 段后面不隐含 0；最后一段后面也没有
+        if (code != 0xFF && in < n) dst[out++] = 0;
+    }
+    return out;
+}
+
+size_t telEncodeFrame(TelType type, uint16_t seq, const uint8_t *payload, size_t n, uint8_t *out) {
+    uint8_t raw[TEL_HEADER + TEL_MAX_PAYLOAD + TEL_CRC];
+    if (n > TEL_MAX_PAYLOAD) n = TEL_MAX_PAYLOAD;
+    raw[0] = type;
+    memcpy(raw + 1, &seq, 2);
+    memcpy(raw + TEL_HEADER, payload, n);
+    const uint16_t crc = telCrc16(raw, TEL_HEADER + n);
+    memcpy(raw + TEL_HEADER + n, &crc, 2);
+
+    size_t len = cobsEncode(raw, TEL_HEADER + n + TEL_CRC, out);
+    out[len++] = 0;
+    return len;
+}
+
+/*********** 发送端 ***********/
+TelemetryEncoder::TelemetryEncoder() : imuIndex_(0), imuCount_(0) {
+    memset(seq_, 0, sizeof(seq_));
+}
+
+size_t TelemetryEncoder::emit(TelType type, const uint8_t *payload, size_t n) {
+    return telEncodeFrame(type, seq_[type]++, payload, n, frame_);
+}
+
+size_t TelemetryEncoder::imu(const ImuFrame &f) {
+    imuBatch_[imuCount_++] = f;
+    return imuCount_ == TEL_IMU_BATCH ? flushImu() : 0;
+}
+
+size_t TelemetryEncoder::flushImu() {
+    if (imuCount_ == 0) return 0;
+    uint8_t p[5 + TEL_IMU_BATCH * sizeof(ImuFrame)];
+    memcpy(p, &imuIndex_, 4);
+    p[4] = (uint8_t)imuCount_;
+    memcpy(p + 5, imuBatch_, imuCount_ * sizeof(ImuFrame));
+    const size_t n = 5 + imuCount_ * sizeof(ImuFrame);
+    imuIndex_ += (uint32_t)imuCount_;
+    imuCount_ = 0;
+    return emit(TEL_IMU, p, n);
+}
+
+size_t TelemetryEncoder::spectrum(uint32_t window, int ch, const float *mag, int bins) {
+    // 超出单帧负载的高频点截断
+    const int maxBins = (int)((TEL_MAX_PAYLOAD - 6) / sizeof(float));
+    if (bins > maxBins) bins = maxBins;
+    uint8_t p[TEL_MAX_PAYLOAD];
+    memcpy(p, &window, 4);
+    p[4] = (uint8_t)ch;
+    p[5] = (uint8_t)bins;
+    memcpy(p + 6, mag, bins * sizeof(float));
+    return emit(TEL_SPECTRUM, p, 6 + bins * sizeof(float));
+}
+
+size_t TelemetryEncoder::decision(uint32_t window, uint8_t flags, float levelT, float levelD) {
+    uint8_t p[13];
+    memcpy(p, &window, 4);
+    p[4] = flags;
+    memcpy(p + 5, &levelT, 4);
+    memcpy(p + 9, &levelD, 4);
+    return emit(TEL_DECISION, p, sizeof(p));
+}
+
+size_t TelemetryEncoder::log(const uint8_t *bytes, size_t n) {
+    return emit(TEL_LOG, bytes, n);
+}
+
+/*********** 接收端 ***********/
+TelemetryDecoder::TelemetryDecoder(FrameHandler onFrame, void *ctx)
+    : onFrame_(onFrame), ctx_(ctx), len_(0), overflow_(false) {
+    memset(&stats_, 0, sizeof(stats_));
+    memset(seen_, 0, sizeof(seen_));
+    memset(nextSeq_, 0, sizeof(nextSeq_));
+}
+
+void TelemetryDecoder::feed(const uint8_t *p, size_t n) {
+    stats_.bytes += n;
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] == 0) {
+            finishFrame();
+            continue;
+        }
+        if (len_ < sizeof(buf_)) buf_[len_++] = p[i];
+        else overflow_ = true;
+    }
+}
+
+void TelemetryDecoder::finishFrame() {
+    const size_t len = len_;
+    const bool overflow = overflow_;
+    len_ = 0;
+    overflow_ = false;
+    if (len == 0) return;  // 连续分隔符
+    if (overflow) { ++stats_.badFrames; return; }
+
+    const size_t n = cobsDecode(buf_, len, buf_);
+    if (n < TEL_HEADER + TEL_CRC) { ++stats_.crcErrors; return; }
+    uint16_t crc;
+    memcpy(&crc, buf_ + n - TEL_CRC, 2);
+    if (telCrc16(buf_, n - TEL_CRC) != crc) { ++stats_.crcErrors; return; }
+
+    const uint8_t type = buf_[0];
+    if (type == 0 || type >= TEL_TYPES) { ++stats_.badFrames; return; }
+    uint16_t seq;
+    memcpy(&seq, buf_ + 1, 2);
+    if (seen_[type] && seq != nextSeq_[type]) {
+        ++stats_.seqGaps;
+        stats_.lostFrames += (uint16_t)(seq - nextSeq_[type]);
+    }
+    seen_[type] = true;
+    nextSeq_[type] = (uint16_t)(seq + 1);
+    ++stats_.frames;
+    onFrame_(ctx_, (TelType)type, seq, buf_ + TEL_HEADER, n - TEL_HEADER - TEL_CRC);
+}
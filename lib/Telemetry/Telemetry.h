@@ -0,0 +1,120 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "ImuFrame.h"
+
+/*************************************
+ *  分帧二进制遥测                    *
+ *  帧 = COBS(类型 | 序号 | 负载 | CRC) *
+ *  + 0x00 分隔符；丢字节、错字节可由   *
+ *  CRC 与各类型独立的序号检出          *
+ *************************************/
+// 编码前的帧（小端）：
+//   [type u8][seq u16][payload ...][crc16 u16]
+// crc16 为 CRC-16/CCITT-FALSE（多项式 0x1021，初值 0xFFFF），覆盖 type..payload。
+// 每种帧类型各自维护序号（各类型可能由不同线程产生），接收端逐类型检查连续性。
+//
+// 负载：
+//   TEL_IMU      [起始采样序号 u32][帧数 u8][ImuFrame × 帧数]
+//   TEL_SPECTRUM [窗口序号 u32][通道 u8][频点数 u8][float 幅度 × 频点数]（0..DET_MAX_BIN）
+//   TEL_DECISION [窗口序号 u32][标志 u8][levelT f32][levelD f32]
+//   TEL_LOG      BinLog 字节流的一段（接收端按顺序拼接后交给 logdecode）
+enum TelType : uint8_t {
+    TEL_IMU      = 1,
+    TEL_SPECTRUM = 2,
+    TEL_DECISION = 3,
+    TEL_LOG      = 4,
+    TEL_TYPES
+};
+
+// TEL_DECISION 标志位
+enum TelDecisionFlags : uint8_t {
+    TEL_TREMOR          = 1 << 0,
+    TEL_DYSKINESIA      = 1 << 1,
+    TEL_SHOW_TREMOR     = 1 << 2,
+    TEL_SHOW_DYSKINESIA = 1 << 3,
+};
+
+constexpr size_t TEL_IMU_BATCH   = 8;    // 每个 TEL_IMU 帧携带的采样数（104Hz 下约 77ms 一帧）
+constexpr size_t TEL_MAX_PAYLOAD = 128;
+constexpr size_t TEL_HEADER      = 3;    // type + seq
+constexpr size_t TEL_CRC         = 2;
+// COBS 每 254 字节最多多 1 字节，另加开头 1 字节与结尾分隔符
+constexpr size_t TEL_MAX_FRAME =
+    TEL_HEADER + TEL_MAX_PAYLOAD + TEL_CRC + (TEL_HEADER + TEL_MAX_PAYLOAD + TEL_CRC) / 254 + 2;
+
+static_assert(5 + TEL_IMU_BATCH * sizeof(ImuFrame) <= TEL_MAX_PAYLOAD, "IMU batch too large");
+
+/*********** 基础编码 ***********/
+uint16_t telCrc16(const uint8_t *p, size_t n, uint16_t crc = 0xFFFF);
+
+// COBS 编码，不含分隔符；dst 至少 n + n / 254 + 1 字节
+size_t cobsEncode(const uint8_t *src, size_t n, uint8_t *dst);
+
+// COBS 解码（输入不含分隔符）；格式错误返回 0，可原地解码
+size_t cobsDecode(const uint8_t *src, size_t n, uint8_t *dst);
+
+// 组帧：写出 COBS 编码后的帧与分隔符，返回字节数（out 至少 TEL_MAX_FRAME 字节）
+size_t telEncodeFrame(TelType type, uint16_t seq, const uint8_t *payload, size_t n, uint8_t *out);
+
+/*********** 发送端 ***********/
+// 维护各类型序号并攒批 IMU 采样；生成的帧放在内部缓冲，由调用者送往串口或环形缓冲。
+// 一个实例只能在一个线程中使用；不同线程各用一个实例并产生不同类型的帧
+class TelemetryEncoder {
+public:
+    TelemetryEncoder();
+
+    // 加入一个采样；攒满 TEL_IMU_BATCH 个时生成一帧并返回其长度，否则返回 0
+    size_t imu(const ImuFrame &f);
+    // 立即把未满的 IMU 批次组帧（无数据时返回 0）
+    size_t flushImu();
+
+    size_t spectrum(uint32_t window, int ch, const float *mag, int bins);
+    size_t decision(uint32_t window, uint8_t flags, float levelT, float levelD);
+    size_t log(const uint8_t *bytes, size_t n);  // n 不超过 TEL_MAX_PAYLOAD
+
+    const uint8_t *frame() const { return frame_; }
+
+private:
+    size_t emit(TelType type, const uint8_t *payload, size_t n);
+
+    uint16_t seq_[TEL_TYPES];
+    uint32_t imuIndex_;                    // 下一个采样的序号
+    size_t imuCount_;                      // 当前批次中的采样数
+    ImuFrame imuBatch_[TEL_IMU_BATCH];
+    uint8_t frame_[TEL_MAX_FRAME];
+};
+
+/*********** 接收端 ***********/
+struct TelemetryStats {
+    uint64_t frames;        // 校验通过的帧
+    uint64_t crcErrors;     // CRC 或 COBS 格式错误
+    uint64_t badFrames;     // 长度 / 类型不合法
+    uint64_t seqGaps;       // 序号不连续的次数
+    uint64_t lostFrames;    // 按序号推算丢失的帧数
+    uint64_t bytes;         // 输入字节数
+};
+
+// 逐字节输入，以 0x00 为界切帧并校验。每个有效帧调用一次 onFrame
+class TelemetryDecoder {
+public:
+    typedef void (*FrameHandler)(void *ctx, TelType type, uint16_t seq,
+                                 const uint8_t *payload, size_t n);
+
+    TelemetryDecoder(FrameHandler onFrame, void *ctx);
+
+    void feed(const uint8_t *p, size_t n);
+    const TelemetryStats &stats() const { return stats_; }
+
+private:
+    void finishFrame();
+
+    FrameHandler onFrame_;
+    void *ctx_;
+    TelemetryStats stats_;
+    bool seen_[TEL_TYPES];
+    uint16_t nextSeq_[TEL_TYPES];
+    size_t len_;
+    bool overflow_;
+    uint8_t buf_[TEL_MAX_FRAME];
+};
@@ -0,0 +1,65 @@
+#include "BandDecimator.h"
+#include <math.h>
+#include <string.h>
+
+// RBJ 二阶 Butterworth（Q = 1/√2）；a1 / a2 按 CMSIS 约定取反存放
+static void designBiquad(float *k, double fc, double fs, bool highPass) {
+    const double w0 = 2.0 * M_PI * fc / fs;
+    const double cw = cos(w0), alpha = sin(w0) / (2.0 * M_SQRT1_2);
+    const double a0 = 1.0 + alpha;
+    const double b1 = highPass ? -(1.0 + cw) : 1.0 - cw;
+    const double b0 = (highPass ? 1.0 + cw : 1.0 - cw) / 2.0;
+    k[0] = (float)(b0 / a0);
+    k[1] = (float)(b1 / a0);
+    k[2] = (float)(b0 / a0);
+    k[3] = (float)(2.0 * cw / a0);
+    k[4] = (float)(-(1.0 - alpha) / a0);
+}
+
+BandDecimator::BandDecimator(float fs, uint32_t factor, float lowHz, float highHz)
+    : factor_(factor < 1 ? 1 : (factor > MAX_FACTOR ? MAX_FACTOR : factor)) {
+    designBiquad(coeffs_, lowHz, fs, true);
+    designBiquad(coeffs_ + 5, highHz, fs, false);
+    arm_biquad_cascade_planar_df2T_init_f32(&iir_, STAGES, DET_CHANNELS, coeffs_, iirState_);
+
+    // Hamming 窗 sinc，截止频率略低于输出 Nyquist
+    const double fc = 0.48 / factor_;  // 相对 fs
+    double h[TAPS], sum = 0;
+    for (int i = 0; i < TAPS; i++) {
+        const double t = i - (TAPS - 1) / 2.0;
+        const double s = t == 0 ? 2.0 * fc : sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        h[i] = s * (0.54 - 0.46 * cos(2.0 * M_PI * i / (TAPS - 1)));
+        sum += h[i];
+    }
+    for (int i = 0; i < TAPS; i++) taps_[i] = (float)(h[i] / sum);
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        arm_fir_decimate_init_f32(&fir_[c], TAPS, (uint8_t)factor_, taps_, firState_[c], BLOCK);
+    }
+    reset();
+}
+
+void BandDecimator::reset() {
+    memset(iirState_, 0, sizeof(iirState_));
+    memset(firState_, 0, sizeof(firState_));
+    memset(work_, 0, sizeof(work_));
+    pending_ = 0;
+}
+
+/*********** 块处理 ***********/
+size_t BandDecimator::process(float *x, size_t n, float *y, size_t yStride) {
+    arm_biquad_cascade_planar_df2T_f32(&iir_, x, x, (uint32_t)n);
+
+    // 余数 + 本次输入中 factor 的整数倍部分送入抽取器（BLOCK 是 factor 的倍数，不超过 BLOCK）
+    const size_t total = pending_ + n;
+    const size_t used = total - total % factor_;
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        float *w = work_[c];
+        arm_copy_f32(x + c * n, w + pending_, (uint32_t)n);
+        if (used) {
+            arm_fir_decimate_f32(&fir_[c], w, y + c * yStride, (uint32_t)used);
+            memmove(w, w + used, (total - used) * sizeof(float));
+        }
+    }
+    pending_ = total - used;
+    return used / factor_;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "arm_math.h"
+#include "DetectorParams.h"
+
+/*************************************
+ *  多速率前端：带通 + FIR 抽取        *
+ *  每轴先经 2 级 biquad（高通去重力 / *
+ *  直流、低通去高频），再经 FIR 低通  *
+ *  抽取到 fs / factor；状态跨块保留   *
+ *************************************/
+// 带通为两个二阶 Butterworth 节（RBJ 公式）：lowHz 高通 + highHz 低通，
+// 六个通道共用系数，用 arm_biquad_cascade_planar_df2T_f32 一次处理。
+// 抗混叠 FIR 为 TAPS 点 Hamming 窗 sinc，截止 0.48·fs/factor，直流增益归一化为 1；
+// 群时延为 (TAPS - 1) / 2 个输入采样；arm_fir_decimate_f32 的输出以每组 factor 个输入中的
+// 第一个为最新采样，总时延再加 factor - 1 个输入采样（见 frontend_check）。
+//
+// 输入块长度任意（<= BLOCK）：不足 factor 的余数留在内部，下次调用时先处理，
+// 因此任意分块得到的输出序列完全相同。
+class BandDecimator {
+public:
+    static constexpr int      STAGES     = 2;   // biquad 级数
+    static constexpr int      TAPS       = 32;  // 抗混叠 FIR 点数
+    static constexpr size_t   BLOCK      = 64;  // 每次 process() 最多输入的采样数（每通道）
+    static constexpr uint32_t MAX_FACTOR = 16;
+
+    // fs : 输入采样率（Hz）；factor : 抽取倍数（2 的幂，1..MAX_FACTOR）
+    explicit BandDecimator(float fs, uint32_t factor, float lowHz = 1.0f, float highHz = 15.0f);
+
+    // 清空滤波器状态与未凑满 factor 的余数
+    void reset();
+
+    // x 为 DET_CHANNELS 个通道的平面块（通道 c 位于 x[c * n]，n <= BLOCK），原地带通滤波；
+    // 抽取后的输出写到 y[c * yStride + i]，返回每通道的输出个数
+    size_t process(float *x, size_t n, float *y, size_t yStride);
+
+    // 已滤波但还没凑满 factor 的输入采样数（0..factor-1）
+    size_t pending() const { return pending_; }
+    uint32_t factor() const { return factor_; }
+
+    // biquad 系数 {b0 b1 b2 a1 a2} x STAGES（CMSIS 符号约定）与 FIR 系数，供频响 / 时延检查
+    const float *biquadCoeffs() const { return coeffs_; }
+    const float *firCoeffs() const { return taps_; }
+
+private:
+    uint32_t factor_;
+    size_t pending_;
+
+    float coeffs_[5 * STAGES];
+    float iirState_[2 * STAGES * DET_CHANNELS];
+    arm_biquad_cascade_planar_df2T_instance_f32 iir_;
+
+    float taps_[TAPS];
+    arm_fir_decimate_instance_f32 fir_[DET_CHANNELS];
+    float firState_[DET_CHANNELS][TAPS + BLOCK - 1];
+
+    // 各通道的余数 + 本次输入，凑成 factor 的整数倍后送入抽取器
+    float work_[DET_CHANNELS][BLOCK + MAX_FACTOR];
+};
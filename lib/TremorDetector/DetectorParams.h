@@ -0,0 +1,66 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/*********** 算法参数设置 ***********/
+// 多速率前端：DETECTOR_DECIMATE > 1 时每轴先经带通 biquad（去除重力 / 直流与高频）
+// 再经 FIR 抽取（BandDecimator），频谱在 DET_FS / DETECTOR_DECIMATE 上计算：
+// 窗口时长与频点间隔不变，FFT 长度默认同比缩小（4 → 26Hz、26 点窗口、64 点 FFT）
+#ifndef DETECTOR_DECIMATE
+#define DETECTOR_DECIMATE 1
+#endif
+
+#ifndef DETECTOR_FFT_LEN
+#define DETECTOR_FFT_LEN (256 / DETECTOR_DECIMATE)
+#endif
+
+constexpr uint32_t DET_FS   = 104;               // 采样频率（Hz）
+constexpr uint32_t DET_WIN_S = 1;                // 窗口大小（秒）
+constexpr size_t   DET_N    = DET_FS * DET_WIN_S;  // 每个窗口的采样点数
+constexpr size_t   DET_FFTN = DETECTOR_FFT_LEN;    // FFT点数
+constexpr int      DET_CHANNELS = 6;             // ax ay az gx gy gz
+
+// 频谱分析所在的采样率（不抽取时即 DET_FS）
+constexpr uint32_t DET_DECIM = DETECTOR_DECIMATE;
+constexpr uint32_t DET_FS_A  = DET_FS / DET_DECIM;   // 分析采样率（Hz）
+constexpr size_t   DET_N_A   = DET_N / DET_DECIM;    // 每个窗口的分析采样点数
+// 抽取后窗口只有 DET_N_A 点：幅度乘以抽取倍数，使阈值与 DET_FS 下的含义一致
+constexpr float    DET_DECIM_GAIN = (float)DET_DECIM;
+
+// 判定只用到 1..i7+2 频点（3-7Hz 峰值与 0-7Hz 带内 RMS），以上频点不计算
+constexpr int      DET_MAX_BIN = (int)(7.0f * DET_FFTN / DET_FS_A + 0.5f) + 2;
+
+// 不小于 n 的 2 的幂
+constexpr size_t detPow2AtLeast(size_t n, size_t p = 1) {
+    return p >= n ? p : detPow2AtLeast(n, 2 * p);
+}
+
+// log2(n)，n 为 2 的幂
+constexpr int detLog2(size_t n) {
+    return n <= 1 ? 0 : 1 + detLog2(n / 2);
+}
+
+static_assert(DET_FS % DET_DECIM == 0 && DET_N % DET_DECIM == 0, "decimation must divide the rate and the window");
+static_assert((DET_DECIM & (DET_DECIM - 1)) == 0, "decimation factor must be a power of two");
+static_assert(DET_N_A <= DET_FFTN, "window must fit in the FFT");
+static_assert(2 * DET_MAX_BIN <= (int)DET_FFTN, "analysis rate too low for the 3-7Hz band");
+static_assert(DET_FFTN % 2 == 0, "FFT length must be even");
+
+// DETECTOR_FFT_LEN 为 2 的幂时使用裁剪 FFT（零填充，3-7Hz 频带下由代价模型选完整变换）；
+// 否则使用任意长度实数 FFT，例如 104 = 窗口长度，频点间隔正好 1Hz
+#define DETECTOR_FFT_POW2 ((DETECTOR_FFT_LEN & (DETECTOR_FFT_LEN - 1)) == 0)
+
+// 编入检测器的频谱引擎（位掩码：1 = FFT，2 = 滑动 DFT，4 = q15）。各引擎共用一块存储，
+// 大小取编入引擎中最大者；默认全部编入，由 DetectorConfig::engine 运行时选择（主机工具）。
+// 固件只用一种引擎时只编入它才真正省 RAM，例如 q15：-DDETECTOR_ENGINES=4
+#ifndef DETECTOR_ENGINES
+#define DETECTOR_ENGINES 7
+#endif
+// q15 引擎需要 2 的幂 FFT 长度且不抽取；一个都不可用时保留浮点 FFT
+#define DETECTOR_HAS_Q15  (((DETECTOR_ENGINES) & 4) != 0 && DETECTOR_FFT_POW2 && DETECTOR_DECIMATE == 1)
+#define DETECTOR_HAS_SDFT (((DETECTOR_ENGINES) & 2) != 0)
+#define DETECTOR_HAS_FFT  (((DETECTOR_ENGINES) & 1) != 0 || !(DETECTOR_HAS_Q15 || DETECTOR_HAS_SDFT))
+
+/*********** 传感器量程换算 ***********/
+constexpr float ACC_LSB_G   = 0.000061f;  // ±2g 量程，g/LSB
+constexpr float GYR_LSB_DPS = 0.00875f;   // 245dps 量程，dps/LSB
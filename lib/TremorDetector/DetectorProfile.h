@@ -0,0 +1,53 @@
+#pragma once
+#include <stdint.h>
+
+/*************************************
+ *  检测核心分阶段计时（可选）         *
+ *  编译时加 -DDETECTOR_PROFILE=1 启用，*
+ *  否则所有标记展开为空语句           *
+ *************************************/
+// 阶段划分：
+//   STAGE_SCALE    缩放、减基线、写入环形缓冲（滑动 DFT 还包括逐样本频点更新），由调用方标记
+//   STAGE_FFT      取窗口、加窗与 FFT
+//   STAGE_MAG      复数幅度（滑动 DFT 为全部频谱计算）
+//   STAGE_PEAK     带内 RMS、峰值搜索与阈值比较
+//   STAGE_DECISION 强度限幅与稳定性判断
+enum DetectorStage {
+    STAGE_SCALE,
+    STAGE_FFT,
+    STAGE_MAG,
+    STAGE_PEAK,
+    STAGE_DECISION,
+    STAGE_COUNT
+};
+
+#ifndef DETECTOR_PROFILE
+#define DETECTOR_PROFILE 0
+#endif
+
+#if DETECTOR_PROFILE
+// 时钟由应用提供（主机端为 steady_clock 纳秒，MCU 上可用 DWT 周期计数）；
+// 为 nullptr 时标记只有一次判断，不计时
+extern uint64_t (*detProfileClock)();
+extern uint64_t detProfileTotal[STAGE_COUNT];  // 各阶段累计时间（时钟单位）
+extern uint64_t detProfileLast;                // 上一个标记的时刻
+
+static inline void detProfileStart() {
+    if (detProfileClock) detProfileLast = detProfileClock();
+}
+
+// 把上一个标记到现在的时间计入 stage
+static inline void detProfileMark(int stage) {
+    if (detProfileClock) {
+        const uint64_t t = detProfileClock();
+        detProfileTotal[stage] += t - detProfileLast;
+        detProfileLast = t;
+    }
+}
+
+#define DET_PROFILE_START()   detProfileStart()
+#define DET_PROFILE_MARK(s)   detProfileMark(s)
+#else
+#define DET_PROFILE_START()   ((void)0)
+#define DET_PROFILE_MARK(s)   ((void)0)
+#endif
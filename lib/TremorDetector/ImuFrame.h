@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+
+/*********** 一帧 6 轴原始采样 ***********/
+// 顺序固定为 [ax ay az gx gy gz]，单位为 LSM6DSL 原始 LSB
+struct ImuFrame {
+    int16_t acc[3];  // 加速度计 X/Y/Z
+    int16_t gyr[3];  // 陀螺仪 X/Y/Z
+};
+
+static_assert(sizeof(ImuFrame) == 12, "ImuFrame must stay packed as 6 x int16");
@@ -0,0 +1,92 @@
+#include "SlidingDft.h"
+#include <math.h>
+#include <string.h>
+
+SlidingDft::SlidingDft(size_t hop, uint32_t resync)
+    : hop_(hop < 1 ? 1 : hop), resync_(resync) {
+    // 调制序列按双精度生成一次，避免递推旋转因子引入的相位漂移
+    for (size_t i = 0; i < DET_FFTN; i++) {
+        double a = 2.0 * M_PI * i / DET_FFTN;
+        twc_[i] = (float)cos(a);
+        tws_[i] = (float)sin(a);
+    }
+    reset();
+}
+
+void SlidingDft::reset() {
+    memset(acc_, 0, sizeof(acc_));
+    memset(delay_, 0, sizeof(delay_));
+    head_ = 0;
+    phase_ = 0;
+    count_ = 0;
+    primed_ = 0;
+    since_ = 0;
+}
+
+/*********** 逐样本更新 ***********/
+bool SlidingDft::push(const float *x) {
+    // 新采样的相位为 phase_，被移出的采样相位为 phase_ - N
+    const uint32_t pn = phase_;
+    const uint32_t po = (phase_ + DET_FFTN - DET_N_A) % DET_FFTN;
+    float *old = delay_[head_];
+
+    // 频点 k 的旋转因子序号 k·pn、k·po (mod DET_FFTN) 与通道无关：按频点逐个累加 pn / po 步进，
+    // 每个频点取一次旋转因子，再更新全部通道
+    uint32_t in = (DET_SDFT_BIN_LO * pn) % DET_FFTN;
+    uint32_t io = (DET_SDFT_BIN_LO * po) % DET_FFTN;
+    for (int b = 0; b < DET_SDFT_BINS; b++) {
+        const float cn = twc_[in], sn = tws_[in], co = twc_[io], so = tws_[io];
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            const float xn = x[c], xo = old[c];
+            // Y += x_new·e^{-jθn} - x_old·e^{-jθo}
+            acc_[c][b][0] += xn * cn - xo * co;
+            acc_[c][b][1] -= xn * sn - xo * so;
+        }
+        if ((in += pn) >= DET_FFTN) in -= DET_FFTN;
+        if ((io += po) >= DET_FFTN) io -= DET_FFTN;
+    }
+    for (int c = 0; c < DET_CHANNELS; c++) old[c] = x[c];
+    if (++head_ == DET_N_A) head_ = 0;
+    phase_ = (phase_ + 1) % DET_FFTN;
+
+    if (resync_ && ++count_ >= resync_) resync();
+
+    if (primed_ < DET_N_A) {
+        if (++primed_ < DET_N_A) return false;
+    } else if (++since_ < hop_) {
+        return false;
+    }
+    since_ = 0;
+    return true;
+}
+
+/*********** 重新同步 ***********/
+void SlidingDft::resync() {
+    count_ = 0;
+    memset(acc_, 0, sizeof(acc_));
+    // head_ 指向最老的采样，其相位为 phase_ - N
+    uint32_t ph = (phase_ + DET_FFTN - DET_N_A) % DET_FFTN;
+    size_t s = head_;
+    for (size_t m = 0; m < DET_N_A; m++) {
+        const float *x = delay_[s];
+        uint32_t i = (DET_SDFT_BIN_LO * ph) % DET_FFTN;
+        for (int b = 0; b < DET_SDFT_BINS; b++) {
+            const float c = twc_[i], sn = tws_[i];
+            for (int ch = 0; ch < DET_CHANNELS; ch++) {
+                acc_[ch][b][0] += x[ch] * c;
+                acc_[ch][b][1] -= x[ch] * sn;
+            }
+            if ((i += ph) >= DET_FFTN) i -= DET_FFTN;
+        }
+        if (++s == DET_N_A) s = 0;
+        ph = (ph + 1) % DET_FFTN;
+    }
+}
+
+/*********** 幅度输出 ***********/
+void SlidingDft::magnitude(int ch, float *mag) const {
+    const float (*a)[2] = acc_[ch];
+    for (int b = 0; b < DET_SDFT_BINS; b++) {
+        mag[DET_SDFT_BIN_LO + b] = sqrtf(a[b][0] * a[b][0] + a[b][1] * a[b][1]) * DET_DECIM_GAIN;
+    }
+}
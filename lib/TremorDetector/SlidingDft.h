@@ -0,0 +1,60 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "DetectorParams.h"
+
+/*************************************
+ *  滑动 DFT（调制型）                 *
+ *  只维护 3-7Hz 判定用到的 FFT 频点   *
+ *  (1..i7+2)，每个采样 O(频点数) 更新 *
+ *************************************/
+// 频点位于 DET_FFTN 点 FFT 的网格上、窗口为最近 DET_N_A 个采样（矩形窗，
+// 采样率 DET_FS_A），幅度乘 DET_DECIM_GAIN 后与 Stft::RECT 的零填充 FFT 一致。
+//
+// 采用调制形式 Y_n(k) = Σ x[m]·e^{-j2πkm/FFTN}（m 为绝对采样序号）：
+// 更新只有加减，没有单位圆上的反馈极点，因此不会发散；
+// 浮点舍入误差按随机游走累积，每 DET_SDFT_RESYNC 个采样由延迟线重新求和清零。
+constexpr int DET_SDFT_BIN_LO = 1;
+constexpr int DET_SDFT_BIN_HI = DET_MAX_BIN;
+constexpr int DET_SDFT_BINS   = DET_SDFT_BIN_HI - DET_SDFT_BIN_LO + 1;
+constexpr uint32_t DET_SDFT_RESYNC = 4096;  // 重新同步间隔（分析采样），104Hz 下约 40 s
+
+class SlidingDft {
+public:
+    // hop : 每隔多少个采样请求一次判定（1 即逐样本判定）
+    // resync : 重新同步间隔，0 表示从不（仅用于漂移测试）
+    explicit SlidingDft(size_t hop = 1, uint32_t resync = DET_SDFT_RESYNC);
+
+    void reset();
+
+    // 写入一组 DET_CHANNELS 通道的采样；历史满 DET_N_A 个且距上次满 hop 个时返回 true
+    bool push(const float *x);
+
+    // 距下次判定还需写入的采样数（>= 1）
+    size_t samplesToFrame() const { return primed_ < DET_N_A ? DET_N_A - primed_ : hop_ - since_; }
+
+    // 输出通道 ch 的幅度；只写 mag[DET_SDFT_BIN_LO..DET_SDFT_BIN_HI]
+    void magnitude(int ch, float *mag) const;
+
+    // 由延迟线重新计算全部频点
+    void resync();
+
+    size_t hop() const { return hop_; }
+
+private:
+    float twc_[DET_FFTN];  // cos(2πi/FFTN)
+    float tws_[DET_FFTN];  // sin(2πi/FFTN)
+
+    // 各通道的频点状态连续存放：[通道][频点][实部, 虚部]
+    float acc_[DET_CHANNELS][DET_SDFT_BINS][2];
+    // 延迟线按采样组存放：[位置][通道]
+    float delay_[DET_N_A][DET_CHANNELS];
+
+    size_t hop_;
+    uint32_t resync_;
+    size_t head_;       // 延迟线中最老采样的位置（即下一个写入位置）
+    uint32_t phase_;    // 下一个采样的绝对序号 mod DET_FFTN
+    uint32_t count_;    // 距上次重新同步的采样数
+    size_t primed_;
+    size_t since_;
+};
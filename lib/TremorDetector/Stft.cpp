@@ -0,0 +1,108 @@
+#include "Stft.h"
+#include "DetectorProfile.h"
+#include <string.h>
+
+Stft::Stft(size_t hop, Window window)
+    : hop_(hop < 1 ? 1 : (hop > DET_N_A ? DET_N_A : hop)), window_(window) {
+#if DETECTOR_FFT_POW2
+    arm_rfft_pruned_init_f32(&fft_, DET_FFTN, DET_MAX_BIN);
+#else
+    arm_rfft_mixed_init_f32(&fft_, DET_FFTN, fftState_, sizeof(fftState_) / sizeof(float));
+#endif
+
+    // 分析窗只计算一次；归一化到 sum(w) = DET_N，阈值在两种窗下含义一致。
+    // 抽取后窗口只有 DET_N_A 点，同一归一化即含 DET_DECIM_GAIN 倍的幅度补偿
+    if (window_ == HANN) {
+        arm_hanning_f32(win_, DET_N_A);
+        float sum = 0;
+        for (size_t i = 0; i < DET_N_A; i++) sum += win_[i];
+        arm_scale_f32(win_, (float)DET_N / sum, win_, DET_N_A);
+    } else {
+        arm_fill_f32(DET_DECIM_GAIN, win_, DET_N_A);
+    }
+    reset();
+}
+
+void Stft::reset() {
+    memset(ring_, 0, sizeof(ring_));
+    // 零填充部分保持为 0（裁剪 FFT 不改写输入；完整变换会改写，每帧重新清零）
+    memset(frame_, 0, sizeof(frame_));
+    pos_ = 0;
+    primed_ = 0;
+    since_ = 0;
+    frames_ = 0;
+}
+
+/*********** 采样输入 ***********/
+bool Stft::push(const float *x) {
+    const uint32_t w = pos_ & (RING - 1);
+    for (int c = 0; c < DET_CHANNELS; c++) ring_[c][w] = x[c];
+    return advance(1);
+}
+
+bool Stft::pushCounts(const int16_t *frames, size_t n, const float *scale, const float *bias) {
+    // 在环形缓冲回绕处最多分两段，每段由一次内核调用完成换算与转置
+    size_t done = 0;
+    while (done < n) {
+        const uint32_t w = (pos_ + done) & (RING - 1);
+        const size_t len = n - done < RING - w ? n - done : RING - w;
+        arm_deinterleave_q15_to_float(frames + done * DET_CHANNELS, DET_CHANNELS, scale, bias,
+                                      &ring_[0][w], RING, len);
+        done += len;
+    }
+    return advance(n);
+}
+
+bool Stft::pushBlock(const float *x, size_t stride, size_t n) {
+    size_t done = 0;
+    while (done < n) {
+        const uint32_t w = (pos_ + done) & (RING - 1);
+        const size_t len = n - done < RING - w ? n - done : RING - w;
+        for (int c = 0; c < DET_CHANNELS; c++) arm_copy_f32(x + c * stride + done, &ring_[c][w], len);
+        done += len;
+    }
+    return advance(n);
+}
+
+bool Stft::advance(size_t n) {
+    pos_ += n;
+
+    // 第一帧需要完整的 DET_N_A 个采样，之后每 hop 个采样一帧
+    if (primed_ < DET_N_A) {
+        if ((primed_ += n) < DET_N_A) return false;
+    } else if ((since_ += n) < hop_) {
+        return false;
+    }
+    since_ = 0;
+    ++frames_;
+    return true;
+}
+
+/*********** 单通道频谱 ***********/
+void Stft::magnitude(int ch, float *mag) {
+    // 取出最近 DET_N_A 个采样（环形缓冲中最多分两段）并加窗
+    const float *src = ring_[ch];
+    const uint32_t start = (pos_ - DET_N_A) & (RING - 1);
+    const size_t first = RING - start < DET_N_A ? RING - start : DET_N_A;
+    arm_mult_f32(src + start, win_, frame_, first);
+    if (first < DET_N_A) arm_mult_f32(src, win_ + first, frame_ + first, DET_N_A - first);
+
+    const float *spec = spec_;
+#if DETECTOR_FFT_POW2
+    if (fft_.numSub == 1) {
+        // 代价模型选了完整变换：frame_ 本就是工作缓冲，直接原地变换，省去裁剪 FFT 的输入拷贝
+        memset(frame_ + DET_N_A, 0, (DET_FFTN - DET_N_A) * sizeof(float));
+        arm_rfft_fast_f32(&fft_.Sub, frame_, scratch_, 0);
+        scratch_[1] = 0;  // bin 0 的虚部位置存放的是 Nyquist 频点
+        spec = scratch_;
+    } else {
+        arm_rfft_pruned_f32(&fft_, frame_, spec_, scratch_);
+    }
+#else
+    arm_rfft_mixed_f32(&fft_, frame_, spec_, scratch_, 0);
+    spec_[1] = 0;  // bin 0 的虚部位置存放的是 Nyquist 频点
+#endif
+    DET_PROFILE_MARK(STAGE_FFT);
+    arm_cmplx_mag_f32(spec, mag, DET_MAX_BIN + 1);
+    DET_PROFILE_MARK(STAGE_MAG);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "arm_math.h"
+#include "DetectorParams.h"
+
+/*************************************
+ *  流式短时傅里叶变换 (STFT)          *
+ *  每通道保留最近 DET_N_A 个以上采样  *
+ *  的环形缓冲，每 hop 个采样对最近    *
+ *  DET_N_A 个采样加窗、零填充后做 FFT *
+ *  （只计算 0..DET_MAX_BIN 频点）     *
+ *************************************/
+class Stft {
+public:
+    enum Window { RECT, HANN };
+
+    // hop    : 相邻两帧频谱之间的采样数（1..DET_N_A；DET_N_A 即不重叠）
+    // window : 分析窗；加窗后按 DET_N/sum(w) 归一化，使正弦峰值幅度与矩形窗一致
+    // 采样率为 DET_FS_A（抽取时采样来自 BandDecimator），幅度与 DET_FS 下 DET_N 点窗口一致
+    explicit Stft(size_t hop = DET_N_A, Window window = RECT);
+
+    // 清空历史，重新累积一个完整窗口
+    void reset();
+
+    // 写入一组 DET_CHANNELS 通道的采样；历史满 DET_N_A 个且距上一帧满 hop 个时返回 true
+    bool push(const float *x);
+
+    // 写入 n 帧交错的原始计数 [ax ay az gx gy gz]，按通道乘 scale 加 bias 后直接写入环形缓冲
+    // （arm_deinterleave_q15_to_float 整块一次完成）。n 不得超过 samplesToFrame()；返回值同 push
+    bool pushCounts(const int16_t *frames, size_t n, const float *scale, const float *bias);
+
+    // 写入 n 个已换算的采样，通道 c 的第 i 个采样位于 x[c * stride + i]。n 不得超过 samplesToFrame()
+    bool pushBlock(const float *x, size_t stride, size_t n);
+
+    // 距下一帧频谱还需写入的采样数（>= 1）
+    size_t samplesToFrame() const { return primed_ < DET_N_A ? DET_N_A - primed_ : hop_ - since_; }
+
+    // 对通道 ch 当前窗口做 FFT，输出 mag[0..DET_MAX_BIN]
+    void magnitude(int ch, float *mag);
+
+    size_t hop() const { return hop_; }
+    Window window() const { return window_; }
+    uint32_t frames() const { return frames_; }  // 已输出的频谱帧数
+
+private:
+    // 写入位置前进 n 个采样，返回是否凑满一帧
+    bool advance(size_t n);
+
+    // 环形缓冲长度：不小于 DET_N_A 的 2 的幂，取模时用掩码
+    static constexpr size_t RING = detPow2AtLeast(DET_N_A);
+
+#if DETECTOR_FFT_POW2
+    arm_rfft_pruned_instance_f32 fft_;
+#else
+    arm_rfft_mixed_instance_f32 fft_;
+    float fftState_[ARM_RFFT_MIXED_STATE_LEN_MAX(DET_FFTN)];  // 预先计算的 FFT 计划
+#endif
+    size_t hop_;
+    Window window_;
+
+    float ring_[DET_CHANNELS][RING];      // 各通道历史采样
+    float win_[DET_N_A];                  // 缓存的分析窗（已含归一化）
+    float frame_[DET_FFTN];               // 加窗 + 零填充后的 FFT 输入
+#if DETECTOR_FFT_POW2
+    float spec_[2 * (DET_MAX_BIN + 1)];   // FFT 输出（复数）
+    float scratch_[2 * DET_FFTN];         // 裁剪 FFT 的工作区（最多 2 * fftLenSub）；完整变换时存放输出
+#else
+    float spec_[DET_FFTN];                // FFT 输出（arm_rfft_fast_f32 格式）
+    float scratch_[ARM_RFFT_MIXED_SCRATCH_LEN_MAX(DET_FFTN)];
+#endif
+
+    uint32_t pos_;       // 下一个写入位置（自由递增，取模时用掩码）
+    size_t primed_;      // 历史采样数（满 DET_N_A 后不再增加）
+    size_t since_;       // 距上一帧频谱的采样数
+    uint32_t frames_;
+};
@@ -0,0 +1,94 @@
+#include "DetectorParams.h"
+#if DETECTOR_FFT_POW2  // arm_rfft_q15 只支持 2 的幂长度
+#include "StftQ15.h"
+#include "DetectorProfile.h"
+#include <math.h>
+#include <string.h>
+
+StftQ15::StftQ15(size_t hop, Stft::Window window)
+    : hop_(hop < 1 ? 1 : (hop > DET_N_A ? DET_N_A : hop)), window_(window) {
+    arm_rfft_init_q15(&fft_, DET_FFTN, 0, 1);
+
+    // 归一化到 sum(w) = DET_N_A（抽取倍数计入 MAG_EXP），再缩小 2^WIN_SHIFT 以放入 q15
+    float w[DET_N_A];
+    if (window_ == Stft::HANN) {
+        arm_hanning_f32(w, DET_N_A);
+        float sum = 0;
+        for (size_t i = 0; i < DET_N_A; i++) sum += w[i];
+        arm_scale_f32(w, (float)DET_N_A / sum, w, DET_N_A);
+    } else {
+        arm_fill_f32(1.0f, w, DET_N_A);
+    }
+    for (size_t i = 0; i < DET_N_A; i++) {
+        long v = lrintf(w[i] * (32768.0f / (1 << WIN_SHIFT)));
+        win_[i] = (q15_t)(v > 32767 ? 32767 : v);
+    }
+    reset();
+}
+
+void StftQ15::reset() {
+    memset(ring_, 0, sizeof(ring_));
+    memset(frame_, 0, sizeof(frame_));
+    pos_ = 0;
+    primed_ = 0;
+    since_ = 0;
+    frames_ = 0;
+}
+
+/*********** 采样输入 ***********/
+bool StftQ15::push(const q15_t *x) {
+    const uint32_t w = pos_ & (RING - 1);
+    for (int c = 0; c < DET_CHANNELS; c++) ring_[c][w] = x[c];
+    return advance(1);
+}
+
+bool StftQ15::pushCounts(const int16_t *frames, size_t n, const q15_t *bias) {
+    // 单位比例（0x4000 * 2^1）：只减基线并饱和
+    static const q15_t unit[DET_CHANNELS] = {0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000};
+    size_t done = 0;
+    while (done < n) {
+        const uint32_t w = (pos_ + done) & (RING - 1);
+        const size_t len = n - done < RING - w ? n - done : RING - w;
+        arm_deinterleave_q15(frames + done * DET_CHANNELS, DET_CHANNELS, unit, 1, bias,
+                             &ring_[0][w], RING, len);
+        done += len;
+    }
+    return advance(n);
+}
+
+bool StftQ15::advance(size_t n) {
+    pos_ += n;
+
+    if (primed_ < DET_N_A) {
+        if ((primed_ += n) < DET_N_A) return false;
+    } else if ((since_ += n) < hop_) {
+        return false;
+    }
+    since_ = 0;
+    ++frames_;
+    return true;
+}
+
+/*********** 单通道频谱 ***********/
+int StftQ15::magnitude(int ch, q15_t *mag) {
+    const q15_t *src = ring_[ch];
+    const uint32_t start = (pos_ - DET_N_A) & (RING - 1);
+    const size_t first = RING - start < DET_N_A ? RING - start : DET_N_A;
+    arm_mult_q15(src + start, win_, frame_, first);
+    if (first < DET_N_A) arm_mult_q15(src, win_ + first, frame_ + first, DET_N_A - first);
+    // 上一帧的 FFT 改写了输入缓冲，补零部分需要重新清零
+    memset(frame_ + DET_N_A, 0, (DET_FFTN - DET_N_A) * sizeof(q15_t));
+
+    // 块浮点：把本帧最大值左移到 q15 满量程附近，避免 FFT 逐级缩放后只剩几位有效数字
+    q15_t peak;
+    arm_absmax_no_idx_q15(frame_, DET_N_A, &peak);
+    int shift = peak > 0 ? (int)__CLZ((uint32_t)peak) - 17 : 0;
+    if (shift > 0) arm_shift_q15(frame_, (int8_t)shift, frame_, DET_N_A);
+
+    arm_rfft_q15(&fft_, frame_, spec_);
+    DET_PROFILE_MARK(STAGE_FFT);
+    arm_cmplx_mag_q15(spec_, mag, DET_MAX_BIN + 1);
+    DET_PROFILE_MARK(STAGE_MAG);
+    return shift;
+}
+#endif
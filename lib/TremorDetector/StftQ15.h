@@ -0,0 +1,63 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "arm_math.h"
+#include "DetectorParams.h"
+#include "Stft.h"
+
+/*************************************
+ *  q15 定点 STFT                     *
+ *  直接缓存传感器原始计数（减去基线）  *
+ *  用 arm_rfft_q15 做变换；每帧按块    *
+ *  浮点归一化，输出 q15 幅度 + 指数    *
+ *  只支持 2 的幂 FFT 长度            *
+ *************************************/
+class StftQ15 {
+public:
+    // 分析窗按 2^-WIN_SHIFT 缩放后存为 q15（归一化后的 Hann 窗峰值约为 2）
+    static constexpr int WIN_SHIFT = 2;
+    // 幅度换算：计数 * 采样 = mag[k] * 2^(MAG_EXP - shift)
+    // arm_rfft_q15 缩小 DET_FFTN 倍，arm_cmplx_mag_q15 输出 2.14 格式再缩小 2 倍
+    // 抽取时窗口只有 DET_N_A 点，再乘 DET_DECIM（与 Stft 的 DET_DECIM_GAIN 相同）
+    static constexpr int MAG_EXP = detLog2(DET_FFTN) + 1 + WIN_SHIFT + detLog2(DET_DECIM);
+
+    // 参数含义与 Stft 相同
+    explicit StftQ15(size_t hop = DET_N_A, Stft::Window window = Stft::RECT);
+
+    void reset();
+
+    // 写入一组 DET_CHANNELS 通道的计数；返回值与 Stft::push 相同
+    bool push(const q15_t *x);
+
+    // 写入 n 帧交错的原始计数，按通道加 bias 后饱和（arm_deinterleave_q15 整块一次完成）；
+    // n 不得超过 samplesToFrame()
+    bool pushCounts(const int16_t *frames, size_t n, const q15_t *bias);
+
+    size_t samplesToFrame() const { return primed_ < DET_N_A ? DET_N_A - primed_ : hop_ - since_; }
+
+    // 对通道 ch 当前窗口做 q15 FFT，输出 mag[0..DET_MAX_BIN]，返回块浮点左移位数 shift
+    int magnitude(int ch, q15_t *mag);
+
+    size_t hop() const { return hop_; }
+    Stft::Window window() const { return window_; }
+    uint32_t frames() const { return frames_; }
+
+private:
+    bool advance(size_t n);
+
+    static constexpr size_t RING = detPow2AtLeast(DET_N_A);
+
+    arm_rfft_instance_q15 fft_;
+    size_t hop_;
+    Stft::Window window_;
+
+    q15_t ring_[DET_CHANNELS][RING];      // 各通道历史计数（RAM 为浮点版的一半）
+    q15_t win_[DET_N_A];                  // q15 分析窗（已含归一化与 2^-WIN_SHIFT）
+    q15_t frame_[DET_FFTN];               // FFT 输入（arm_rfft_q15 会改写，每帧重新零填充）
+    q15_t spec_[2 * DET_FFTN];            // FFT 输出（完整复数频谱）
+
+    uint32_t pos_;
+    size_t primed_;
+    size_t since_;
+    uint32_t frames_;
+};
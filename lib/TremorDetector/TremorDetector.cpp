@@ -0,0 +1,368 @@
+#include "TremorDetector.h"
+#include "DetectorProfile.h"
+#include <math.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+
+#if DETECTOR_PROFILE
+uint64_t (*detProfileClock)() = nullptr;
+uint64_t detProfileTotal[STAGE_COUNT];
+uint64_t detProfileLast;
+#endif
+
+// cfg.hop 按传感器采样计；频谱在 DET_FS_A 上计算，换算为分析采样（四舍五入，至少 1）
+static size_t analysisHop(size_t hop) {
+    const size_t h = (hop + DET_DECIM / 2) / DET_DECIM;
+    return h < 1 ? 1 : h;
+}
+
+// 共用存储中的引擎不会被析构
+static_assert(std::is_trivially_destructible<TremorDetector>::value, "spectrum engines must be trivially destructible");
+
+// 选中的引擎未编入时改用已编入的引擎
+static DetectorEngine availableEngine(DetectorEngine e) {
+    if (e == ENGINE_Q15 && DETECTOR_HAS_Q15) return e;
+    if (e == ENGINE_SDFT && DETECTOR_HAS_SDFT) return e;
+    return DETECTOR_HAS_FFT ? ENGINE_FFT : DETECTOR_HAS_Q15 ? ENGINE_Q15 : ENGINE_SDFT;
+}
+
+const char *const TremorDetector::CHANNEL_TAGS[DET_CHANNELS] = {
+    "AX", "AY", "AZ", "GX", "GY", "GZ"
+};
+
+TremorDetector::TremorDetector(const DetectorConfig &cfg)
+    : cfg_(cfg),
+#if DETECTOR_DECIMATE > 1
+      front_((float)DET_FS, DET_DECIM),
+#endif
+      baseline_count_(0), is_calibrated_(false),
+      stable_tremor_(0), stable_dyskinesia_(0) {
+    // 只构造选中的频谱引擎（任意长度 FFT 没有 q15 实现、q15 路径也没有抽取前端）
+    cfg_.engine = availableEngine(cfg.engine);
+    switch (cfg_.engine) {
+#if DETECTOR_HAS_Q15
+    case ENGINE_Q15:  new (&stftq_) StftQ15(analysisHop(cfg.hop), cfg.window); break;
+#endif
+#if DETECTOR_HAS_SDFT
+    case ENGINE_SDFT: new (&sdft_) SlidingDft(analysisHop(cfg.hop)); break;
+#endif
+#if DETECTOR_HAS_FFT
+    case ENGINE_FFT:  new (&stft_) Stft(analysisHop(cfg.hop), cfg.window); break;
+#endif
+    default: break;
+    }
+    memset(baseline_acc_, 0, sizeof(baseline_acc_));
+    memset(baseline_gyr_, 0, sizeof(baseline_gyr_));
+    memset(baseline_cnt_, 0, sizeof(baseline_cnt_));
+    memset(bias_, 0, sizeof(bias_));
+    memset(bias_cnt_, 0, sizeof(bias_cnt_));
+    arm_fill_f32(ACC_LSB_G, scale_, 3);
+    arm_fill_f32(GYR_LSB_DPS, scale_ + 3, 3);
+    memset(&result_, 0, sizeof(result_));
+
+    // FFT 频点（FFT 由频谱引擎完成初始化）
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+    memset(mag_, 0, sizeof(mag_));
+#endif
+#if DETECTOR_HAS_Q15
+    memset(magq_, 0, sizeof(magq_));
+    memset(shiftq_, 0, sizeof(shiftq_));
+#endif
+    i3_ = roundf(3.0f * DET_FFTN / DET_FS_A);  // 3Hz对应的FFT bin
+    i5_ = roundf(5.0f * DET_FFTN / DET_FS_A);  // 5Hz对应的FFT bin
+    i7_ = roundf(7.0f * DET_FFTN / DET_FS_A);  // 7Hz对应的FFT bin
+}
+
+/*********** 基线校准 ***********/
+void TremorDetector::accumulateBaseline(const ImuFrame &f) {
+    for (int i = 0; i < 3; i++) {
+        baseline_acc_[i] += f.acc[i] * ACC_LSB_G;
+        baseline_gyr_[i] += f.gyr[i] * GYR_LSB_DPS;
+    }
+    ++baseline_count_;
+}
+
+void TremorDetector::finishCalibration() {
+    // 计算基线平均值
+    if (baseline_count_ > 0) {
+        for (int i = 0; i < 3; i++) {
+            baseline_acc_[i] /= baseline_count_;
+            baseline_gyr_[i] /= baseline_count_;
+            baseline_cnt_[i]     = (int16_t)lrintf(baseline_acc_[i] / ACC_LSB_G);
+            baseline_cnt_[3 + i] = (int16_t)lrintf(baseline_gyr_[i] / GYR_LSB_DPS);
+        }
+    }
+    // 换算内核按 x * scale + bias 计算，基线以相反数存入 bias
+    for (int i = 0; i < 3; i++) {
+        bias_[i]     = -baseline_acc_[i];
+        bias_[3 + i] = -baseline_gyr_[i];
+    }
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        bias_cnt_[c] = (q15_t)__SSAT(-(int32_t)baseline_cnt_[c], 16);
+    }
+    is_calibrated_ = true;
+}
+
+/*********** 采样输入 ***********/
+bool TremorDetector::pushSample(const ImuFrame &f) {
+    bool ready;
+    pushFrames(&f, 1, ready);
+    return ready;
+}
+
+size_t TremorDetector::pushFrames(const ImuFrame *f, size_t n, bool &ready) {
+    ready = false;
+    if (n == 0) return 0;
+    // ImuFrame 数组即连续的 [ax ay az gx gy gz] int16 交错帧
+    const int16_t *raw = f[0].acc;
+#if DETECTOR_HAS_Q15
+    if (cfg_.engine == ENGINE_Q15) {
+        // 直接使用原始计数，减去基线后饱和到 16 位
+        const size_t m = n < stftq_.samplesToFrame() ? n : stftq_.samplesToFrame();
+        ready = stftq_.pushCounts(raw, m, bias_cnt_);
+        return m;
+    }
+#endif
+#if DETECTOR_DECIMATE > 1
+    return pushDecimated(raw, n, ready);
+#else
+#if DETECTOR_HAS_SDFT
+    if (cfg_.engine == ENGINE_SDFT) {
+        // 滑动 DFT 逐样本更新频点，逐帧换算
+        size_t i = 0;
+        while (i < n && !ready) {
+            float x[DET_CHANNELS];
+            arm_deinterleave_q15_to_float(raw + i * DET_CHANNELS, DET_CHANNELS, scale_, bias_, x, 1, 1);
+            ready = sdft_.push(x);
+            ++i;
+        }
+        return i;
+    }
+#endif
+#if DETECTOR_HAS_FFT
+    // 数据缩放和基线校正：整块写入 STFT 环形缓冲
+    const size_t m = n < stft_.samplesToFrame() ? n : stft_.samplesToFrame();
+    ready = stft_.pushCounts(raw, m, scale_, bias_);
+    return m;
+#else
+    return 0;
+#endif
+#endif
+}
+
+#if DETECTOR_DECIMATE > 1
+/*********** 抽取输入 ***********/
+size_t TremorDetector::pushDecimated(const int16_t *raw, size_t n, bool &ready) {
+    // 只消耗凑出下一帧所需的输入：恰好产生 samplesToFrame() 个抽取输出时 ready
+#if DETECTOR_HAS_SDFT && DETECTOR_HAS_FFT
+    const size_t toFrame = cfg_.engine == ENGINE_SDFT ? sdft_.samplesToFrame() : stft_.samplesToFrame();
+#elif DETECTOR_HAS_SDFT
+    const size_t toFrame = sdft_.samplesToFrame();
+#else
+    const size_t toFrame = stft_.samplesToFrame();
+#endif
+    size_t m = toFrame * DET_DECIM - front_.pending();
+    if (m > n) m = n;
+    if (m > BandDecimator::BLOCK) m = BandDecimator::BLOCK;
+
+    // 换算为平面块（通道 c 位于 blk_[c * m]），带通 + 抽取
+    arm_deinterleave_q15_to_float(raw, DET_CHANNELS, scale_, bias_, blk_, m, m);
+    const size_t k = front_.process(blk_, m, dec_[0], DEC_LEN);
+
+#if DETECTOR_HAS_SDFT
+    if (cfg_.engine == ENGINE_SDFT) {
+        for (size_t i = 0; i < k; i++) {
+            float x[DET_CHANNELS];
+            for (int c = 0; c < DET_CHANNELS; c++) x[c] = dec_[c][i];
+            ready = sdft_.push(x);
+        }
+        return m;
+    }
+#endif
+#if DETECTOR_HAS_FFT
+    if (k > 0) ready = stft_.pushBlock(dec_[0], DEC_LEN, k);
+#endif
+    return m;
+}
+#endif
+
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+/*********** 单通道分析 ***********/
+void TremorDetector::analyzeChannel(int ch, float tth, float dth, float scale) {
+    // 执行FFT（滑动 DFT 只更新下面用到的 1..i7+2 频点）
+    float *mag = mag_[ch];
+#if DETECTOR_HAS_SDFT
+    if (cfg_.engine == ENGINE_SDFT) {
+        sdft_.magnitude(ch, mag);
+        DET_PROFILE_MARK(STAGE_MAG);
+    }
+#endif
+#if DETECTOR_HAS_FFT
+    if (cfg_.engine == ENGINE_FFT) stft_.magnitude(ch, mag);
+#endif
+
+    // 计算RMS值
+    float rms = 0;
+    for (int k = 1; k < i7_ + 3; k++) {
+        rms += mag[k] * mag[k];
+    }
+    rms = sqrtf(rms / (i7_ + 2));
+
+    // 寻找峰值
+    float p35 = 0, p57 = 0;
+    int k35 = i3_, k57 = i5_;
+    for (int k = i3_; k <= i5_; k++) {
+        if (mag[k] > p35) { p35 = mag[k]; k35 = k; }
+    }
+    for (int k = i5_; k <= i7_; k++) {
+        if (mag[k] > p57) { p57 = mag[k]; k57 = k; }
+    }
+
+    ChannelSummary &s = result_.ch[ch];
+    s.p35 = p35;
+    s.f35 = k35 * (float)DET_FS_A / DET_FFTN;
+    s.p57 = p57;
+    s.f57 = k57 * (float)DET_FS_A / DET_FFTN;
+    s.rms = rms;
+
+    // 阈值判断逻辑
+    if (p35 >= tth && p35 / rms > cfg_.peakToRms && rms > tth * 0.3f) {
+        result_.tremor = true;
+        result_.levelT = fmaxf(result_.levelT, p35 / scale);
+    }
+    if (p57 >= dth && p57 / rms > cfg_.peakToRms && rms > dth * 0.3f) {
+        result_.dyskinesia = true;
+        result_.levelD = fmaxf(result_.levelD, p57 / scale);
+    }
+    DET_PROFILE_MARK(STAGE_PEAK);
+}
+#endif
+
+#if DETECTOR_HAS_Q15
+/*********** 单通道分析（q15） ***********/
+// 幅度为 q15 块浮点：计数 * 采样 = mag * 2^(MAG_EXP - shift)。
+// 阈值换算为 q15 幅度单位（8 位小数）后与 mag 比较，判定全部在整数域完成；
+// 只有写入 ChannelSummary / 强度时才转换为物理单位
+void TremorDetector::analyzeChannelQ15(int ch, float tth, float dth, float scale, float lsb) {
+    q15_t *magq = magq_[ch];
+    const int shift = shiftq_[ch] = stftq_.magnitude(ch, magq);
+    const float toQ = ldexpf(1.0f / lsb, 8 - StftQ15::MAG_EXP);
+    const uint64_t thT  = (uint64_t)lrintf(tth * toQ) << shift;
+    const uint64_t thD  = (uint64_t)lrintf(dth * toQ) << shift;
+    const uint64_t rmsT = (uint64_t)lrintf(tth * 0.3f * toQ) << shift;
+    const uint64_t rmsD = (uint64_t)lrintf(dth * 0.3f * toQ) << shift;
+    const uint64_t ratio2 = (uint64_t)lrintf(cfg_.peakToRms * cfg_.peakToRms * 256.0f);
+
+    // 带内能量（不开方）
+    const uint32_t nb = (uint32_t)(i7_ + 2);
+    uint64_t sumsq = 0;
+    for (int k = 1; k < i7_ + 3; k++) {
+        sumsq += (uint32_t)((int32_t)magq[k] * magq[k]);
+    }
+
+    q15_t p35 = 0, p57 = 0;
+    int k35 = i3_, k57 = i5_;
+    for (int k = i3_; k <= i5_; k++) {
+        if (magq[k] > p35) { p35 = magq[k]; k35 = k; }
+    }
+    for (int k = i5_; k <= i7_; k++) {
+        if (magq[k] > p57) { p57 = magq[k]; k57 = k; }
+    }
+
+    const float unit = ldexpf(lsb, StftQ15::MAG_EXP - shift);
+    ChannelSummary &s = result_.ch[ch];
+    s.p35 = p35 * unit;
+    s.f35 = k35 * (float)DET_FS_A / DET_FFTN;
+    s.p57 = p57 * unit;
+    s.f57 = k57 * (float)DET_FS_A / DET_FFTN;
+    s.rms = sqrtf((float)sumsq / nb) * unit;
+
+    // p >= th; p / rms > r  <=>  p^2 * n > r^2 * sumsq; rms > 0.3th  <=>  sumsq > n * (0.3th)^2
+    auto detect = [&](q15_t p, uint64_t th, uint64_t rmsTh) {
+        return ((uint64_t)p << 8) >= th &&
+               (uint64_t)p * p * nb * 256 > ratio2 * sumsq &&
+               (sumsq << 16) > nb * rmsTh * rmsTh;
+    };
+    if (detect(p35, thT, rmsT)) {
+        result_.tremor = true;
+        result_.levelT = fmaxf(result_.levelT, s.p35 / scale);
+    }
+    if (detect(p57, thD, rmsD)) {
+        result_.dyskinesia = true;
+        result_.levelD = fmaxf(result_.levelD, s.p57 / scale);
+    }
+    DET_PROFILE_MARK(STAGE_PEAK);
+}
+#endif
+
+/*********** 频谱输出 ***********/
+void TremorDetector::spectrum(int ch, float *mag) const {
+#if DETECTOR_HAS_Q15
+    if (cfg_.engine == ENGINE_Q15) {
+        const float lsb = ch < 3 ? ACC_LSB_G : GYR_LSB_DPS;
+        const float unit = ldexpf(lsb, StftQ15::MAG_EXP - shiftq_[ch]);
+        for (int k = 0; k <= DET_MAX_BIN; k++) mag[k] = magq_[ch][k] * unit;
+        return;
+    }
+#endif
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+    memcpy(mag, mag_[ch], sizeof(mag_[ch]));
+#endif
+}
+
+/*********** 窗口分析 ***********/
+const DetectorResult &TremorDetector::analyze() {
+    DET_PROFILE_START();
+    result_.tremor = result_.dyskinesia = false;
+    result_.levelT = result_.levelD = 0;
+
+    // 分析所有通道
+#if DETECTOR_HAS_Q15
+    if (cfg_.engine == ENGINE_Q15) {
+        for (int c = 0; c < 3; c++) {
+            analyzeChannelQ15(c, cfg_.accTremorTh, cfg_.accDyskTh, 0.5f, ACC_LSB_G);
+        }
+        for (int c = 3; c < DET_CHANNELS; c++) {
+            analyzeChannelQ15(c, cfg_.gyrTremorTh, cfg_.gyrDyskTh, 100.f, GYR_LSB_DPS);
+        }
+    }
+#endif
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+    if (cfg_.engine != ENGINE_Q15) {
+        for (int c = 0; c < 3; c++) {
+            analyzeChannel(c, cfg_.accTremorTh, cfg_.accDyskTh, 0.5f);
+        }
+        for (int c = 3; c < DET_CHANNELS; c++) {
+            analyzeChannel(c, cfg_.gyrTremorTh, cfg_.gyrDyskTh, 100.f);
+        }
+    }
+#endif
+
+    // 限制信号强度在0-1之间
+    result_.levelT = fminf(result_.levelT, 1.0f);
+    result_.levelD = fminf(result_.levelD, 1.0f);
+
+    // 判断是否显示症状
+    const bool trem = result_.tremor, dysk = result_.dyskinesia;
+    result_.showTremor = false;
+    result_.showDyskinesia = false;
+    if (dysk && (!trem || result_.levelD >= result_.levelT)) {
+        stable_dyskinesia_++;
+        stable_tremor_ = 0;
+        if (stable_dyskinesia_ >= cfg_.stableWindows) {
+            result_.showDyskinesia = true;
+        }
+    } else if (trem) {
+        stable_tremor_++;
+        stable_dyskinesia_ = 0;
+        if (stable_tremor_ >= cfg_.stableWindows) {
+            result_.showTremor = true;
+        }
+    } else {
+        stable_tremor_ = 0;
+        stable_dyskinesia_ = 0;
+    }
+    DET_PROFILE_MARK(STAGE_DECISION);
+    return result_;
+}
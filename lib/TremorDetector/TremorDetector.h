@@ -0,0 +1,155 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "arm_math.h"
+#include "ImuFrame.h"
+#include "DetectorParams.h"
+#include "Stft.h"
+#if DETECTOR_HAS_SDFT
+#include "SlidingDft.h"
+#endif
+#if DETECTOR_HAS_Q15
+#include "StftQ15.h"
+#endif
+#if DETECTOR_DECIMATE > 1
+#include "BandDecimator.h"
+#endif
+
+/*************************************
+ *  Tremor / Dyskinesia 检测核心      *
+ *  与硬件无关：输入原始采样，         *
+ *  输出决策与强度                    *
+ *************************************/
+
+/*********** 频谱计算方式 ***********/
+enum DetectorEngine {
+    ENGINE_FFT,   // 每 hop 个采样对整个窗口做 FFT（Stft）
+    ENGINE_SDFT,  // 滑动 DFT 逐样本更新 3-7Hz 频点（矩形窗，忽略 window）
+    ENGINE_Q15,   // 原始计数直接做 q15 FFT，阈值在整数域比较（需 2 的幂 FFT 长度，且不抽取）
+};
+// 选中的引擎未编入（DETECTOR_ENGINES）时，构造检测器时改用已编入的引擎，优先浮点 FFT
+
+/*********** 可调阈值 ***********/
+struct DetectorConfig {
+    float accTremorTh = 0.10f;  // 加速度计震颤检测阈值
+    float accDyskTh   = 0.10f;  // 加速度计运动障碍检测阈值
+    float gyrTremorTh = 10.0f;  // 陀螺仪震颤检测阈值
+    float gyrDyskTh   = 10.0f;  // 陀螺仪运动障碍检测阈值
+    float peakToRms   = 1.5f;   // 峰值与RMS比值阈值，用于判断信号质量
+    int   stableWindows = 1;    // 需要连续检测到症状的窗口数（按分析帧计）
+    // 以下两项在构造时生效
+    size_t hop = DET_N;                 // 分析间隔（采样点）；小于 DET_N 时窗口重叠；抽取时按四舍五入换算为分析采样
+    Stft::Window window = Stft::RECT;   // 分析窗；重叠分析时建议 Stft::HANN
+    DetectorEngine engine = ENGINE_FFT; // 频谱计算方式（config().engine 为实际使用的引擎）
+};
+
+/*********** 单通道 FFT 摘要 ***********/
+struct ChannelSummary {
+    float p35, f35;  // 3-5Hz 峰值及其频率
+    float p57, f57;  // 5-7Hz 峰值及其频率
+    float rms;       // 0-7Hz 带宽均方值幅度
+};
+
+/*********** 一个窗口的分析结果 ***********/
+struct DetectorResult {
+    ChannelSummary ch[DET_CHANNELS];
+    bool  tremor;          // 本窗口是否检测到震颤
+    bool  dyskinesia;      // 本窗口是否检测到运动障碍
+    float levelT;          // 震颤强度（0-1）
+    float levelD;          // 运动障碍强度（0-1）
+    bool  showTremor;      // 经稳定性判断后是否显示震颤
+    bool  showDyskinesia;  // 经稳定性判断后是否显示运动障碍
+};
+
+class TremorDetector {
+public:
+    explicit TremorDetector(const DetectorConfig &cfg = DetectorConfig());
+
+    // 基线校准：累加静止采样，结束后取平均
+    void accumulateBaseline(const ImuFrame &f);
+    void finishCalibration();
+    bool calibrated() const { return is_calibrated_; }
+    const float *baselineAcc() const { return baseline_acc_; }
+    const float *baselineGyr() const { return baseline_gyr_; }
+
+    // 推入一个采样点（缩放并减去基线），需要分析时（每 hop 个采样）返回 true
+    bool pushSample(const ImuFrame &f);
+
+    // 推入 n 个连续采样帧，整块换算后写入频谱缓冲；推到需要分析为止，返回实际消耗的帧数。
+    // ready 为 true 时应先调用 analyze()，再推入剩余的帧
+    size_t pushFrames(const ImuFrame *f, size_t n, bool &ready);
+
+    // 分析最近 DET_N 个采样：FFT、峰值搜索、阈值与稳定性判断
+    const DetectorResult &analyze();
+
+    const DetectorResult &result() const { return result_; }
+    DetectorConfig &config() { return cfg_; }
+    const int16_t *baselineCounts() const { return baseline_cnt_; }  // q15 路径使用的计数基线
+
+    // 最近一次 analyze() 中通道 ch 的幅度谱 mag[0..DET_MAX_BIN]（与阈值同单位；
+    // 滑动 DFT 只有 1..i7+2 频点有效）
+    void spectrum(int ch, float *mag) const;
+
+    int bin3() const { return i3_; }
+    int bin5() const { return i5_; }
+    int bin7() const { return i7_; }
+
+    static const char *const CHANNEL_TAGS[DET_CHANNELS];
+
+private:
+#if DETECTOR_DECIMATE > 1
+    size_t pushDecimated(const int16_t *raw, size_t n, bool &ready);
+#endif
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+    void analyzeChannel(int ch, float tth, float dth, float scale);
+#endif
+#if DETECTOR_HAS_Q15
+    void analyzeChannelQ15(int ch, float tth, float dth, float scale, float lsb);
+#endif
+
+    DetectorConfig cfg_;
+    union {  // 频谱引擎共用存储，构造时只构造 cfg_.engine 选中的一个
+#if DETECTOR_HAS_FFT
+        Stft stft_;
+#endif
+#if DETECTOR_HAS_SDFT
+        SlidingDft sdft_;
+#endif
+#if DETECTOR_HAS_Q15
+        StftQ15 stftq_;
+#endif
+    };
+#if DETECTOR_DECIMATE > 1
+    static_assert(DET_DECIM <= BandDecimator::MAX_FACTOR, "decimation factor too large");
+    static constexpr size_t DEC_LEN = BandDecimator::BLOCK / DET_DECIM;  // 每块最多的抽取输出
+    BandDecimator front_;
+    float blk_[DET_CHANNELS * BandDecimator::BLOCK];  // 换算后的平面输入块（前端原地滤波）
+    float dec_[DET_CHANNELS][DEC_LEN];                // 抽取输出
+#endif
+    int i3_, i5_, i7_;
+
+    float baseline_acc_[3];
+    float baseline_gyr_[3];
+    int16_t baseline_cnt_[DET_CHANNELS];  // 基线（原始计数），供 q15 路径使用
+    float scale_[DET_CHANNELS];           // 各通道 LSB → 物理单位
+    float bias_[DET_CHANNELS];            // 各通道 -基线（物理单位）
+    q15_t bias_cnt_[DET_CHANNELS];        // 各通道 -基线（原始计数）
+    uint32_t baseline_count_;
+    bool is_calibrated_;
+
+    union {  // 最近一次 analyze() 的幅度谱，格式随引擎
+#if DETECTOR_HAS_FFT || DETECTOR_HAS_SDFT
+        float mag_[DET_CHANNELS][DET_MAX_BIN + 1];
+#endif
+#if DETECTOR_HAS_Q15
+        q15_t magq_[DET_CHANNELS][DET_MAX_BIN + 1];
+#endif
+    };
+#if DETECTOR_HAS_Q15
+    int shiftq_[DET_CHANNELS];  // 各通道 q15 幅度的块浮点指数
+#endif
+
+    int stable_tremor_;
+    int stable_dyskinesia_;
+    DetectorResult result_;
+};
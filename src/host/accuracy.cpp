@@ -0,0 +1,844 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "arm_math.h"
+#include "DetectorParams.h"
+#include "Stft.h"
+#include "SlidingDft.h"
+#if DETECTOR_FFT_POW2
+#include "StftQ15.h"
+#endif
+
+/*************************************
+ *  快速路径精度检查                   *
+ *  每个优化内核与双精度参考对比，      *
+ *  报告最大 / RMS 误差与 SNR，低于     *
+ *  精度预算时退出码为 1               *
+ *************************************/
+// 用法: accuracy [--trials K] [--filter TEXT]
+//
+// 参考：有 f64 版本的用 CMSIS 的 arm_rfft_fast_f64 / arm_cfft_f64 / arm_cmplx_mag_f64 /
+// arm_mean_f64 / arm_var_f64 / arm_std_f64 / arm_power_f64 / arm_biquad_cascade_df2T_f64 /
+// arm_mat_mult_f64 / arm_mat_inverse_f64 / arm_mat_cholesky_f64，
+// FIR / 卷积 / 互相关用双精度直接求和，其余（任意长度 FFT、RMS、检测核心的频谱路径）
+// 用逐点求和的双精度 DFT。第一组检查先用 long double DFT 校验 f64 参考本身。
+// 定点输出按 CMSIS 文档的格式换算回输入单位后再比较（FFT 缩小 N 倍，幅度为 2.14 / 2.30 等）。
+// 误差：max = max|out - ref| / max|ref|，rms = RMS(out - ref) / RMS(ref)，SNR = -20·log10(rms)。
+// 每组 K 个随机输入（均匀分布，定点为 ±0.5 满量程）的误差合并统计。
+// 预算按当前实现的实测值留约 6 dB 余量；更换或改写内核后若 SNR 低于预算即视为精度回退。
+
+static void usage() {
+    fprintf(stderr, "usage: accuracy [--trials K] [--filter TEXT]\n");
+}
+
+/*********** 误差统计 ***********/
+struct ErrStat {
+    double sumRef2 = 0, sumErr2 = 0, maxRef = 0, maxErr = 0;
+    size_t count = 0;
+
+    void add(double ref, double out) {
+        const double e = out - ref;
+        sumRef2 += ref * ref;
+        sumErr2 += e * e;
+        maxRef = fmax(maxRef, fabs(ref));
+        maxErr = fmax(maxErr, fabs(e));
+        ++count;
+    }
+    double maxRel() const { return maxRef > 0 ? maxErr / maxRef : maxErr; }
+    double rmsRel() const { return sumRef2 > 0 ? sqrt(sumErr2 / sumRef2) : sqrt(sumErr2); }
+    double snrDb() const { return sumErr2 > 0 ? 10 * log10(sumRef2 / sumErr2) : 300.0; }
+};
+
+struct Check {
+    std::string name;
+    uint32_t n;
+    double budgetDb;
+    std::function<void(ErrStat &)> run;  // 一次试验：生成输入、计算、累加误差
+};
+
+static std::vector<Check> checks;
+static std::mt19937 rng(1);
+
+static void add(const std::string &name, uint32_t n, double budgetDb,
+                std::function<void(ErrStat &)> run) {
+    checks.push_back({name, n, budgetDb, run});
+}
+
+static std::vector<double> randomSignal(size_t n, double amp) {
+    std::uniform_real_distribution<double> d(-amp, amp);
+    std::vector<double> x(n);
+    for (double &v : x) v = d(rng);
+    return x;
+}
+
+static std::vector<float32_t> toF32(const std::vector<double> &x) {
+    return std::vector<float32_t>(x.begin(), x.end());
+}
+
+static std::vector<q15_t> toQ15(const std::vector<double> &x) {
+    std::vector<q15_t> q(x.size());
+    for (size_t i = 0; i < x.size(); i++) q[i] = (q15_t)lrint(x[i] * 32768.0);
+    return q;
+}
+
+static std::vector<q31_t> toQ31(const std::vector<double> &x) {
+    std::vector<q31_t> q(x.size());
+    for (size_t i = 0; i < x.size(); i++) q[i] = (q31_t)llrint(x[i] * 2147483648.0);
+    return q;
+}
+
+// 定点输入按量化后的值作参考输入，只统计内核本身的误差
+static std::vector<double> fromQ15(const std::vector<q15_t> &q) {
+    std::vector<double> x(q.size());
+    for (size_t i = 0; i < q.size(); i++) x[i] = q[i] / 32768.0;
+    return x;
+}
+
+static std::vector<double> fromQ31(const std::vector<q31_t> &q) {
+    std::vector<double> x(q.size());
+    for (size_t i = 0; i < q.size(); i++) x[i] = q[i] / 2147483648.0;
+    return x;
+}
+
+/*********** 双精度参考 ***********/
+// 实数 DFT 的 0..bins-1 频点（逐点求和，任意长度）
+static void dftReal(const double *x, uint32_t n, uint32_t bins, double *re, double *im) {
+    for (uint32_t k = 0; k < bins; k++) {
+        long double sr = 0, si = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            const long double a = -2.0L * M_PI * (long double)(((uint64_t)k * i) % n) / n;
+            sr += x[i] * cosl(a);
+            si += x[i] * sinl(a);
+        }
+        re[k] = (double)sr;
+        im[k] = (double)si;
+    }
+}
+
+// 2 的幂长度：arm_rfft_fast_f64，输出 bins 0..n/2 的 re / im
+static void rfftRef(const std::vector<double> &x, std::vector<double> &re, std::vector<double> &im) {
+    const uint32_t n = x.size();
+    re.assign(n / 2 + 1, 0);
+    im.assign(n / 2 + 1, 0);
+    if (n & (n - 1)) {
+        dftReal(x.data(), n, n / 2 + 1, re.data(), im.data());
+        return;
+    }
+    arm_rfft_fast_instance_f64 s;
+    arm_rfft_fast_init_f64(&s, n);
+    std::vector<double> in(x), out(n);
+    arm_rfft_fast_f64(&s, in.data(), out.data(), 0);
+    re[0] = out[0];
+    re[n / 2] = out[1];
+    for (uint32_t k = 1; k < n / 2; k++) {
+        re[k] = out[2 * k];
+        im[k] = out[2 * k + 1];
+    }
+}
+
+// 复数 FFT 参考：arm_cfft_f64（原位，交错 re/im）
+static std::vector<double> cfftRef(const std::vector<double> &x) {
+    const uint32_t n = x.size() / 2;
+    arm_cfft_instance_f64 s;
+    arm_cfft_init_f64(&s, n);
+    std::vector<double> y(x);
+    arm_cfft_f64(&s, y.data(), 0, 1);
+    return y;
+}
+
+// 与 rfft_fast 格式（out[1] 为 Nyquist）的 f32 输出逐频点比较
+static void compareRfftFast(ErrStat &e, const float32_t *out, const std::vector<double> &re,
+                            const std::vector<double> &im, uint32_t n, double scale = 1) {
+    e.add(re[0], out[0] * scale);
+    e.add(re[n / 2], out[1] * scale);
+    for (uint32_t k = 1; k < n / 2; k++) {
+        e.add(re[k], out[2 * k] * scale);
+        e.add(im[k], out[2 * k + 1] * scale);
+    }
+}
+
+/*********** 参考本身 ***********/
+static void addOracle() {
+    for (uint32_t n : {64u, 1024u}) {
+        add("oracle: arm_rfft_fast_f64 vs DFT", n, 250, [n](ErrStat &e) {
+            std::vector<double> x = randomSignal(n, 1.0), re, im, dre(n / 2 + 1), dim(n / 2 + 1);
+            rfftRef(x, re, im);
+            dftReal(x.data(), n, n / 2 + 1, dre.data(), dim.data());
+            for (uint32_t k = 0; k <= n / 2; k++) {
+                e.add(dre[k], re[k]);
+                e.add(dim[k], im[k]);
+            }
+        });
+    }
+}
+
+/*********** FFT ***********/
+static void addTransforms() {
+    for (uint32_t n : {64u, 256u, 1024u, 4096u}) {
+        // 定点 FFT 每一级右移 1 位，长度每翻倍 SNR 约降 3 dB，预算随之放宽
+        const double octaves = log2(n / 64.0);
+        add("arm_rfft_fast_f32", n, 130, [n](ErrStat &e) {
+            std::vector<double> x = randomSignal(n, 1.0), re, im;
+            std::vector<float32_t> in = toF32(x), out(n);
+            rfftRef(std::vector<double>(in.begin(), in.end()), re, im);
+            arm_rfft_fast_instance_f32 s;
+            arm_rfft_fast_init_f32(&s, n);
+            arm_rfft_fast_f32(&s, in.data(), out.data(), 0);
+            compareRfftFast(e, out.data(), re, im, n);
+        });
+        add("arm_cfft_f32", n, 130, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(2 * n, 1.0));
+            const std::vector<double> ref = cfftRef(std::vector<double>(x.begin(), x.end()));
+            arm_cfft_instance_f32 s;
+            arm_cfft_init_f32(&s, n);
+            arm_cfft_f32(&s, x.data(), 0, 1);
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(ref[i], x[i]);
+        });
+        // 逆变换：双精度频谱取整到 f32 后逆变换，与原信号比较
+        add("arm_rfft_fast_f32 (inverse)", n, 130, [n](ErrStat &e) {
+            std::vector<double> x = randomSignal(n, 1.0), y(n);
+            arm_rfft_fast_instance_f64 sd;
+            arm_rfft_fast_init_f64(&sd, n);
+            std::vector<double> xd(x);
+            arm_rfft_fast_f64(&sd, xd.data(), y.data(), 0);
+            std::vector<float32_t> in = toF32(y), out(n);
+            arm_rfft_fast_instance_f32 s;
+            arm_rfft_fast_init_f32(&s, n);
+            arm_rfft_fast_f32(&s, in.data(), out.data(), 1);
+            for (uint32_t i = 0; i < n; i++) e.add(x[i], out[i]);
+        });
+        add("arm_cfft_f32 (inverse)", n, 130, [n](ErrStat &e) {
+            const std::vector<double> x = randomSignal(2 * n, 1.0);
+            std::vector<float32_t> y = toF32(cfftRef(x));
+            arm_cfft_instance_f32 s;
+            arm_cfft_init_f32(&s, n);
+            arm_cfft_f32(&s, y.data(), 1, 1);
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(x[i], y[i]);
+        });
+        add("arm_cfft_radix2_f32", n, 130, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(2 * n, 1.0));
+            const std::vector<double> ref = cfftRef(std::vector<double>(x.begin(), x.end()));
+            arm_cfft_radix2_instance_f32 s;
+            arm_cfft_radix2_init_f32(&s, n, 0, 1);
+            arm_cfft_radix2_f32(&s, x.data());
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(ref[i], x[i]);
+        });
+        add("arm_cfft_q31", n, 125, [n](ErrStat &e) {
+            std::vector<q31_t> x = toQ31(randomSignal(2 * n, 0.5));
+            const std::vector<double> ref = cfftRef(fromQ31(x));
+            arm_cfft_instance_q31 s;
+            arm_cfft_init_q31(&s, n);
+            arm_cfft_q31(&s, x.data(), 0, 1);
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(ref[i], x[i] / 2147483648.0 * n);
+        });
+        add("arm_cfft_q15", n, 54 - 3 * octaves, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(2 * n, 0.5));
+            const std::vector<double> ref = cfftRef(fromQ15(x));
+            arm_cfft_instance_q15 s;
+            arm_cfft_init_q15(&s, n);
+            arm_cfft_q15(&s, x.data(), 0, 1);
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(ref[i], x[i] / 32768.0 * n);
+        });
+        add("arm_rfft_q15", n, 49 - 3 * octaves, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(n, 0.5)), out(2 * n);
+            std::vector<double> re, im;
+            rfftRef(fromQ15(x), re, im);
+            arm_rfft_instance_q15 s;
+            arm_rfft_init_q15(&s, n, 0, 1);
+            arm_rfft_q15(&s, x.data(), out.data());
+            for (uint32_t k = 0; k <= n / 2; k++) {
+                e.add(re[k], out[2 * k] / 32768.0 * n);
+                e.add(im[k], out[2 * k + 1] / 32768.0 * n);
+            }
+        });
+        add("arm_rfft_q31", n, 120, [n](ErrStat &e) {
+            std::vector<q31_t> x = toQ31(randomSignal(n, 0.5)), out(2 * n);
+            std::vector<double> re, im;
+            rfftRef(fromQ31(x), re, im);
+            arm_rfft_instance_q31 s;
+            arm_rfft_init_q31(&s, n, 0, 1);
+            arm_rfft_q31(&s, x.data(), out.data());
+            for (uint32_t k = 0; k <= n / 2; k++) {
+                e.add(re[k], out[2 * k] / 2147483648.0 * n);
+                e.add(im[k], out[2 * k + 1] / 2147483648.0 * n);
+            }
+        });
+        // 检测核心的用法：只输出 15 Hz 以下（退回完整变换）；窄带 N/64 时走拆分路径
+        for (uint16_t maxBin : {(uint16_t)(15.0f * n / DET_FS), (uint16_t)(n / 64)}) {
+            if (n < 256) break;
+            add(maxBin == n / 64 ? "arm_rfft_pruned_f32 (N/64)" : "arm_rfft_pruned_f32", n, 130, [n, maxBin](ErrStat &e) {
+                std::vector<double> x = randomSignal(n, 1.0), re, im;
+                std::vector<float32_t> in = toF32(x), out(2 * (maxBin + 1));
+                rfftRef(std::vector<double>(in.begin(), in.end()), re, im);
+                arm_rfft_pruned_instance_f32 s;
+                arm_rfft_pruned_init_f32(&s, n, maxBin);
+                std::vector<float32_t> scratch(2 * s.fftLenSub);
+                arm_rfft_pruned_f32(&s, in.data(), out.data(), scratch.data());
+                for (uint32_t k = 0; k <= maxBin; k++) {
+                    e.add(re[k], out[2 * k]);
+                    e.add(im[k], out[2 * k + 1]);
+                }
+            });
+        }
+        if (n >= 128) {
+            add("arm_rfft_fast_multi_f32", n, 130, [n](ErrStat &e) {
+                const int ch = DET_CHANNELS;
+                std::vector<float32_t> in = toF32(randomSignal(ch * n, 1.0)), out(ch * n), scratch(2 * n);
+                arm_rfft_fast_multi_instance_f32 s;
+                arm_rfft_fast_multi_init_f32(&s, n);
+                std::vector<std::vector<double>> re(ch), im(ch);
+                for (int c = 0; c < ch; c++) {
+                    rfftRef(std::vector<double>(in.begin() + c * n, in.begin() + (c + 1) * n), re[c], im[c]);
+                }
+                arm_rfft_fast_multi_f32(&s, in.data(), out.data(), scratch.data(), ch);
+                for (int c = 0; c < ch; c++) compareRfftFast(e, out.data() + c * n, re[c], im[c], n);
+            });
+        }
+    }
+    for (uint32_t n : {64u, 256u, 1024u, 4096u}) {
+        add("arm_cfft_radix4_f32", n, 130, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(2 * n, 1.0));
+            const std::vector<double> ref = cfftRef(std::vector<double>(x.begin(), x.end()));
+            arm_cfft_radix4_instance_f32 s;
+            arm_cfft_radix4_init_f32(&s, n, 0, 1);
+            arm_cfft_radix4_f32(&s, x.data());
+            for (uint32_t i = 0; i < 2 * n; i++) e.add(ref[i], x[i]);
+        });
+    }
+    // 任意长度实数 FFT（1/2/3 s 窗口），参考为逐点 DFT
+    for (uint32_t n : {104u, 208u, 312u}) {
+        add("arm_rfft_mixed_f32", n, 130, [n](ErrStat &e) {
+            std::vector<double> x = randomSignal(n, 1.0), re, im;
+            std::vector<float32_t> in = toF32(x), out(n);
+            rfftRef(std::vector<double>(in.begin(), in.end()), re, im);
+            arm_rfft_mixed_instance_f32 s;
+            std::vector<float32_t> state(arm_rfft_mixed_state_len_f32(n)),
+                                   scratch(arm_rfft_mixed_scratch_len_f32(n));
+            arm_rfft_mixed_init_f32(&s, n, state.data(), state.size());
+            arm_rfft_mixed_f32(&s, in.data(), out.data(), scratch.data(), 0);
+            compareRfftFast(e, out.data(), re, im, n);
+        });
+    }
+}
+
+/*********** 复数幅度 ***********/
+static void addMagnitude() {
+    const uint32_t n = 256;
+    add("arm_cmplx_mag_f32", n, 140, [n](ErrStat &e) {
+        std::vector<float32_t> x = toF32(randomSignal(2 * n, 1.0)), out(n);
+        std::vector<double> xd(x.begin(), x.end()), ref(n);
+        arm_cmplx_mag_f64(xd.data(), ref.data(), n);
+        arm_cmplx_mag_f32(x.data(), out.data(), n);
+        for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i]);
+    });
+    // 2.14 / 2.30 格式：换回输入单位乘 2
+    add("arm_cmplx_mag_q15", n, 75, [n](ErrStat &e) {
+        std::vector<q15_t> x = toQ15(randomSignal(2 * n, 0.5)), out(n);
+        std::vector<double> xd = fromQ15(x), ref(n);
+        arm_cmplx_mag_f64(xd.data(), ref.data(), n);
+        arm_cmplx_mag_q15(x.data(), out.data(), n);
+        for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i] / 16384.0);
+    });
+    add("arm_cmplx_mag_fast_q15", n, 60, [n](ErrStat &e) {
+        std::vector<q15_t> x = toQ15(randomSignal(2 * n, 0.5)), out(n);
+        std::vector<double> xd = fromQ15(x), ref(n);
+        arm_cmplx_mag_f64(xd.data(), ref.data(), n);
+        arm_cmplx_mag_fast_q15(x.data(), out.data(), n);
+        for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i] / 16384.0);
+    });
+    add("arm_cmplx_mag_q31", n, 145, [n](ErrStat &e) {
+        std::vector<q31_t> x = toQ31(randomSignal(2 * n, 0.5)), out(n);
+        std::vector<double> xd = fromQ31(x), ref(n);
+        arm_cmplx_mag_f64(xd.data(), ref.data(), n);
+        arm_cmplx_mag_q31(x.data(), out.data(), n);
+        for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i] / 1073741824.0);
+    });
+}
+
+/*********** 统计 ***********/
+// 每次试验得到一个标量，误差在全部试验上合并
+static void addStatistics() {
+    for (uint32_t n : {104u, 1024u}) {
+        add("arm_mean_f32", n, 115, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(n, 1.0));
+            std::vector<double> xd(x.begin(), x.end());
+            float64_t ref;
+            float32_t out;
+            arm_mean_f64(xd.data(), n, &ref);
+            arm_mean_f32(x.data(), n, &out);
+            e.add(ref, out);
+        });
+        add("arm_var_f32", n, 115, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(n, 1.0));
+            std::vector<double> xd(x.begin(), x.end());
+            float64_t ref;
+            float32_t out;
+            arm_var_f64(xd.data(), n, &ref);
+            arm_var_f32(x.data(), n, &out);
+            e.add(ref, out);
+        });
+        add("arm_std_f32", n, 115, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(n, 1.0));
+            std::vector<double> xd(x.begin(), x.end());
+            float64_t ref;
+            float32_t out;
+            arm_std_f64(xd.data(), n, &ref);
+            arm_std_f32(x.data(), n, &out);
+            e.add(ref, out);
+        });
+        add("arm_rms_f32", n, 115, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(n, 1.0));
+            double ref = 0;
+            for (float32_t v : x) ref += (double)v * v;
+            float32_t out;
+            arm_rms_f32(x.data(), n, &out);
+            e.add(sqrt(ref / n), out);
+        });
+        add("arm_power_f32", n, 115, [n](ErrStat &e) {
+            std::vector<float32_t> x = toF32(randomSignal(n, 1.0));
+            std::vector<double> xd(x.begin(), x.end());
+            float64_t ref;
+            float32_t out;
+            arm_power_f64(xd.data(), n, &ref);
+            arm_power_f32(x.data(), n, &out);
+            e.add(ref, out);
+        });
+        // 均值本身接近 0，截断到 1 LSB 的误差相对很大
+        add("arm_mean_q15", n, 48, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(n, 0.5));
+            std::vector<double> xd = fromQ15(x);
+            float64_t ref;
+            q15_t out;
+            arm_mean_f64(xd.data(), n, &ref);
+            arm_mean_q15(x.data(), n, &out);
+            e.add(ref, out / 32768.0);
+        });
+        add("arm_rms_q15", n, 68, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(n, 0.5));
+            double ref = 0;
+            for (q15_t v : x) ref += (v / 32768.0) * (v / 32768.0);
+            q15_t out;
+            arm_rms_q15(x.data(), n, &out);
+            e.add(sqrt(ref / n), out / 32768.0);
+        });
+        add("arm_var_q15", n, 66, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(n, 0.5));
+            std::vector<double> xd = fromQ15(x);
+            float64_t ref;
+            q15_t out;
+            arm_var_f64(xd.data(), n, &ref);
+            arm_var_q15(x.data(), n, &out);
+            e.add(ref, out / 32768.0);
+        });
+        add("arm_var_q31", n, 140, [n](ErrStat &e) {
+            std::vector<q31_t> x = toQ31(randomSignal(n, 0.5));
+            std::vector<double> xd = fromQ31(x);
+            float64_t ref;
+            q31_t out;
+            arm_var_f64(xd.data(), n, &ref);
+            arm_var_q31(x.data(), n, &out);
+            e.add(ref, out / 2147483648.0);
+        });
+        // 34.30 / 16.48 格式的累加和
+        add("arm_power_q15", n, 200, [n](ErrStat &e) {
+            std::vector<q15_t> x = toQ15(randomSignal(n, 0.5));
+            std::vector<double> xd = fromQ15(x);
+            float64_t ref;
+            q63_t out;
+            arm_power_f64(xd.data(), n, &ref);
+            arm_power_q15(x.data(), n, &out);
+            e.add(ref, ldexp((double)out, -30));
+        });
+        add("arm_power_q31", n, 200, [n](ErrStat &e) {
+            std::vector<q31_t> x = toQ31(randomSignal(n, 0.5));
+            std::vector<double> xd = fromQ31(x);
+            float64_t ref;
+            q63_t out;
+            arm_power_f64(xd.data(), n, &ref);
+            arm_power_q31(x.data(), n, &out);
+            e.add(ref, ldexp((double)out, -48));
+        });
+    }
+}
+
+/*********** 矩阵 ***********/
+// 随机方阵加 n·I 对角占优，求逆与 Cholesky 的条件数与 n 无关
+static std::vector<double> randomMatrix(uint32_t rows, uint32_t cols, double amp) {
+    return randomSignal((size_t)rows * cols, amp);
+}
+
+static std::vector<double> spdMatrix(uint32_t n) {
+    const std::vector<double> a = randomMatrix(n, n, 1.0);
+    std::vector<double> s((size_t)n * n);
+    for (uint32_t i = 0; i < n; i++)
+        for (uint32_t j = 0; j < n; j++) {
+            double acc = i == j ? n : 0.0;
+            for (uint32_t k = 0; k < n; k++) acc += a[i * n + k] * a[j * n + k];
+            s[i * n + j] = acc;
+        }
+    return s;
+}
+
+static void addMatrix() {
+    for (uint32_t n : {6u, 16u, 64u, 70u}) {
+        add("arm_mat_mult_f32", n, 130, [n](ErrStat &e) {
+            std::vector<float32_t> a = toF32(randomMatrix(n, n, 1.0)), b = toF32(randomMatrix(n, n, 1.0));
+            std::vector<double> ad(a.begin(), a.end()), bd(b.begin(), b.end()), ref((size_t)n * n);
+            std::vector<float32_t> out((size_t)n * n);
+            arm_matrix_instance_f64 A64, B64, C64;
+            arm_matrix_instance_f32 A, B, C;
+            arm_mat_init_f64(&A64, n, n, ad.data());
+            arm_mat_init_f64(&B64, n, n, bd.data());
+            arm_mat_init_f64(&C64, n, n, ref.data());
+            arm_mat_init_f32(&A, n, n, a.data());
+            arm_mat_init_f32(&B, n, n, b.data());
+            arm_mat_init_f32(&C, n, n, out.data());
+            arm_mat_mult_f64(&A64, &B64, &C64);
+            arm_mat_mult_f32(&A, &B, &C);
+            for (size_t i = 0; i < out.size(); i++) e.add(ref[i], out[i]);
+        });
+        // 输入缩小 n 倍，保证 2.62 累加截断后的 1.31 结果不回绕
+        add("arm_mat_mult_q31", n, 145, [n](ErrStat &e) {
+            std::vector<q31_t> a = toQ31(randomMatrix(n, n, 0.5 / n)), b = toQ31(randomMatrix(n, n, 0.5));
+            std::vector<double> ad = fromQ31(a), bd = fromQ31(b), ref((size_t)n * n);
+            std::vector<q31_t> out((size_t)n * n);
+            arm_matrix_instance_f64 A64, B64, C64;
+            arm_matrix_instance_q31 A, B, C;
+            arm_mat_init_f64(&A64, n, n, ad.data());
+            arm_mat_init_f64(&B64, n, n, bd.data());
+            arm_mat_init_f64(&C64, n, n, ref.data());
+            arm_mat_init_q31(&A, n, n, a.data());
+            arm_mat_init_q31(&B, n, n, b.data());
+            arm_mat_init_q31(&C, n, n, out.data());
+            arm_mat_mult_f64(&A64, &B64, &C64);
+            arm_mat_mult_q31(&A, &B, &C);
+            for (size_t i = 0; i < out.size(); i++) e.add(ref[i], out[i] / 2147483648.0);
+        });
+        // 8 个向量一批，与逐向量双精度乘积对比
+        add("arm_mat_vec_mult_batch_f32", n, 130, [n](ErrStat &e) {
+            const uint32_t numVecs = 8;
+            std::vector<float32_t> a = toF32(randomMatrix(n, n, 1.0)), x = toF32(randomSignal((size_t)n * numVecs, 1.0));
+            std::vector<float32_t> out((size_t)n * numVecs);
+            arm_matrix_instance_f32 A;
+            arm_mat_init_f32(&A, n, n, a.data());
+            arm_mat_vec_mult_batch_f32(&A, x.data(), out.data(), numVecs);
+            for (uint32_t v = 0; v < numVecs; v++)
+                for (uint32_t i = 0; i < n; i++) {
+                    double ref = 0;
+                    for (uint32_t k = 0; k < n; k++) ref += (double)a[i * n + k] * x[v * n + k];
+                    e.add(ref, out[v * n + i]);
+                }
+        });
+        add("arm_mat_inverse_f32", n, 127, [n](ErrStat &e) {
+            std::vector<double> ad = spdMatrix(n), ref((size_t)n * n);
+            std::vector<float32_t> a = toF32(ad), out((size_t)n * n);
+            ad.assign(a.begin(), a.end());
+            arm_matrix_instance_f64 A64, I64;
+            arm_matrix_instance_f32 A, I;
+            arm_mat_init_f64(&A64, n, n, ad.data());
+            arm_mat_init_f64(&I64, n, n, ref.data());
+            arm_mat_init_f32(&A, n, n, a.data());
+            arm_mat_init_f32(&I, n, n, out.data());
+            if (arm_mat_inverse_f64(&A64, &I64) != ARM_MATH_SUCCESS || arm_mat_inverse_f32(&A, &I) != ARM_MATH_SUCCESS) {
+                e.add(1.0, 0.0);
+                return;
+            }
+            for (size_t i = 0; i < out.size(); i++) e.add(ref[i], out[i]);
+        });
+        add("arm_mat_cholesky_f32", n, 134, [n](ErrStat &e) {
+            std::vector<double> ad = spdMatrix(n), ref((size_t)n * n);
+            std::vector<float32_t> a = toF32(ad), out((size_t)n * n);
+            ad.assign(a.begin(), a.end());
+            arm_matrix_instance_f64 A64, L64;
+            arm_matrix_instance_f32 A, L;
+            arm_mat_init_f64(&A64, n, n, ad.data());
+            arm_mat_init_f64(&L64, n, n, ref.data());
+            arm_mat_init_f32(&A, n, n, a.data());
+            arm_mat_init_f32(&L, n, n, out.data());
+            if (arm_mat_cholesky_f64(&A64, &L64) != ARM_MATH_SUCCESS || arm_mat_cholesky_f32(&A, &L) != ARM_MATH_SUCCESS) {
+                e.add(1.0, 0.0);
+                return;
+            }
+            for (size_t i = 0; i < out.size(); i++) e.add(ref[i], out[i]);
+        });
+    }
+}
+
+/*********** 滤波 ***********/
+// FIR 系数按 CMSIS 约定逆序存放：pCoeffs[k] = b[numTaps-1-k]
+static double firRef(const std::vector<double> &x, const std::vector<double> &h, size_t n) {
+    const size_t taps = h.size();
+    double acc = 0;
+    for (size_t k = 0; k < taps && k <= n; k++) acc += h[taps - 1 - k] * x[n - k];
+    return acc;
+}
+
+// 二阶低通（RBJ，fc = 0.1 fs），CMSIS 约定反馈系数取负
+static void lowpassBiquad(double c[5]) {
+    const double w = 2 * M_PI * 0.1, alpha = sin(w) / (2 * 0.7071), cw = cos(w), a0 = 1 + alpha;
+    c[0] = (1 - cw) / 2 / a0;
+    c[1] = (1 - cw) / a0;
+    c[2] = (1 - cw) / 2 / a0;
+    c[3] = 2 * cw / a0;
+    c[4] = -(1 - alpha) / a0;
+}
+
+// 每次试验分两块处理，覆盖块间的状态衔接；参考用同一组（量化到 f32 的）系数
+static void addFiltering() {
+    const uint32_t n = 256, taps = 32, M = 4, stages = 4, channels = 6;
+    add("arm_fir_f32", n, 133, [=](ErrStat &e) {
+        std::vector<float32_t> h = toF32(randomSignal(taps, 0.2)), x = toF32(randomSignal(n, 1.0)),
+                               out(n), state(n / 2 + taps - 1);
+        std::vector<double> hd(h.begin(), h.end()), xd(x.begin(), x.end());
+        arm_fir_instance_f32 s;
+        arm_fir_init_f32(&s, taps, h.data(), state.data(), n / 2);
+        arm_fir_f32(&s, x.data(), out.data(), n / 2);
+        arm_fir_f32(&s, x.data() + n / 2, out.data() + n / 2, n / 2);
+        for (uint32_t i = 0; i < n; i++) e.add(firRef(xd, hd, i), out[i]);
+    });
+    // 第 m 个输出对应输入 x[m·M]
+    add("arm_fir_decimate_f32", n, 133, [=](ErrStat &e) {
+        std::vector<float32_t> h = toF32(randomSignal(taps, 0.2)), x = toF32(randomSignal(n, 1.0)),
+                               out(n / M), state(n / 2 + taps - 1);
+        std::vector<double> hd(h.begin(), h.end()), xd(x.begin(), x.end());
+        arm_fir_decimate_instance_f32 s;
+        arm_fir_decimate_init_f32(&s, taps, M, h.data(), state.data(), n / 2);
+        arm_fir_decimate_f32(&s, x.data(), out.data(), n / 2);
+        arm_fir_decimate_f32(&s, x.data() + n / 2, out.data() + n / (2 * M), n / 2);
+        for (uint32_t i = 0; i < n / M; i++) e.add(firRef(xd, hd, i * M), out[i]);
+    });
+    add("arm_biquad_cascade_df2T_f32", n, 129, [=](ErrStat &e) {
+        double bq[5];
+        lowpassBiquad(bq);
+        std::vector<float32_t> k(5 * stages), x = toF32(randomSignal(n, 1.0)), out(n), state(2 * stages);
+        for (uint32_t i = 0; i < 5 * stages; i++) k[i] = (float32_t)bq[i % 5];
+        std::vector<double> kd(k.begin(), k.end()), xd(x.begin(), x.end()), ref(n), stated(2 * stages);
+        arm_biquad_cascade_df2T_instance_f64 sd;
+        arm_biquad_cascade_df2T_init_f64(&sd, stages, kd.data(), stated.data());
+        arm_biquad_cascade_df2T_f64(&sd, xd.data(), ref.data(), n);
+        arm_biquad_cascade_df2T_instance_f32 s;
+        arm_biquad_cascade_df2T_init_f32(&s, stages, k.data(), state.data());
+        arm_biquad_cascade_df2T_f32(&s, x.data(), out.data(), n / 2);
+        arm_biquad_cascade_df2T_f32(&s, x.data() + n / 2, out.data() + n / 2, n / 2);
+        for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i]);
+    });
+    // 6 个通道平面存放，逐通道与 f64 单通道级联对比
+    add("arm_biquad_cascade_planar_df2T_f32", n, 128, [=](ErrStat &e) {
+        double bq[5];
+        lowpassBiquad(bq);
+        std::vector<float32_t> k(5 * stages), x = toF32(randomSignal(channels * n, 1.0)), blk(channels * n / 2),
+                               out(channels * n), state(2 * stages * channels);
+        for (uint32_t i = 0; i < 5 * stages; i++) k[i] = (float32_t)bq[i % 5];
+        arm_biquad_cascade_planar_df2T_instance_f32 s;
+        arm_biquad_cascade_planar_df2T_init_f32(&s, stages, channels, k.data(), state.data());
+        for (uint32_t half = 0; half < 2; half++) {
+            for (uint32_t ch = 0; ch < channels; ch++)
+                memcpy(&blk[ch * n / 2], &x[ch * n + half * n / 2], n / 2 * sizeof(float32_t));
+            arm_biquad_cascade_planar_df2T_f32(&s, blk.data(), blk.data(), n / 2);
+            for (uint32_t ch = 0; ch < channels; ch++)
+                memcpy(&out[ch * n + half * n / 2], &blk[ch * n / 2], n / 2 * sizeof(float32_t));
+        }
+        std::vector<double> kd(k.begin(), k.end()), xd(x.begin(), x.end()), ref(n), stated(2 * stages);
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            arm_biquad_cascade_df2T_instance_f64 sd;
+            arm_biquad_cascade_df2T_init_f64(&sd, stages, kd.data(), stated.data());
+            arm_biquad_cascade_df2T_f64(&sd, &xd[ch * n], ref.data(), n);
+            for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[ch * n + i]);
+        }
+    });
+    // 6 个通道交错存放（x[i·channels + ch]），同上逐通道对比；q31 系数为 bq / 2（postShift = 1），
+    // 参考用同一组量化后的系数
+    add("arm_biquad_cascade_multich_df2T_f32", n, 128, [=](ErrStat &e) {
+        double bq[5];
+        lowpassBiquad(bq);
+        std::vector<float32_t> k(5 * stages), x = toF32(randomSignal(channels * n, 1.0)), out(channels * n),
+                               state(2 * stages * channels);
+        for (uint32_t i = 0; i < 5 * stages; i++) k[i] = (float32_t)bq[i % 5];
+        arm_biquad_cascade_multich_df2T_instance_f32 s;
+        arm_biquad_cascade_multich_df2T_init_f32(&s, stages, channels, k.data(), state.data());
+        arm_biquad_cascade_multich_df2T_f32(&s, x.data(), out.data(), n / 2);
+        arm_biquad_cascade_multich_df2T_f32(&s, x.data() + channels * n / 2, out.data() + channels * n / 2, n / 2);
+        std::vector<double> kd(k.begin(), k.end()), xd(n), ref(n), stated(2 * stages);
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            for (uint32_t i = 0; i < n; i++) xd[i] = x[i * channels + ch];
+            arm_biquad_cascade_df2T_instance_f64 sd;
+            arm_biquad_cascade_df2T_init_f64(&sd, stages, kd.data(), stated.data());
+            arm_biquad_cascade_df2T_f64(&sd, xd.data(), ref.data(), n);
+            for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i * channels + ch]);
+        }
+    });
+    add("arm_biquad_cascade_multich_df2T_q31", n, 143, [=](ErrStat &e) {
+        double bq[5];
+        lowpassBiquad(bq);
+        std::vector<q31_t> k(5 * stages), x = toQ31(randomSignal(channels * n, 0.5)), out(channels * n);
+        std::vector<q63_t> state(2 * stages * channels);
+        for (uint32_t i = 0; i < 5 * stages; i++) k[i] = (q31_t)llrint(bq[i % 5] * 1073741824.0);
+        arm_biquad_cascade_multich_df2T_instance_q31 s;
+        arm_biquad_cascade_multich_df2T_init_q31(&s, stages, channels, k.data(), state.data(), 1);
+        arm_biquad_cascade_multich_df2T_q31(&s, x.data(), out.data(), n / 2);
+        arm_biquad_cascade_multich_df2T_q31(&s, x.data() + channels * n / 2, out.data() + channels * n / 2, n / 2);
+        std::vector<double> kd(5 * stages), xd(n), ref(n), stated(2 * stages);
+        for (uint32_t i = 0; i < 5 * stages; i++) kd[i] = k[i] / 1073741824.0;
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            for (uint32_t i = 0; i < n; i++) xd[i] = x[i * channels + ch] / 2147483648.0;
+            arm_biquad_cascade_df2T_instance_f64 sd;
+            arm_biquad_cascade_df2T_init_f64(&sd, stages, kd.data(), stated.data());
+            arm_biquad_cascade_df2T_f64(&sd, xd.data(), ref.data(), n);
+            for (uint32_t i = 0; i < n; i++) e.add(ref[i], out[i * channels + ch] / 2147483648.0);
+        }
+    });
+    add("arm_conv_f32", n, 133, [=](ErrStat &e) {
+        std::vector<float32_t> a = toF32(randomSignal(n, 1.0)), b = toF32(randomSignal(taps, 1.0)),
+                               out(n + taps - 1);
+        arm_conv_f32(a.data(), n, b.data(), taps, out.data());
+        for (uint32_t i = 0; i < n + taps - 1; i++) {
+            double ref = 0;
+            for (uint32_t j = 0; j < taps; j++)
+                if (i >= j && i - j < n) ref += (double)b[j] * a[i - j];
+            e.add(ref, out[i]);
+        }
+    });
+    // 两种长度顺序都检查：A 较短时结果从输出末尾倒序写入
+    for (bool longA : {true, false}) {
+        const uint32_t la = longA ? n : taps, lb = longA ? taps : n;
+        add(longA ? "arm_correlate_f32" : "arm_correlate_f32 (short A)", n, 133, [=](ErrStat &e) {
+            std::vector<float32_t> a = toF32(randomSignal(la, 1.0)), b = toF32(randomSignal(lb, 1.0)),
+                                   out(2 * n - 1);
+            arm_correlate_f32(a.data(), la, b.data(), lb, out.data());
+            // 滞后 l = -(lb-1) .. la-1 的互相关 r(l) = sum a[m+l]·b[m]，A 较长时前 la-lb 个输出不写
+            const uint32_t off = longA ? la - lb : 0;
+            for (uint32_t i = 0; i < la + lb - 1; i++) {
+                const int lag = (int)i - (int)(lb - 1);
+                double ref = 0;
+                for (int m = 0; m < (int)lb; m++)
+                    if (m + lag >= 0 && m + lag < (int)la) ref += (double)a[m + lag] * b[m];
+                e.add(ref, out[off + i]);
+            }
+        });
+    }
+}
+
+/*********** 检测核心的频谱路径 ***********/
+// 最近 DET_N_A 个分析采样加窗（归一化到 sum(w) = DET_N，即含抽取增益）后的 0..DET_MAX_BIN 频点幅度，
+// 零填充到 DET_FFTN
+static void spectrumRef(const std::vector<double> &x, bool hann, double *mag) {
+    std::vector<double> w(DET_N_A, (double)DET_DECIM);
+    if (hann) {
+        double sum = 0;
+        for (size_t i = 0; i < DET_N_A; i++) sum += w[i] = 0.5 * (1 - cos(2 * M_PI * i / DET_N_A));
+        for (double &v : w) v *= DET_N / sum;
+    }
+    std::vector<double> frame(DET_FFTN, 0.0), re(DET_MAX_BIN + 1), im(DET_MAX_BIN + 1);
+    for (size_t i = 0; i < DET_N_A; i++) frame[i] = x[x.size() - DET_N_A + i] * w[i];
+    dftReal(frame.data(), DET_FFTN, DET_MAX_BIN + 1, re.data(), im.data());
+    for (int k = 0; k <= DET_MAX_BIN; k++) mag[k] = hypot(re[k], im[k]);
+}
+
+// 流式输入：多于一个窗口的采样，带直流偏置的低频正弦加噪声（与去基线后的 IMU 信号相近）
+static std::vector<double> detectorSignal(size_t n) {
+    std::uniform_real_distribution<double> d(-1.0, 1.0);
+    const double f = 3.0 + 4.0 * (d(rng) + 1) / 2, ph = d(rng) * M_PI;
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; i++) x[i] = 0.1 + 0.5 * sin(2 * M_PI * f * i / DET_FS_A + ph) + 0.05 * d(rng);
+    return x;
+}
+
+static void addDetector() {
+    const size_t len = 3 * DET_N_A + 17;
+    for (int hann = 0; hann < 2; hann++) {
+        const std::string win = hann ? "hann" : "rect";
+        add("Stft (" + win + ")", DET_FFTN, 125, [len, hann](ErrStat &e) {
+            Stft stft(DET_N_A / 4, hann ? Stft::HANN : Stft::RECT);
+            std::vector<double> x = detectorSignal(len);
+            float in[DET_CHANNELS] = {};
+            for (double v : x) {
+                for (float &c : in) c = (float)v;
+                stft.push(in);
+            }
+            float mag[DET_MAX_BIN + 1];
+            double ref[DET_MAX_BIN + 1];
+            stft.magnitude(0, mag);
+            spectrumRef(std::vector<double>(x.begin(), x.end()), hann, ref);
+            for (int k = 0; k <= DET_MAX_BIN; k++) e.add(ref[k], mag[k]);
+        });
+#if DETECTOR_FFT_POW2
+        // 计数为单位：输入 ±0.5 满量程
+        add("StftQ15 (" + win + ")", DET_FFTN, 45, [len, hann](ErrStat &e) {
+            StftQ15 stft(DET_N_A / 4, hann ? Stft::HANN : Stft::RECT);
+            std::vector<double> x = detectorSignal(len);
+            q15_t in[DET_CHANNELS];
+            std::vector<double> counts(len);
+            for (size_t i = 0; i < len; i++) {
+                const q15_t q = (q15_t)lrint(x[i] * 0.5 / 0.65 * 32767);
+                counts[i] = q;
+                for (q15_t &c : in) c = q;
+                stft.push(in);
+            }
+            q15_t mag[DET_MAX_BIN + 1];
+            double ref[DET_MAX_BIN + 1];
+            const int shift = stft.magnitude(0, mag);
+            spectrumRef(counts, hann, ref);
+            for (int k = 0; k <= DET_MAX_BIN; k++) e.add(ref[k], ldexp(mag[k], StftQ15::MAG_EXP - shift));
+        });
+#endif
+    }
+    // 滑动 DFT：矩形窗，只有 DET_SDFT_BIN_LO..HI 有效；跨过一次重新同步
+    add("SlidingDft", DET_FFTN, 115, [](ErrStat &e) {
+        SlidingDft sdft(1);
+        const size_t n = DET_SDFT_RESYNC + 3 * DET_N_A + 5;
+        std::vector<double> x = detectorSignal(n);
+        float in[DET_CHANNELS];
+        for (double v : x) {
+            for (float &c : in) c = (float)v;
+            sdft.push(in);
+        }
+        float mag[DET_MAX_BIN + 1];
+        double ref[DET_MAX_BIN + 1];
+        sdft.magnitude(0, mag);
+        spectrumRef(std::vector<double>(x.end() - DET_N_A, x.end()), false, ref);
+        for (int k = DET_SDFT_BIN_LO; k <= DET_SDFT_BIN_HI; k++) e.add(ref[k], mag[k]);
+    });
+}
+
+int main(int argc, char **argv) {
+    int trials = 20;
+    const char *filter = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--trials") && i + 1 < argc) trials = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filter = argv[++i];
+        else { usage(); return 2; }
+    }
+    if (trials < 1) { usage(); return 2; }
+
+    addOracle();
+    addTransforms();
+    addMagnitude();
+    addStatistics();
+    addMatrix();
+    addFiltering();
+    addDetector();
+
+    printf("%-34s %6s %10s %10s %8s %8s\n", "kernel", "n", "max err", "rms err", "SNR dB", "budget");
+    int run = 0, failures = 0;
+    for (const Check &c : checks) {
+        if (filter && !strstr(c.name.c_str(), filter)) continue;
+        ErrStat e;
+        for (int t = 0; t < trials; t++) c.run(e);
+        const bool ok = e.snrDb() >= c.budgetDb;
+        ++run;
+        failures += !ok;
+        printf("%-34s %6u %10.2e %10.2e %8.1f %8.0f%s\n", c.name.c_str(), c.n, e.maxRel(), e.rmsRel(),
+               e.snrDb(), c.budgetDb, ok ? "" : "  FAIL");
+    }
+    if (!run) {
+        fprintf(stderr, "accuracy: no check matches %s\n", filter);
+        return 2;
+    }
+    printf("%d checks, %d below budget\n", run, failures);
+    return failures ? 1 : 0;
+}
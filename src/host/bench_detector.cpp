@@ -0,0 +1,342 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "TremorDetector.h"
+#include "DetectorProfile.h"
+#include "Lsm6dslMock.h"
+#include "MotionSource.h"
+
+/*************************************
+ *  检测核心端到端基准                 *
+ *  标准合成负载下的分阶段耗时、每窗口 *
+ *  延迟分位数、吞吐与内存，输出 JSON  *
+ *************************************/
+// 用法: bench_detector [--seconds S] [--repeat K] [--workload NAME] [--hop H] [--rect] [--sdft | --q15]
+//                      [--json FILE] [--label TEXT]
+// 默认与固件配置相同（hop 26、Hann 窗、浮点 FFT）。每个负载由若干段合成运动拼接而成，
+// 经 LSM6DSL 模拟器按 ±2 g / 245 dps 量化；每段标注期望状态，用于统计判定一致率与发作检出延迟。
+// 三遍运行：
+//   吞吐   不插入任何计时，取 K 轮中最快的一轮
+//   延迟   只对 analyze() 计时（窗口最后一个采样到判定），给出 p50 / p99 / max
+//   分阶段 启用 DetectorProfile 的阶段标记（本身有约每标记一次时钟读取的开销）
+// JSON 写入 --json 指定的文件，字段名在不同提交之间保持不变，便于对比回归。
+
+#if !DETECTOR_PROFILE
+#error "bench_detector needs -DDETECTOR_PROFILE=1 (pio run -e bench_detector)"
+#endif
+
+static const int CALIBRATION_WINDOWS = 5;   // 与固件一致
+
+static void usage() {
+    fprintf(stderr, "usage: bench_detector [--seconds S] [--repeat K] [--workload NAME] [--hop H] [--rect] "
+                    "[--sdft | --q15] [--json FILE] [--label TEXT]\n");
+}
+
+static uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*********** 标准负载 ***********/
+enum Expect { EXPECT_REST, EXPECT_TREMOR, EXPECT_DYSK };
+
+struct Segment {
+    const char *spec;   // parseTremorSpec 格式
+    float seconds;      // 段长
+    Expect expect;
+};
+
+struct Workload {
+    const char *name;
+    std::vector<Segment> segments;  // 循环拼接直到总时长
+};
+
+#define REST_SPEC   "g=0:0:1,noise=0.002,gnoise=0.3,drift=2e-4,gdrift=0.02"
+#define TREMOR_SPEC "f=4,acc=0.06,gyr=25,axis=1:0.6:0.2,noise=0.002,gnoise=0.3"
+#define DYSK_SPEC   "f=6,acc=0.12,gyr=40,axis=0.3:1:0.5,noise=0.002,gnoise=0.3"
+#define NOISY_SPEC  "f=4,acc=0.06,gyr=25,axis=1:0.6:0.2,noise=0.02,gnoise=2,drift=2e-3,gdrift=0.2"
+
+static std::vector<Workload> standardWorkloads() {
+    return {
+        {"rest",   {{REST_SPEC, 60, EXPECT_REST}}},
+        {"tremor", {{TREMOR_SPEC, 60, EXPECT_TREMOR}}},
+        {"dysk",   {{DYSK_SPEC, 60, EXPECT_DYSK}}},
+        // 静止、震颤、运动障碍交替，统计发作检出延迟
+        {"mixed",  {{REST_SPEC, 20, EXPECT_REST}, {TREMOR_SPEC, 20, EXPECT_TREMOR},
+                    {REST_SPEC, 10, EXPECT_REST}, {DYSK_SPEC, 20, EXPECT_DYSK}}},
+        // 强噪声 + 零偏漂移下的震颤，每 15 s 改变一次重力方向（姿态变化，基线随之失配）
+        {"noisy",  {{NOISY_SPEC ",g=0:0:1", 15, EXPECT_TREMOR},
+                    {NOISY_SPEC ",g=0.7:0:0.7", 15, EXPECT_TREMOR},
+                    {NOISY_SPEC ",g=0:1:0", 15, EXPECT_TREMOR},
+                    {NOISY_SPEC ",g=-0.5:0.5:0.7", 15, EXPECT_TREMOR}}},
+    };
+}
+
+// 按段生成并量化；labels[i] 为采样 i 所在段的期望状态，starts 为各段起点
+static bool synthesize(const Workload &w, double seconds, std::vector<ImuFrame> &out,
+                       std::vector<uint8_t> &labels, std::vector<size_t> &starts) {
+    const size_t total = (size_t)(seconds * DET_FS);
+    Lsm6dslMock mock;
+    MotionSample block[1024];
+    out.clear();
+    labels.clear();
+    starts.clear();
+    for (uint32_t seg = 0; out.size() < total; seg++) {
+        const Segment &s = w.segments[seg % w.segments.size()];
+        TremorParams tp;
+        if (!parseTremorSpec(s.spec, tp)) {
+            fprintf(stderr, "bench_detector: bad spec %s\n", s.spec);
+            return false;
+        }
+        tp.seed = seg + 1;
+        TremorMotion src(tp);
+        const size_t n = std::min(total - out.size(), (size_t)(s.seconds * DET_FS));
+        starts.push_back(out.size());
+        for (size_t i = 0; i < n;) {
+            size_t k = src.generate(block, std::min(n - i, (size_t)1024), 1.0 / DET_FS);
+            for (size_t j = 0; j < k; j++) out.push_back(mock.quantize(block[j]));
+            i += k;
+        }
+        labels.insert(labels.end(), n, (uint8_t)s.expect);
+    }
+    return true;
+}
+
+/*********** 单个负载的测量 ***********/
+struct Report {
+    std::string name;
+    size_t samples, windows;
+    double samplesPerSec, realtime;
+    double p50, p99, maxUs;         // analyze() 延迟（µs）
+    double stageUs[STAGE_COUNT];    // 每窗口各阶段平均耗时（µs）
+    uint64_t tremorWins, dyskWins;
+    double agreement;               // 完全落在单段内的窗口中，判定与期望一致的比例
+    int onsets, missed;             // 进入震颤 / 运动障碍段的次数与段内未检出次数
+    double onsetMean, onsetMax;     // 发作检出延迟（s，自段起点到第一个一致的判定）
+};
+
+static void calibrate(TremorDetector &det, const std::vector<ImuFrame> &trace, size_t &pos) {
+    const size_t calN = std::min(trace.size(), (size_t)CALIBRATION_WINDOWS * DET_N);
+    for (; pos < calN; pos++) det.accumulateBaseline(trace[pos]);
+    det.finishCalibration();
+}
+
+static Report measure(const Workload &w, const std::vector<ImuFrame> &trace,
+                      const std::vector<uint8_t> &labels, const std::vector<size_t> &starts,
+                      const DetectorConfig &cfg, int repeat) {
+    Report r = Report();
+    r.name = w.name;
+    static volatile float sink;
+    (void)sink;
+
+    // 吞吐：取最快的一轮
+    double best = 1e30;
+    for (int k = 0; k < repeat; k++) {
+        TremorDetector det(cfg);
+        size_t pos = 0;
+        calibrate(det, trace, pos);
+        const size_t first = pos;
+        const uint64_t t0 = nowNs();
+        for (; pos < trace.size(); pos++) {
+            if (det.pushSample(trace[pos])) sink = det.analyze().levelT;
+        }
+        const double sec = (nowNs() - t0) * 1e-9;
+        best = std::min(best, sec);
+        r.samples = trace.size() - first;
+    }
+    r.samplesPerSec = best > 0 ? r.samples / best : 0;
+    r.realtime = r.samplesPerSec / DET_FS;
+
+    // 延迟与判定统计
+    std::vector<double> lat;
+    std::vector<uint8_t> shown;   // 每个窗口的显示状态（Expect 编码）
+    std::vector<size_t> ends;     // 每个窗口的结束采样（不含）
+    {
+        TremorDetector det(cfg);
+        size_t pos = 0;
+        calibrate(det, trace, pos);
+        for (; pos < trace.size(); pos++) {
+            if (!det.pushSample(trace[pos])) continue;
+            const uint64_t t0 = nowNs();
+            const DetectorResult &res = det.analyze();
+            lat.push_back((nowNs() - t0) * 1e-3);
+            r.tremorWins += res.showTremor;
+            r.dyskWins += res.showDyskinesia;
+            shown.push_back(res.showDyskinesia ? EXPECT_DYSK : res.showTremor ? EXPECT_TREMOR : EXPECT_REST);
+            ends.push_back(pos + 1);
+        }
+    }
+    r.windows = lat.size();
+    if (!lat.empty()) {
+        std::sort(lat.begin(), lat.end());
+        r.p50 = lat[lat.size() / 2];
+        r.p99 = lat[std::min(lat.size() - 1, (size_t)(lat.size() * 0.99))];
+        r.maxUs = lat.back();
+    }
+
+    size_t inside = 0, agree = 0;
+    for (size_t i = 0; i < shown.size(); i++) {
+        const size_t lo = ends[i] - DET_N;
+        if (labels[lo] != labels[ends[i] - 1]) continue;
+        // 同一标签的相邻段（如 noisy 的姿态变化）也计入，只排除跨越不同期望状态的窗口
+        ++inside;
+        agree += shown[i] == labels[lo];
+    }
+    r.agreement = inside ? (double)agree / inside : 0;
+
+    double sum = 0;
+    for (size_t s = 1; s < starts.size(); s++) {
+        const size_t st = starts[s];
+        const uint8_t want = labels[st];
+        if (want == EXPECT_REST || labels[st - 1] == want) continue;
+        const size_t en = s + 1 < starts.size() ? starts[s + 1] : trace.size();
+        ++r.onsets;
+        size_t i = std::lower_bound(ends.begin(), ends.end(), st + 1) - ends.begin();
+        while (i < ends.size() && ends[i] <= en && shown[i] != want) ++i;
+        if (i == ends.size() || ends[i] > en) {
+            ++r.missed;
+            continue;
+        }
+        const double d = (double)(ends[i] - st) / DET_FS;
+        sum += d;
+        r.onsetMax = std::max(r.onsetMax, d);
+    }
+    const int found = r.onsets - r.missed;
+    r.onsetMean = found ? sum / found : 0;
+
+    // 分阶段：STAGE_SCALE 由这里标记（每次从上一帧判定之后到 pushSample 返回 true）
+    {
+        TremorDetector det(cfg);
+        size_t pos = 0;
+        calibrate(det, trace, pos);
+        memset(detProfileTotal, 0, sizeof(detProfileTotal));
+        detProfileClock = nowNs;
+        DET_PROFILE_START();
+        for (; pos < trace.size(); pos++) {
+            if (!det.pushSample(trace[pos])) continue;
+            DET_PROFILE_MARK(STAGE_SCALE);
+            sink = det.analyze().levelT;
+            DET_PROFILE_START();
+        }
+        detProfileClock = nullptr;
+        for (int s = 0; s < STAGE_COUNT; s++) {
+            r.stageUs[s] = r.windows ? detProfileTotal[s] * 1e-3 / r.windows : 0;
+        }
+    }
+    return r;
+}
+
+static const char *const STAGE_NAMES[STAGE_COUNT] = {"scale", "fft", "magnitude", "peak", "decision"};
+
+static bool writeJson(const char *path, const char *label, const DetectorConfig &cfg,
+                      double seconds, long maxRssKb, const std::vector<Report> &reports) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n");
+    fprintf(f, "  \"label\": \"");
+    for (const char *c = label; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', f);
+        if ((unsigned char)*c >= 0x20) fputc(*c, f);
+    }
+    fprintf(f, "\",\n");
+    fprintf(f, "  \"compiler\": \"%s\",\n", __VERSION__);
+    fprintf(f, "  \"fft_len\": %u,\n  \"fs\": %u,\n  \"window_len\": %u,\n",
+            (unsigned)DET_FFTN, (unsigned)DET_FS, (unsigned)DET_N);
+    fprintf(f, "  \"engine\": \"%s\",\n  \"hop\": %zu,\n  \"window\": \"%s\",\n",
+            cfg.engine == ENGINE_SDFT ? "sdft" : cfg.engine == ENGINE_Q15 ? "q15" : "fft", cfg.hop,
+            cfg.engine == ENGINE_SDFT || cfg.window != Stft::HANN ? "rect" : "hann");
+    fprintf(f, "  \"seconds\": %.0f,\n", seconds);
+    fprintf(f, "  \"detector_bytes\": %zu,\n  \"max_rss_kb\": %ld,\n",
+            sizeof(TremorDetector), maxRssKb);
+    fprintf(f, "  \"workloads\": [\n");
+    for (size_t i = 0; i < reports.size(); i++) {
+        const Report &r = reports[i];
+        fprintf(f, "    {\n      \"name\": \"%s\",\n", r.name.c_str());
+        fprintf(f, "      \"samples\": %zu,\n      \"windows\": %zu,\n", r.samples, r.windows);
+        fprintf(f, "      \"samples_per_s\": %.0f,\n      \"realtime\": %.0f,\n",
+                r.samplesPerSec, r.realtime);
+        fprintf(f, "      \"latency_us\": {\"p50\": %.3f, \"p99\": %.3f, \"max\": %.3f},\n",
+                r.p50, r.p99, r.maxUs);
+        fprintf(f, "      \"stage_us\": {");
+        for (int s = 0; s < STAGE_COUNT; s++) {
+            fprintf(f, "%s\"%s\": %.3f", s ? ", " : "", STAGE_NAMES[s], r.stageUs[s]);
+        }
+        fprintf(f, "},\n");
+        fprintf(f, "      \"tremor_windows\": %llu,\n      \"dysk_windows\": %llu,\n",
+                (unsigned long long)r.tremorWins, (unsigned long long)r.dyskWins);
+        fprintf(f, "      \"agreement\": %.4f,\n", r.agreement);
+        fprintf(f, "      \"onsets\": %d,\n      \"onsets_missed\": %d,\n", r.onsets, r.missed);
+        fprintf(f, "      \"onset_delay_s\": {\"mean\": %.3f, \"max\": %.3f}\n", r.onsetMean, r.onsetMax);
+        fprintf(f, "    }%s\n", i + 1 < reports.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+    double seconds = 300;
+    int repeat = 5;
+    const char *only = nullptr, *jsonPath = nullptr, *label = "";
+    DetectorConfig cfg;
+    cfg.hop = 26;
+    cfg.window = Stft::HANN;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--workload") && i + 1 < argc) only = argv[++i];
+        else if (!strcmp(argv[i], "--hop") && i + 1 < argc) cfg.hop = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--rect")) cfg.window = Stft::RECT;
+        else if (!strcmp(argv[i], "--sdft")) cfg.engine = ENGINE_SDFT;
+        else if (!strcmp(argv[i], "--q15")) cfg.engine = ENGINE_Q15;
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc) jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--label") && i + 1 < argc) label = argv[++i];
+        else { usage(); return 2; }
+    }
+    if (seconds < CALIBRATION_WINDOWS + 2 || repeat < 1) { usage(); return 2; }
+    const bool built = cfg.engine == ENGINE_Q15 ? DETECTOR_HAS_Q15 : cfg.engine == ENGINE_SDFT ? DETECTOR_HAS_SDFT : DETECTOR_HAS_FFT;
+    if (!built) {
+        fprintf(stderr, "bench_detector: engine not built in (DETECTOR_ENGINES); --q15 also needs a power-of-two DETECTOR_FFT_LEN and no DETECTOR_DECIMATE\n");
+        return 2;
+    }
+
+    std::vector<Report> reports;
+    std::vector<ImuFrame> trace;
+    std::vector<uint8_t> labels;
+    std::vector<size_t> starts;
+    for (const Workload &w : standardWorkloads()) {
+        if (only && strcmp(only, w.name)) continue;
+        if (!synthesize(w, seconds, trace, labels, starts)) return 2;
+        reports.push_back(measure(w, trace, labels, starts, cfg, repeat));
+    }
+    if (reports.empty()) {
+        fprintf(stderr, "bench_detector: unknown workload %s (rest, tremor, dysk, mixed, noisy)\n", only);
+        return 2;
+    }
+
+    printf("%-7s %9s %8s %8s %8s %8s | %7s %7s %7s %7s %7s | %6s %8s\n",
+           "load", "Msamp/s", "p50 us", "p99 us", "max us", "realtime",
+           "scale", "fft", "mag", "peak", "decide", "agree", "onset s");
+    for (const Report &r : reports) {
+        printf("%-7s %9.2f %8.2f %8.2f %8.2f %7.0fx | %7.3f %7.3f %7.3f %7.3f %7.3f | %5.1f%% %8.2f\n",
+               r.name.c_str(), r.samplesPerSec / 1e6, r.p50, r.p99, r.maxUs, r.realtime,
+               r.stageUs[STAGE_SCALE], r.stageUs[STAGE_FFT], r.stageUs[STAGE_MAG],
+               r.stageUs[STAGE_PEAK], r.stageUs[STAGE_DECISION], r.agreement * 100, r.onsetMean);
+    }
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    printf("detector %zu bytes, max RSS %ld kB; stage times are per window (us), scale covers %zu samples\n",
+           sizeof(TremorDetector), ru.ru_maxrss, cfg.hop);
+
+    if (jsonPath && !writeJson(jsonPath, label, cfg, seconds, ru.ru_maxrss, reports)) {
+        fprintf(stderr, "bench_detector: cannot write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "arm_math.h"
+#include "arm_x86_dispatch.h"
+
+#if !defined(ARM_MATH_X86_DISPATCH)
+#error "bench_dispatch needs a CMSIS-DSP build with -DARM_MATH_X86_DISPATCH"
+#endif
+
+/*************************************
+ *  运行时 ISA 分派的开销基准          *
+ *  对每个分派内核分别直接调用 SSE2 /  *
+ *  AVX2 / AVX-512 变体，再经 ifunc    *
+ *  调用公开函数，比较小块长度下的耗时 *
+ *************************************/
+// 用法: bench_dispatch [--sizes 6,16,26,52,104,256,1024] [--json FILE] [--label TEXT]
+//
+// 每个单元格为热缓存下每次调用的纳秒数：每轮至少 200 µs，取 7 轮中最快的一轮。
+// 变体列是对导出符号（如 arm_dot_prod_f32_avx2）的直接调用；dispatched 列调用公开函数，
+// 经 ifunc 解析后多一次经 PLT / GOT 的间接跳转。overhead = dispatched − 所选变体的直接调用，
+// 为几个纳秒内的噪声量级时可视为零。CPU 不支持的变体不计时，显示为 "-"。
+
+static void usage() {
+    fprintf(stderr, "usage: bench_dispatch [--sizes 6,16,26,52,104,256,1024] [--json FILE] [--label TEXT]\n");
+}
+
+static const char *isaName(arm_x86_isa isa) {
+    switch (isa) {
+        case ARM_X86_ISA_AVX512: return "avx512";
+        case ARM_X86_ISA_AVX2: return "avx2";
+        default: return "sse2";
+    }
+}
+
+/*********** 计时 ***********/
+// f 为 lambda，按模板内联后循环体内是对内核符号的直接调用
+template <class F>
+static double nsPerCall(F f) {
+    using clock = std::chrono::steady_clock;
+    f();
+    uint64_t iters = 1;
+    for (;;) {
+        const auto t0 = clock::now();
+        for (uint64_t i = 0; i < iters; i++) f();
+        if (clock::now() - t0 >= std::chrono::microseconds(200) || iters >= (1u << 26)) break;
+        iters *= 2;
+    }
+    double best = 1e300;
+    for (int round = 0; round < 7; round++) {
+        const auto t0 = clock::now();
+        for (uint64_t i = 0; i < iters; i++) f();
+        best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - t0).count() / iters);
+    }
+    return best;
+}
+
+struct Row {
+    std::string kernel;
+    uint32_t n;
+    double ns[3];  // sse2 / avx2 / avx512，不支持时为 NaN
+    double dispatched;
+};
+
+static std::vector<Row> rows;
+static const arm_x86_isa selected = arm_x86_dispatch_isa();
+
+// 同一组参数分别直接调用三个变体与分派后的公开函数
+#define BENCH(NAME, N, ARGS)                                                               \
+    do {                                                                                   \
+        Row row{#NAME, N, {NAN, NAN, NAN}, 0};                                             \
+        row.ns[0] = nsPerCall([&] { NAME##_sse2 ARGS; });                                  \
+        if (selected >= ARM_X86_ISA_AVX2) row.ns[1] = nsPerCall([&] { NAME##_avx2 ARGS; });   \
+        if (selected >= ARM_X86_ISA_AVX512) row.ns[2] = nsPerCall([&] { NAME##_avx512 ARGS; }); \
+        row.dispatched = nsPerCall([&] { NAME ARGS; });                                    \
+        rows.push_back(row);                                                               \
+    } while (0)
+
+static void run(uint32_t n, std::mt19937 &rng) {
+    std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+    std::vector<float32_t> a(n), b(n), cplx(2 * n), out(n);
+    for (auto &v : a) v = d(rng);
+    for (auto &v : b) v = d(rng);
+    for (auto &v : cplx) v = d(rng);
+    float32_t res;
+    uint32_t idx;
+    const float32_t *pa = a.data(), *pb = b.data(), *pc = cplx.data();
+    float32_t *po = out.data();
+
+    BENCH(arm_dot_prod_f32, n, (pa, pb, n, &res));
+    BENCH(arm_mult_f32, n, (pa, pb, po, n));
+    BENCH(arm_scale_f32, n, (pa, 0.5f, po, n));
+    BENCH(arm_cmplx_mag_f32, n, (pc, po, n));
+    BENCH(arm_cmplx_mag_squared_f32, n, (pc, po, n));
+    BENCH(arm_rms_f32, n, (pa, n, &res));
+    BENCH(arm_var_f32, n, (pa, n, &res));
+    BENCH(arm_absmax_f32, n, (pa, n, &res, &idx));
+}
+
+int main(int argc, char **argv) {
+    std::vector<uint32_t> sizes = {6, 16, 26, 52, 104, 256, 1024};
+    const char *jsonPath = nullptr, *label = "";
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--sizes") && i + 1 < argc) {
+            sizes.clear();
+            for (char *p = argv[++i]; *p;) {
+                char *end;
+                const unsigned long v = strtoul(p, &end, 10);
+                if (end == p || v < 1 || v > 65536) { usage(); return 2; }
+                sizes.push_back((uint32_t)v);
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc) jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--label") && i + 1 < argc) label = argv[++i];
+        else { usage(); return 2; }
+    }
+    if (sizes.empty()) { usage(); return 2; }
+
+    std::mt19937 rng(1);
+    for (uint32_t n : sizes) run(n, rng);
+    std::stable_sort(rows.begin(), rows.end(),
+                     [](const Row &x, const Row &y) { return x.kernel < y.kernel; });
+
+    printf("dispatch selects %s on this CPU; ns per call\n", isaName(selected));
+    printf("%-26s %6s %9s %9s %9s %10s %9s\n", "kernel", "n", "sse2", "avx2", "avx512", "dispatched", "overhead");
+    for (const Row &r : rows) {
+        printf("%-26s %6u", r.kernel.c_str(), r.n);
+        for (double v : r.ns) {
+            if (isnan(v)) printf(" %9s", "-");
+            else printf(" %9.1f", v);
+        }
+        printf(" %10.1f %9.1f\n", r.dispatched, r.dispatched - r.ns[selected]);
+    }
+
+    if (jsonPath) {
+        FILE *json = fopen(jsonPath, "w");
+        if (!json) {
+            fprintf(stderr, "bench_dispatch: cannot create %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(json, "{\n  \"label\": \"");
+        for (const char *c = label; *c; c++) {
+            if (*c == '"' || *c == '\\') fputc('\\', json);
+            if ((unsigned char)*c >= 0x20) fputc(*c, json);
+        }
+        fprintf(json, "\",\n  \"compiler\": \"%s\",\n  \"selected_isa\": \"%s\",\n  \"kernels\": [\n",
+                __VERSION__, isaName(selected));
+        for (size_t i = 0; i < rows.size(); i++) {
+            const Row &r = rows[i];
+            fprintf(json, "%s    {\"kernel\": \"%s\", \"n\": %u", i ? ",\n" : "", r.kernel.c_str(), r.n);
+            for (int v = 0; v < 3; v++) {
+                if (isnan(r.ns[v])) fprintf(json, ", \"%s_ns\": null", isaName((arm_x86_isa)v));
+                else fprintf(json, ", \"%s_ns\": %.2f", isaName((arm_x86_isa)v), r.ns[v]);
+            }
+            fprintf(json, ", \"dispatched_ns\": %.2f, \"overhead_ns\": %.2f}", r.dispatched,
+                    r.dispatched - r.ns[selected]);
+        }
+        fprintf(json, "\n  ]\n}\n");
+        if (fclose(json) != 0) {
+            fprintf(stderr, "bench_dispatch: cannot write %s\n", jsonPath);
+            return 1;
+        }
+    }
+    return 0;
+}
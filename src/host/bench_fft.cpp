@@ -0,0 +1,190 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+#include "DetectorParams.h"
+
+/*************************************
+ *  裁剪实数 FFT 与完整变换的性能对比  *
+ *************************************/
+// 用法: bench_fft [MAX_HZ] [--iters K]
+// 对 256/512/1024 点，比较 arm_rfft_fast_f32（含输入拷贝）与只输出
+// 0..MAX_HZ 频点的 arm_rfft_pruned_f32，并检查两者结果一致；
+// 再对 104/208/312 点（1/2/3 s 窗口）比较任意长度的 arm_rfft_mixed_f32
+// 与零填充到 2 的幂的 arm_rfft_fast_f32，并与双精度 DFT 对比误差；
+// 最后比较 6 通道逐个 arm_rfft_fast_f32 与成对打包的 arm_rfft_fast_multi_f32。
+
+static void usage() {
+    fprintf(stderr, "usage: bench_fft [MAX_HZ] [--iters K]\n");
+}
+
+// 取 5 轮中最快的一轮，减少调度与频率变化带来的噪声
+template <class F>
+static double timeUs(int iters, F &&fn) {
+    double best = 1e30;
+    fn();  // 预热
+    for (int round = 0; round < 5; round++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++) fn();
+        double us = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - t0).count() / iters;
+        if (us < best) best = us;
+    }
+    return best;
+}
+
+// 两个版本轮流计时（各取最快一轮），两者受同样的频率与调度波动影响，比值更稳定
+template <class F, class G>
+static void timePairUs(int iters, F &&fa, G &&fb, double &ta, double &tb) {
+    ta = tb = 1e30;
+    for (int round = 0; round < 5; round++) {
+        ta = fmin(ta, timeUs(iters / 5 + 1, fa));
+        tb = fmin(tb, timeUs(iters / 5 + 1, fb));
+    }
+}
+
+int main(int argc, char **argv) {
+    float maxHz = 15.0f;
+    int iters = 20000;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iters") && i + 1 < argc) iters = atoi(argv[++i]);
+        else if (argv[i][0] != '-') maxHz = (float)atof(argv[i]);
+        else { usage(); return 2; }
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    static volatile float sink;
+    (void)sink;
+    int failures = 0;
+
+    printf("%6s %6s %6s %4s %12s %12s %8s %10s\n",
+           "N", "maxBin", "P", "Q", "full us", "pruned us", "speedup", "max err");
+    for (uint16_t n : {256, 512, 1024}) {
+        uint16_t maxBin = (uint16_t)(maxHz * n / DET_FS);
+        if (maxBin >= n / 2) maxBin = n / 2 - 1;
+
+        arm_rfft_fast_instance_f32 full;
+        arm_rfft_pruned_instance_f32 pruned;
+        if (arm_rfft_fast_init_f32(&full, n) != ARM_MATH_SUCCESS ||
+            arm_rfft_pruned_init_f32(&pruned, n, maxBin) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "bench_fft: init failed for N=%u\n", n);
+            return 1;
+        }
+
+        std::vector<float> x(n), tmp(n), outFull(n), outPruned(2 * (maxBin + 1)),
+                           scratch(2 * pruned.fftLenSub);
+        for (float &v : x) v = dist(rng);
+
+        // 完整变换会改写输入，每次先拷贝，与实际使用方式一致
+        double tFull, tPruned;
+        timePairUs(iters, [&] {
+            memcpy(tmp.data(), x.data(), n * sizeof(float));
+            arm_rfft_fast_f32(&full, tmp.data(), outFull.data(), 0);
+            sink = outFull[2];
+        }, [&] {
+            arm_rfft_pruned_f32(&pruned, x.data(), outPruned.data(), scratch.data());
+            sink = outPruned[2];
+        }, tFull, tPruned);
+
+        // 正确性：与完整变换逐频点比较（bin 0 的虚部在完整变换中是 Nyquist）
+        float err = fabsf(outPruned[0] - outFull[0]) + fabsf(outPruned[1]);
+        for (int k = 1; k <= maxBin; k++) {
+            err = fmaxf(err, fabsf(outPruned[2 * k] - outFull[2 * k]));
+            err = fmaxf(err, fabsf(outPruned[2 * k + 1] - outFull[2 * k + 1]));
+        }
+        if (err > 1e-4f * n) ++failures;
+
+        printf("%6u %6u %6u %4u %12.3f %12.3f %7.2fx %10.2e\n",
+               n, maxBin, pruned.fftLenSub, pruned.numSub, tFull, tPruned,
+               tFull / tPruned, err);
+    }
+
+    printf("\n%6s %6s %12s %12s %8s %10s\n",
+           "N", "pow2", "mixed us", "padded us", "ratio", "rel err");
+    for (uint16_t n : {104, 208, 312}) {
+        uint16_t p2 = 32;
+        while (p2 < n) p2 <<= 1;
+
+        arm_rfft_mixed_instance_f32 mixed;
+        arm_rfft_fast_instance_f32 padded;
+        std::vector<float> state(arm_rfft_mixed_state_len_f32(n)),
+                           scratch(arm_rfft_mixed_scratch_len_f32(n));
+        if (arm_rfft_mixed_init_f32(&mixed, n, state.data(), state.size()) != ARM_MATH_SUCCESS ||
+            arm_rfft_fast_init_f32(&padded, p2) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "bench_fft: init failed for N=%u\n", n);
+            return 1;
+        }
+
+        std::vector<float> x(n), out(n), tmp(p2, 0.0f), outPad(p2);
+        for (float &v : x) v = dist(rng);
+
+        double tMixed = timeUs(iters, [&] {
+            arm_rfft_mixed_f32(&mixed, x.data(), out.data(), scratch.data(), 0);
+            sink = out[2];
+        });
+        double tPadded = timeUs(iters, [&] {
+            memcpy(tmp.data(), x.data(), n * sizeof(float));
+            memset(tmp.data() + n, 0, (p2 - n) * sizeof(float));
+            arm_rfft_fast_f32(&padded, tmp.data(), outPad.data(), 0);
+            sink = outPad[2];
+        });
+
+        // 双精度 DFT 参考（bin 1..N/2-1）
+        double err = 0, peak = 0;
+        for (int k = 1; k < n / 2; k++) {
+            double re = 0, im = 0;
+            for (int i = 0; i < n; i++) {
+                double a = -2.0 * M_PI * (double)((k * i) % n) / n;
+                re += x[i] * cos(a);
+                im += x[i] * sin(a);
+            }
+            err = fmax(err, fabs(re - out[2 * k]) + fabs(im - out[2 * k + 1]));
+            peak = fmax(peak, fabs(re) + fabs(im));
+        }
+        if (err / peak > 1e-5) ++failures;
+
+        printf("%6u %6u %12.3f %12.3f %7.2fx %10.2e\n",
+               n, p2, tMixed, tPadded, tPadded / tMixed, err / peak);
+    }
+
+    printf("\n%6s %4s %12s %12s %8s %10s\n",
+           "N", "ch", "single us", "multi us", "speedup", "max err");
+    for (uint16_t n : {128, 256, 512, 1024}) {
+        const int ch = DET_CHANNELS;
+        arm_rfft_fast_instance_f32 single;
+        arm_rfft_fast_multi_instance_f32 multi;
+        if (arm_rfft_fast_init_f32(&single, n) != ARM_MATH_SUCCESS ||
+            arm_rfft_fast_multi_init_f32(&multi, n) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "bench_fft: init failed for N=%u\n", n);
+            return 1;
+        }
+
+        std::vector<float> x(ch * n), tmp(n), outS(ch * n), outM(ch * n), scratch(2 * n);
+        for (float &v : x) v = dist(rng);
+
+        double tSingle = timeUs(iters / 4, [&] {
+            for (int c = 0; c < ch; c++) {
+                memcpy(tmp.data(), x.data() + c * n, n * sizeof(float));
+                arm_rfft_fast_f32(&single, tmp.data(), outS.data() + c * n, 0);
+            }
+            sink = outS[2];
+        });
+        double tMulti = timeUs(iters / 4, [&] {
+            arm_rfft_fast_multi_f32(&multi, x.data(), outM.data(), scratch.data(), ch);
+            sink = outM[2];
+        });
+
+        float err = 0;
+        for (int i = 0; i < ch * n; i++) err = fmaxf(err, fabsf(outS[i] - outM[i]));
+        if (err > 1e-4f * n) ++failures;
+
+        printf("%6u %4d %12.3f %12.3f %7.2fx %10.2e\n",
+               n, ch, tSingle, tMulti, tSingle / tMulti, err);
+    }
+    return failures ? 1 : 0;
+}
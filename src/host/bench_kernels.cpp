@@ -0,0 +1,684 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "arm_math.h"
+
+/*************************************
+ *  CMSIS-DSP 内核微基准              *
+ *  覆盖 lib/CMSIS_DSP/src 各函数族    *
+ *  中有代表性的内核与变体，给出冷 /   *
+ *  热缓存下的周期/元素与字节/元素     *
+ *************************************/
+// 用法: bench_kernels [--sizes 64,256,1024,4096] [--filter TEXT] [--cold K] [--json FILE] [--label TEXT]
+//
+// 周期：x86 上为 TSC 参考周期（与睿频无关的恒定频率，频率打印在表头），其他平台为纳秒。
+// 热缓存：同一组缓冲反复调用，每轮至少 200 µs，取 5 轮中最快的一轮；
+// 冷缓存：每次调用前把内核的全部数据缓冲逐行 clflush（非 x86 上改为扫过一块大缓冲），
+// 单次计时取 K 次的中位数。系数表 / 旋转因子不在数据缓冲中，冷缓存下仍可能命中。
+// 字节/元素为每个元素读写的数据量（输入 + 输出，不含系数与状态），GB/s 按热缓存时间计算。
+// 原位 FFT 交替做正变换与逆变换，使浮点数据保持有界；定点 FFT 逐级缩放，不会溢出。
+
+static void usage() {
+    fprintf(stderr, "usage: bench_kernels [--sizes 64,256,1024,4096] [--filter TEXT] [--cold K] "
+                    "[--json FILE] [--label TEXT]\n");
+}
+
+/*********** 计时 ***********/
+static inline uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    const uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+// 每纳秒的 tick 数（非 x86 上为 1）
+static double ticksPerNs() {
+#if defined(__x86_64__) || defined(__i386__)
+    const auto c0 = std::chrono::steady_clock::now();
+    const uint64_t t0 = ticks();
+    while (std::chrono::steady_clock::now() - c0 < std::chrono::milliseconds(50)) {}
+    const uint64_t t1 = ticks();
+    return (t1 - t0) / std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - c0).count();
+#else
+    return 1.0;
+#endif
+}
+
+/*********** 测试用例 ***********/
+// 每个用例在自己的缓冲区中分配数据（冷缓存时逐块刷出），run 执行一次内核
+struct Case {
+    std::string family, name;
+    uint32_t n;
+    double bytesPerElem;
+    std::function<void()> run;
+    std::vector<std::vector<uint8_t>> bufs;
+
+    template <class T>
+    T *zeros(size_t count) {
+        bufs.emplace_back(count * sizeof(T) + 64, 0);
+        // 64 字节对齐，与 MCU 上的静态缓冲一致地避免跨行
+        uintptr_t p = (uintptr_t)bufs.back().data();
+        return (T *)((p + 63) & ~(uintptr_t)63);
+    }
+    float32_t *f32(size_t count, float amp = 1.0f);
+    q15_t *q15(size_t count, float amp = 0.5f);
+    q31_t *q31(size_t count, float amp = 0.5f);
+};
+
+static std::mt19937 rng(1);
+
+float32_t *Case::f32(size_t count, float amp) {
+    std::uniform_real_distribution<float> d(-amp, amp);
+    float32_t *p = zeros<float32_t>(count);
+    for (size_t i = 0; i < count; i++) p[i] = d(rng);
+    return p;
+}
+
+q15_t *Case::q15(size_t count, float amp) {
+    std::uniform_real_distribution<float> d(-amp, amp);
+    q15_t *p = zeros<q15_t>(count);
+    for (size_t i = 0; i < count; i++) p[i] = (q15_t)lrintf(d(rng) * 32767.0f);
+    return p;
+}
+
+q31_t *Case::q31(size_t count, float amp) {
+    std::uniform_real_distribution<double> d(-amp, amp);
+    q31_t *p = zeros<q31_t>(count);
+    for (size_t i = 0; i < count; i++) p[i] = (q31_t)llrint(d(rng) * 2147483647.0);
+    return p;
+}
+
+static std::vector<Case> cases;
+
+static Case &add(const char *family, const std::string &name, uint32_t n, double bytesPerElem) {
+    cases.emplace_back();
+    Case &c = cases.back();
+    c.family = family;
+    c.name = name;
+    c.n = n;
+    c.bytesPerElem = bytesPerElem;
+    return c;
+}
+
+static bool isPow4(uint32_t n) { return (n & (n - 1)) == 0 && (n & 0x55555555u); }
+
+// 二阶低通（RBJ，fc = 0.1 fs），CMSIS 约定反馈系数取负
+static void lowpassBiquad(double c[5]) {
+    const double w = 2 * M_PI * 0.1, alpha = sin(w) / (2 * 0.7071), cw = cos(w), a0 = 1 + alpha;
+    c[0] = (1 - cw) / 2 / a0;
+    c[1] = (1 - cw) / a0;
+    c[2] = (1 - cw) / 2 / a0;
+    c[3] = 2 * cw / a0;
+    c[4] = -(1 - alpha) / a0;
+}
+
+/*********** 用例注册 ***********/
+static const int FIR_TAPS = 32;
+static const int BIQUAD_STAGES = 4;
+static const int DECIMATE_M = 4;
+static const int IMU_CHANNELS = 6;  // 多通道 biquad 用例的通道数（加速度 + 角速度 6 轴）
+
+static void addBasic(uint32_t n) {
+#define BINARY(fn, T, gen)                                                   \
+    { Case &c = add("Basic", #fn, n, 3 * sizeof(T));                         \
+      T *a = c.gen(n), *b = c.gen(n), *d = c.zeros<T>(n);                    \
+      c.run = [=] { fn(a, b, d, n); }; }
+    BINARY(arm_add_f32, float32_t, f32) BINARY(arm_add_q15, q15_t, q15) BINARY(arm_add_q31, q31_t, q31)
+    BINARY(arm_mult_f32, float32_t, f32) BINARY(arm_mult_q15, q15_t, q15) BINARY(arm_mult_q31, q31_t, q31)
+#undef BINARY
+    { Case &c = add("Basic", "arm_scale_f32", n, 8);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_scale_f32(a, 0.75f, d, n); }; }
+    { Case &c = add("Basic", "arm_scale_q15", n, 4);
+      q15_t *a = c.q15(n), *d = c.zeros<q15_t>(n);
+      c.run = [=] { arm_scale_q15(a, 0x6000, 0, d, n); }; }
+    { Case &c = add("Basic", "arm_scale_q31", n, 8);
+      q31_t *a = c.q31(n), *d = c.zeros<q31_t>(n);
+      c.run = [=] { arm_scale_q31(a, 0x60000000, 0, d, n); }; }
+    { Case &c = add("Basic", "arm_abs_f32", n, 8);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_abs_f32(a, d, n); }; }
+    { Case &c = add("Basic", "arm_dot_prod_f32", n, 8);
+      float32_t *a = c.f32(n), *b = c.f32(n), *r = c.zeros<float32_t>(1);
+      c.run = [=] { arm_dot_prod_f32(a, b, n, r); }; }
+    { Case &c = add("Basic", "arm_dot_prod_q15", n, 4);
+      q15_t *a = c.q15(n), *b = c.q15(n);
+      q63_t *r = c.zeros<q63_t>(1);
+      c.run = [=] { arm_dot_prod_q15(a, b, n, r); }; }
+    { Case &c = add("Basic", "arm_dot_prod_q31", n, 8);
+      q31_t *a = c.q31(n), *b = c.q31(n);
+      q63_t *r = c.zeros<q63_t>(1);
+      c.run = [=] { arm_dot_prod_q31(a, b, n, r); }; }
+}
+
+static void addComplex(uint32_t n) {
+    // 元素为一个复数采样
+#define CMAG(fn, T, gen)                                                     \
+    { Case &c = add("Complex", #fn, n, 3 * sizeof(T));                       \
+      T *a = c.gen(2 * n), *d = c.zeros<T>(n);                               \
+      c.run = [=] { fn(a, d, n); }; }
+    CMAG(arm_cmplx_mag_f32, float32_t, f32) CMAG(arm_cmplx_mag_q15, q15_t, q15)
+    CMAG(arm_cmplx_mag_fast_q15, q15_t, q15) CMAG(arm_cmplx_mag_q31, q31_t, q31)
+    CMAG(arm_cmplx_mag_squared_f32, float32_t, f32) CMAG(arm_cmplx_mag_squared_q15, q15_t, q15)
+    CMAG(arm_cmplx_mag_squared_q31, q31_t, q31)
+#undef CMAG
+    { Case &c = add("Complex", "arm_cmplx_mult_cmplx_f32", n, 24);
+      float32_t *a = c.f32(2 * n), *b = c.f32(2 * n), *d = c.zeros<float32_t>(2 * n);
+      c.run = [=] { arm_cmplx_mult_cmplx_f32(a, b, d, n); }; }
+    { Case &c = add("Complex", "arm_cmplx_dot_prod_f32", n, 16);
+      float32_t *a = c.f32(2 * n), *b = c.f32(2 * n), *r = c.zeros<float32_t>(2);
+      c.run = [=] { arm_cmplx_dot_prod_f32(a, b, n, r, r + 1); }; }
+}
+
+static void addStatistics(uint32_t n) {
+#define STAT(fn, T, R, gen)                                                  \
+    { Case &c = add("Statistics", #fn, n, sizeof(T));                        \
+      T *a = c.gen(n); R *r = c.zeros<R>(1);                                 \
+      c.run = [=] { fn(a, n, r); }; }
+    STAT(arm_mean_f32, float32_t, float32_t, f32) STAT(arm_mean_q15, q15_t, q15_t, q15)
+    STAT(arm_mean_q31, q31_t, q31_t, q31)
+    STAT(arm_rms_f32, float32_t, float32_t, f32) STAT(arm_rms_q15, q15_t, q15_t, q15)
+    STAT(arm_rms_q31, q31_t, q31_t, q31)
+    STAT(arm_var_f32, float32_t, float32_t, f32) STAT(arm_var_q15, q15_t, q15_t, q15)
+    STAT(arm_var_q31, q31_t, q31_t, q31)
+    STAT(arm_std_f32, float32_t, float32_t, f32)
+    STAT(arm_power_f32, float32_t, float32_t, f32) STAT(arm_power_q15, q15_t, q63_t, q15)
+    STAT(arm_power_q31, q31_t, q63_t, q31)
+    STAT(arm_max_no_idx_f32, float32_t, float32_t, f32)
+    STAT(arm_absmax_no_idx_f32, float32_t, float32_t, f32) STAT(arm_absmax_no_idx_q15, q15_t, q15_t, q15)
+    STAT(arm_absmax_no_idx_q31, q31_t, q31_t, q31)
+#undef STAT
+#define STAT_IDX(fn, T, gen)                                                 \
+    { Case &c = add("Statistics", #fn, n, sizeof(T));                        \
+      T *a = c.gen(n), *r = c.zeros<T>(1); uint32_t *i = c.zeros<uint32_t>(1); \
+      c.run = [=] { fn(a, n, r, i); }; }
+    STAT_IDX(arm_max_f32, float32_t, f32) STAT_IDX(arm_max_q15, q15_t, q15)
+    STAT_IDX(arm_max_q31, q31_t, q31) STAT_IDX(arm_min_f32, float32_t, f32)
+    STAT_IDX(arm_absmax_f32, float32_t, f32)
+#undef STAT_IDX
+}
+
+static void addFastMath(uint32_t n) {
+    { Case &c = add("FastMath", "arm_sin_f32", n, 8);
+      float32_t *a = c.f32(n, 3.14f), *d = c.zeros<float32_t>(n);
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) d[i] = arm_sin_f32(a[i]); }; }
+    { Case &c = add("FastMath", "arm_cos_f32", n, 8);
+      float32_t *a = c.f32(n, 3.14f), *d = c.zeros<float32_t>(n);
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) d[i] = arm_cos_f32(a[i]); }; }
+    { Case &c = add("FastMath", "arm_sin_q15", n, 4);
+      q15_t *a = c.q15(n, 1.0f), *d = c.zeros<q15_t>(n);
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) d[i] = arm_sin_q15(a[i] & 0x7FFF); }; }
+    { Case &c = add("FastMath", "arm_sqrt_q31", n, 8);
+      q31_t *a = c.q31(n, 1.0f), *d = c.zeros<q31_t>(n);
+      for (uint32_t i = 0; i < n; i++) a[i] &= 0x7FFFFFFF;
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) arm_sqrt_q31(a[i], d + i); }; }
+    { Case &c = add("FastMath", "arm_vexp_f32", n, 8);
+      float32_t *a = c.f32(n, 4.0f), *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_vexp_f32(a, d, n); }; }
+    { Case &c = add("FastMath", "arm_vlog_f32", n, 8);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      for (uint32_t i = 0; i < n; i++) a[i] = fabsf(a[i]) + 1e-3f;
+      c.run = [=] { arm_vlog_f32(a, d, n); }; }
+}
+
+static void addTransform(uint32_t n) {
+    // 复数 FFT：元素为一个复数采样，原位读写
+    if (n >= 16 && n <= 4096) {
+        { Case &c = add("Transform", "arm_cfft_f32", n, 16);
+          arm_cfft_instance_f32 *s = c.zeros<arm_cfft_instance_f32>(1);
+          float32_t *x = c.f32(2 * n);
+          arm_cfft_init_f32(s, n);
+          bool *inv = c.zeros<bool>(1);
+          c.run = [=] { arm_cfft_f32(s, x, *inv, 1); *inv = !*inv; }; }
+        { Case &c = add("Transform", "arm_cfft_q15", n, 8);
+          arm_cfft_instance_q15 *s = c.zeros<arm_cfft_instance_q15>(1);
+          q15_t *x = c.q15(2 * n);
+          arm_cfft_init_q15(s, n);
+          c.run = [=] { arm_cfft_q15(s, x, 0, 1); }; }
+        { Case &c = add("Transform", "arm_cfft_q31", n, 16);
+          arm_cfft_instance_q31 *s = c.zeros<arm_cfft_instance_q31>(1);
+          q31_t *x = c.q31(2 * n);
+          arm_cfft_init_q31(s, n);
+          c.run = [=] { arm_cfft_q31(s, x, 0, 1); }; }
+        { Case &c = add("Transform", "arm_cfft_radix2_f32", n, 16);
+          arm_cfft_radix2_instance_f32 *s = c.zeros<arm_cfft_radix2_instance_f32>(2);
+          float32_t *x = c.f32(2 * n);
+          arm_cfft_radix2_init_f32(s, n, 0, 1);
+          arm_cfft_radix2_init_f32(s + 1, n, 1, 1);
+          bool *inv = c.zeros<bool>(1);
+          c.run = [=] { arm_cfft_radix2_f32(s + *inv, x); *inv = !*inv; }; }
+        { Case &c = add("Transform", "arm_cfft_radix2_q15", n, 8);
+          arm_cfft_radix2_instance_q15 *s = c.zeros<arm_cfft_radix2_instance_q15>(1);
+          q15_t *x = c.q15(2 * n);
+          arm_cfft_radix2_init_q15(s, n, 0, 1);
+          c.run = [=] { arm_cfft_radix2_q15(s, x); }; }
+        { Case &c = add("Transform", "arm_cfft_radix2_q31", n, 16);
+          arm_cfft_radix2_instance_q31 *s = c.zeros<arm_cfft_radix2_instance_q31>(1);
+          q31_t *x = c.q31(2 * n);
+          arm_cfft_radix2_init_q31(s, n, 0, 1);
+          c.run = [=] { arm_cfft_radix2_q31(s, x); }; }
+    }
+    if (isPow4(n) && n <= 4096) {
+        { Case &c = add("Transform", "arm_cfft_radix4_f32", n, 16);
+          arm_cfft_radix4_instance_f32 *s = c.zeros<arm_cfft_radix4_instance_f32>(2);
+          float32_t *x = c.f32(2 * n);
+          arm_cfft_radix4_init_f32(s, n, 0, 1);
+          arm_cfft_radix4_init_f32(s + 1, n, 1, 1);
+          bool *inv = c.zeros<bool>(1);
+          c.run = [=] { arm_cfft_radix4_f32(s + *inv, x); *inv = !*inv; }; }
+        { Case &c = add("Transform", "arm_cfft_radix4_q15", n, 8);
+          arm_cfft_radix4_instance_q15 *s = c.zeros<arm_cfft_radix4_instance_q15>(1);
+          q15_t *x = c.q15(2 * n);
+          arm_cfft_radix4_init_q15(s, n, 0, 1);
+          c.run = [=] { arm_cfft_radix4_q15(s, x); }; }
+        { Case &c = add("Transform", "arm_cfft_radix4_q31", n, 16);
+          arm_cfft_radix4_instance_q31 *s = c.zeros<arm_cfft_radix4_instance_q31>(1);
+          q31_t *x = c.q31(2 * n);
+          arm_cfft_radix4_init_q31(s, n, 0, 1);
+          c.run = [=] { arm_cfft_radix4_q31(s, x); }; }
+    }
+    // 实数 FFT：元素为一个实数采样
+    if (n >= 32 && n <= 4096) {
+        { Case &c = add("Transform", "arm_rfft_fast_f32", n, 8);
+          arm_rfft_fast_instance_f32 *s = c.zeros<arm_rfft_fast_instance_f32>(1);
+          float32_t *x = c.f32(n), *y = c.zeros<float32_t>(n);
+          arm_rfft_fast_init_f32(s, n);
+          bool *inv = c.zeros<bool>(1);
+          // 正变换 x→y 与逆变换 y→x 交替（两者都改写输入）
+          c.run = [=] {
+              if (*inv) arm_rfft_fast_f32(s, y, x, 1);
+              else arm_rfft_fast_f32(s, x, y, 0);
+              *inv = !*inv;
+          }; }
+        { Case &c = add("Transform", "arm_rfft_pruned_f32", n, 4);
+          arm_rfft_pruned_instance_f32 *s = c.zeros<arm_rfft_pruned_instance_f32>(1);
+          const uint16_t maxBin = (uint16_t)std::max(1u, n / 64);
+          arm_rfft_pruned_init_f32(s, n, maxBin);
+          float32_t *x = c.f32(n), *y = c.zeros<float32_t>(2 * (maxBin + 1)),
+                    *scratch = c.zeros<float32_t>(2 * s->fftLenSub);
+          c.name += "/64";
+          c.run = [=] { arm_rfft_pruned_f32(s, x, y, scratch); }; }
+        { Case &c = add("Transform", "arm_rfft_q15", n, 6);
+          arm_rfft_instance_q15 *s = c.zeros<arm_rfft_instance_q15>(1);
+          q15_t *x = c.q15(n), *y = c.zeros<q15_t>(2 * n);
+          arm_rfft_init_q15(s, n, 0, 1);
+          c.run = [=] { arm_rfft_q15(s, x, y); }; }
+        { Case &c = add("Transform", "arm_rfft_q31", n, 12);
+          arm_rfft_instance_q31 *s = c.zeros<arm_rfft_instance_q31>(1);
+          q31_t *x = c.q31(n), *y = c.zeros<q31_t>(2 * n);
+          arm_rfft_init_q31(s, n, 0, 1);
+          c.run = [=] { arm_rfft_q31(s, x, y); }; }
+    }
+}
+
+static void addFiltering(uint32_t n) {
+    const std::string taps = "/" + std::to_string(FIR_TAPS) + "taps";
+    const std::string stages = "/" + std::to_string(BIQUAD_STAGES) + "st";
+    { Case &c = add("Filtering", "arm_fir_f32" + taps, n, 8);
+      arm_fir_instance_f32 *s = c.zeros<arm_fir_instance_f32>(1);
+      float32_t *h = c.f32(FIR_TAPS, 0.1f), *x = c.f32(n), *y = c.zeros<float32_t>(n);
+      arm_fir_init_f32(s, FIR_TAPS, h, c.zeros<float32_t>(n + FIR_TAPS - 1), n);
+      c.run = [=] { arm_fir_f32(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_fir_q15" + taps, n, 4);
+      arm_fir_instance_q15 *s = c.zeros<arm_fir_instance_q15>(1);
+      q15_t *h = c.q15(FIR_TAPS, 0.05f), *x = c.q15(n), *y = c.zeros<q15_t>(n);
+      arm_fir_init_q15(s, FIR_TAPS, h, c.zeros<q15_t>(n + FIR_TAPS), n);
+      c.run = [=] { arm_fir_q15(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_fir_fast_q15" + taps, n, 4);
+      arm_fir_instance_q15 *s = c.zeros<arm_fir_instance_q15>(1);
+      q15_t *h = c.q15(FIR_TAPS, 0.05f), *x = c.q15(n), *y = c.zeros<q15_t>(n);
+      arm_fir_init_q15(s, FIR_TAPS, h, c.zeros<q15_t>(n + FIR_TAPS), n);
+      c.run = [=] { arm_fir_fast_q15(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_fir_q31" + taps, n, 8);
+      arm_fir_instance_q31 *s = c.zeros<arm_fir_instance_q31>(1);
+      q31_t *h = c.q31(FIR_TAPS, 0.05f), *x = c.q31(n), *y = c.zeros<q31_t>(n);
+      arm_fir_init_q31(s, FIR_TAPS, h, c.zeros<q31_t>(n + FIR_TAPS - 1), n);
+      c.run = [=] { arm_fir_q31(s, x, y, n); }; }
+    if (n % DECIMATE_M == 0) {
+        Case &c = add("Filtering", "arm_fir_decimate_f32" + taps + "/M4", n, 4 + 4.0 / DECIMATE_M);
+        arm_fir_decimate_instance_f32 *s = c.zeros<arm_fir_decimate_instance_f32>(1);
+        float32_t *h = c.f32(FIR_TAPS, 0.1f), *x = c.f32(n), *y = c.zeros<float32_t>(n / DECIMATE_M);
+        arm_fir_decimate_init_f32(s, FIR_TAPS, DECIMATE_M, h, c.zeros<float32_t>(n + FIR_TAPS - 1), n);
+        c.run = [=] { arm_fir_decimate_f32(s, x, y, n); };
+    }
+
+    double bq[5];
+    lowpassBiquad(bq);
+    { Case &c = add("Filtering", "arm_biquad_cascade_df1_f32" + stages, n, 8);
+      arm_biquad_casd_df1_inst_f32 *s = c.zeros<arm_biquad_casd_df1_inst_f32>(1);
+      float32_t *k = c.zeros<float32_t>(5 * BIQUAD_STAGES), *x = c.f32(n), *y = c.zeros<float32_t>(n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (float32_t)bq[i % 5];
+      arm_biquad_cascade_df1_init_f32(s, BIQUAD_STAGES, k, c.zeros<float32_t>(4 * BIQUAD_STAGES));
+      c.run = [=] { arm_biquad_cascade_df1_f32(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_biquad_cascade_df2T_f32" + stages, n, 8);
+      arm_biquad_cascade_df2T_instance_f32 *s = c.zeros<arm_biquad_cascade_df2T_instance_f32>(1);
+      float32_t *k = c.zeros<float32_t>(5 * BIQUAD_STAGES), *x = c.f32(n), *y = c.zeros<float32_t>(n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (float32_t)bq[i % 5];
+      arm_biquad_cascade_df2T_init_f32(s, BIQUAD_STAGES, k, c.zeros<float32_t>(2 * BIQUAD_STAGES));
+      c.run = [=] { arm_biquad_cascade_df2T_f32(s, x, y, n); }; }
+    // 6 个通道：逐通道调用单通道 df2T 与一次处理整块通道的 planar（平面）/ multich（交错）版本对比，
+    // 元素 = 每通道一个采样
+    { Case &c = add("Filtering", "6x arm_biquad_cascade_df2T_f32" + stages, n, 8 * IMU_CHANNELS);
+      arm_biquad_cascade_df2T_instance_f32 *s = c.zeros<arm_biquad_cascade_df2T_instance_f32>(IMU_CHANNELS);
+      float32_t *k = c.zeros<float32_t>(5 * BIQUAD_STAGES), *x = c.f32(IMU_CHANNELS * n),
+                *y = c.zeros<float32_t>(IMU_CHANNELS * n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (float32_t)bq[i % 5];
+      for (int ch = 0; ch < IMU_CHANNELS; ch++)
+          arm_biquad_cascade_df2T_init_f32(&s[ch], BIQUAD_STAGES, k, c.zeros<float32_t>(2 * BIQUAD_STAGES));
+      c.run = [=] {
+          for (int ch = 0; ch < IMU_CHANNELS; ch++)
+              arm_biquad_cascade_df2T_f32(&s[ch], x + ch * n, y + ch * n, n);
+      }; }
+    { Case &c = add("Filtering", "arm_biquad_cascade_planar_df2T_f32" + stages + "/6ch", n, 8 * IMU_CHANNELS);
+      arm_biquad_cascade_planar_df2T_instance_f32 *s = c.zeros<arm_biquad_cascade_planar_df2T_instance_f32>(1);
+      float32_t *k = c.zeros<float32_t>(5 * BIQUAD_STAGES), *x = c.f32(IMU_CHANNELS * n),
+                *y = c.zeros<float32_t>(IMU_CHANNELS * n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (float32_t)bq[i % 5];
+      arm_biquad_cascade_planar_df2T_init_f32(s, BIQUAD_STAGES, IMU_CHANNELS, k,
+                                              c.zeros<float32_t>(2 * BIQUAD_STAGES * IMU_CHANNELS));
+      c.run = [=] { arm_biquad_cascade_planar_df2T_f32(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_biquad_cascade_multich_df2T_f32" + stages + "/6ch", n, 8 * IMU_CHANNELS);
+      arm_biquad_cascade_multich_df2T_instance_f32 *s = c.zeros<arm_biquad_cascade_multich_df2T_instance_f32>(1);
+      float32_t *k = c.zeros<float32_t>(5 * BIQUAD_STAGES), *x = c.f32(IMU_CHANNELS * n),
+                *y = c.zeros<float32_t>(IMU_CHANNELS * n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (float32_t)bq[i % 5];
+      arm_biquad_cascade_multich_df2T_init_f32(s, BIQUAD_STAGES, IMU_CHANNELS, k,
+                                               c.zeros<float32_t>(2 * BIQUAD_STAGES * IMU_CHANNELS));
+      c.run = [=] { arm_biquad_cascade_multich_df2T_f32(s, x, y, n); }; }
+    // 定点系数按 postShift = 1 缩小一半
+    { Case &c = add("Filtering", "arm_biquad_cascade_df1_q15" + stages, n, 4);
+      arm_biquad_casd_df1_inst_q15 *s = c.zeros<arm_biquad_casd_df1_inst_q15>(1);
+      q15_t *k = c.zeros<q15_t>(6 * BIQUAD_STAGES), *x = c.q15(n), *y = c.zeros<q15_t>(n);
+      for (int st = 0; st < BIQUAD_STAGES; st++) {
+          const int idx[6] = {0, -1, 1, 2, 3, 4};  // {b0, 0, b1, b2, a1, a2}
+          for (int i = 0; i < 6; i++) k[6 * st + i] = idx[i] < 0 ? 0 : (q15_t)lrint(bq[idx[i]] * 16384);
+      }
+      arm_biquad_cascade_df1_init_q15(s, BIQUAD_STAGES, k, c.zeros<q15_t>(4 * BIQUAD_STAGES), 1);
+      c.run = [=] { arm_biquad_cascade_df1_q15(s, x, y, n); }; }
+    { Case &c = add("Filtering", "arm_biquad_cascade_df1_q31" + stages, n, 8);
+      arm_biquad_casd_df1_inst_q31 *s = c.zeros<arm_biquad_casd_df1_inst_q31>(1);
+      q31_t *k = c.zeros<q31_t>(5 * BIQUAD_STAGES), *x = c.q31(n), *y = c.zeros<q31_t>(n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (q31_t)llrint(bq[i % 5] * 1073741824.0);
+      arm_biquad_cascade_df1_init_q31(s, BIQUAD_STAGES, k, c.zeros<q31_t>(4 * BIQUAD_STAGES), 1);
+      c.run = [=] { arm_biquad_cascade_df1_q31(s, x, y, n); }; }
+    // 6 个通道的 64 位状态 q31：逐通道调用 df1_32x64 与交错的 multich 版本对比
+    { Case &c = add("Filtering", "6x arm_biquad_cas_df1_32x64_q31" + stages, n, 8 * IMU_CHANNELS);
+      arm_biquad_cas_df1_32x64_ins_q31 *s = c.zeros<arm_biquad_cas_df1_32x64_ins_q31>(IMU_CHANNELS);
+      q31_t *k = c.zeros<q31_t>(5 * BIQUAD_STAGES), *x = c.q31(IMU_CHANNELS * n), *y = c.zeros<q31_t>(IMU_CHANNELS * n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (q31_t)llrint(bq[i % 5] * 1073741824.0);
+      for (int ch = 0; ch < IMU_CHANNELS; ch++)
+          arm_biquad_cas_df1_32x64_init_q31(&s[ch], BIQUAD_STAGES, k, c.zeros<q63_t>(4 * BIQUAD_STAGES), 1);
+      c.run = [=] {
+          for (int ch = 0; ch < IMU_CHANNELS; ch++)
+              arm_biquad_cas_df1_32x64_q31(&s[ch], x + ch * n, y + ch * n, n);
+      }; }
+    { Case &c = add("Filtering", "arm_biquad_cascade_multich_df2T_q31" + stages + "/6ch", n, 8 * IMU_CHANNELS);
+      arm_biquad_cascade_multich_df2T_instance_q31 *s = c.zeros<arm_biquad_cascade_multich_df2T_instance_q31>(1);
+      q31_t *k = c.zeros<q31_t>(5 * BIQUAD_STAGES), *x = c.q31(IMU_CHANNELS * n), *y = c.zeros<q31_t>(IMU_CHANNELS * n);
+      for (int i = 0; i < 5 * BIQUAD_STAGES; i++) k[i] = (q31_t)llrint(bq[i % 5] * 1073741824.0);
+      arm_biquad_cascade_multich_df2T_init_q31(s, BIQUAD_STAGES, IMU_CHANNELS, k,
+                                               c.zeros<q63_t>(2 * BIQUAD_STAGES * IMU_CHANNELS), 1);
+      c.run = [=] { arm_biquad_cascade_multich_df2T_q31(s, x, y, n); }; }
+
+    { Case &c = add("Filtering", "arm_conv_f32" + taps, n, 8);
+      float32_t *x = c.f32(n), *h = c.f32(FIR_TAPS), *y = c.zeros<float32_t>(n + FIR_TAPS - 1);
+      c.run = [=] { arm_conv_f32(x, n, h, FIR_TAPS, y); }; }
+    { Case &c = add("Filtering", "arm_correlate_f32" + taps, n, 12);
+      float32_t *x = c.f32(n), *h = c.f32(FIR_TAPS), *y = c.zeros<float32_t>(2 * n);
+      c.run = [=] { arm_correlate_f32(x, n, h, FIR_TAPS, y); }; }
+}
+
+static void addSupport(uint32_t n) {
+    { Case &c = add("Support", "arm_copy_f32", n, 8);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_copy_f32(a, d, n); }; }
+    { Case &c = add("Support", "arm_fill_f32", n, 4);
+      float32_t *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_fill_f32(1.0f, d, n); }; }
+    { Case &c = add("Support", "arm_q15_to_float", n, 6);
+      q15_t *a = c.q15(n); float32_t *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_q15_to_float(a, d, n); }; }
+    { Case &c = add("Support", "arm_float_to_q15", n, 6);
+      float32_t *a = c.f32(n); q15_t *d = c.zeros<q15_t>(n);
+      c.run = [=] { arm_float_to_q15(a, d, n); }; }
+    // 每次调用前从同一组随机数重新排序（含拷贝）
+    { Case &c = add("Support", "arm_sort_f32/quick", n, 8);
+      arm_sort_instance_f32 *s = c.zeros<arm_sort_instance_f32>(1);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      arm_sort_init_f32(s, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+      c.run = [=] { arm_sort_f32(s, a, d, n); }; }
+    { Case &c = add("Support", "arm_merge_sort_f32", n, 8);
+      arm_merge_sort_instance_f32 *s = c.zeros<arm_merge_sort_instance_f32>(1);
+      float32_t *a = c.f32(n), *d = c.zeros<float32_t>(n);
+      arm_merge_sort_init_f32(s, ARM_SORT_ASCENDING, c.zeros<float32_t>(n));
+      c.run = [=] { arm_merge_sort_f32(s, a, d, n); }; }
+    // 6 轴交错帧 → 6 个通道：改动前检测器逐帧换算（计数 * LSB - 基线）与一次处理整块的内核对比，
+    // 元素 = 一帧（12 字节输入 + 24 / 12 字节输出）
+    { Case &c = add("Support", "6ch per-frame q15 scale+bias", n, 36);
+      q15_t *a = c.q15(IMU_CHANNELS * n); float32_t *d = c.zeros<float32_t>(IMU_CHANNELS * n);
+      float32_t *k = c.f32(IMU_CHANNELS), *b = c.f32(IMU_CHANNELS);
+      c.run = [=] {
+          for (uint32_t i = 0; i < n; i++) {
+              float32_t x[IMU_CHANNELS];
+              for (int ch = 0; ch < IMU_CHANNELS; ch++) x[ch] = a[i * IMU_CHANNELS + ch] * k[ch] - b[ch];
+              for (int ch = 0; ch < IMU_CHANNELS; ch++) d[ch * n + i] = x[ch];
+          }
+      }; }
+    { Case &c = add("Support", "arm_deinterleave_q15_to_float/6ch", n, 36);
+      q15_t *a = c.q15(IMU_CHANNELS * n); float32_t *d = c.zeros<float32_t>(IMU_CHANNELS * n);
+      float32_t *k = c.f32(IMU_CHANNELS), *b = c.f32(IMU_CHANNELS);
+      c.run = [=] { arm_deinterleave_q15_to_float(a, IMU_CHANNELS, k, b, d, n, n); }; }
+    { Case &c = add("Support", "arm_deinterleave_q15/6ch", n, 24);
+      q15_t *a = c.q15(IMU_CHANNELS * n), *d = c.zeros<q15_t>(IMU_CHANNELS * n);
+      q15_t *k = c.q15(IMU_CHANNELS), *b = c.q15(IMU_CHANNELS);
+      c.run = [=] { arm_deinterleave_q15(a, IMU_CHANNELS, k, 1, b, d, n, n); }; }
+}
+
+static void addOthers(uint32_t n) {
+    { Case &c = add("Window", "arm_hanning_f32", n, 4);
+      float32_t *d = c.zeros<float32_t>(n);
+      c.run = [=] { arm_hanning_f32(d, n); }; }
+    { Case &c = add("Distance", "arm_euclidean_distance_f32", n, 8);
+      float32_t *a = c.f32(n), *b = c.f32(n), *r = c.zeros<float32_t>(1);
+      c.run = [=] { *r = arm_euclidean_distance_f32(a, b, n); }; }
+    { Case &c = add("Distance", "arm_cosine_distance_f32", n, 8);
+      float32_t *a = c.f32(n), *b = c.f32(n), *r = c.zeros<float32_t>(1);
+      c.run = [=] { *r = arm_cosine_distance_f32(a, b, n); }; }
+    { Case &c = add("Interpolation", "arm_linear_interp_f32", n, 8);
+      const uint32_t tab = 256;
+      arm_linear_interp_instance_f32 *s = c.zeros<arm_linear_interp_instance_f32>(1);
+      float32_t *ytab = c.f32(tab), *x = c.f32(n), *y = c.zeros<float32_t>(n);
+      for (uint32_t i = 0; i < n; i++) x[i] = (x[i] + 1.0f) * 0.5f * (tab - 1);
+      s->nValues = tab;
+      s->x1 = 0;
+      s->xSpacing = 1;
+      s->pYData = ytab;
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) y[i] = arm_linear_interp_f32(s, x[i]); }; }
+    { Case &c = add("Controller", "arm_pid_f32", n, 8);
+      arm_pid_instance_f32 *s = c.zeros<arm_pid_instance_f32>(1);
+      float32_t *x = c.f32(n), *y = c.zeros<float32_t>(n);
+      s->Kp = 0.5f;
+      s->Ki = 0.01f;
+      s->Kd = 0.1f;
+      arm_pid_init_f32(s, 1);
+      c.run = [=] { for (uint32_t i = 0; i < n; i++) y[i] = arm_pid_f32(s, x[i]); }; }
+    // 元素为一个四元数
+    { Case &c = add("Quaternion", "arm_quaternion_product_f32", n, 48);
+      float32_t *a = c.f32(4 * n), *b = c.f32(4 * n), *d = c.zeros<float32_t>(4 * n);
+      c.run = [=] { arm_quaternion_product_f32(a, b, d, n); }; }
+}
+
+/*********** 测量 ***********/
+struct Result {
+    double warmTicks, coldTicks;  // 每次调用
+};
+
+#if !(defined(__x86_64__) || defined(__i386__))
+static std::vector<uint8_t> evictBuf(64 << 20);
+#endif
+
+static void evict(const Case &c) {
+#if defined(__x86_64__) || defined(__i386__)
+    for (const std::vector<uint8_t> &b : c.bufs) {
+        for (size_t i = 0; i < b.size(); i += 64) _mm_clflush(b.data() + i);
+    }
+    _mm_mfence();
+#else
+    for (size_t i = 0; i < evictBuf.size(); i += 64) evictBuf[i]++;
+#endif
+}
+
+static Result measure(Case &c, int coldReps, double tpn) {
+    Result r;
+    c.run();  // 预热（也让交替的 FFT 回到正变换之前的状态无关紧要）
+
+    // 热缓存：每轮至少 200 µs
+    uint64_t iters = 1;
+    const uint64_t minTicks = (uint64_t)(200e3 * tpn);
+    for (;;) {
+        const uint64_t t0 = ticks();
+        for (uint64_t i = 0; i < iters; i++) c.run();
+        if (ticks() - t0 >= minTicks || iters >= (1u << 24)) break;
+        iters *= 2;
+    }
+    double best = 1e300;
+    for (int round = 0; round < 5; round++) {
+        const uint64_t t0 = ticks();
+        for (uint64_t i = 0; i < iters; i++) c.run();
+        best = std::min(best, (double)(ticks() - t0) / iters);
+    }
+    r.warmTicks = best;
+
+    // 冷缓存：单次计时的中位数（扣除空计时的开销）
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < 16; i++) {
+        const uint64_t t0 = ticks();
+        overhead = std::min(overhead, ticks() - t0);
+    }
+    std::vector<double> cold;
+    for (int k = 0; k < coldReps; k++) {
+        evict(c);
+        const uint64_t t0 = ticks();
+        c.run();
+        const uint64_t dt = ticks() - t0;
+        cold.push_back(dt > overhead ? (double)(dt - overhead) : 0.0);
+    }
+    std::sort(cold.begin(), cold.end());
+    r.coldTicks = cold.empty() ? 0 : cold[cold.size() / 2];
+    return r;
+}
+
+int main(int argc, char **argv) {
+    std::vector<uint32_t> sizes = {64, 256, 1024, 4096};
+    const char *filter = nullptr, *jsonPath = nullptr, *label = "";
+    int coldReps = 15;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--sizes") && i + 1 < argc) {
+            sizes.clear();
+            for (char *p = argv[++i]; *p;) {
+                char *end;
+                const unsigned long v = strtoul(p, &end, 10);
+                if (end == p || v < 1 || v > 65536) { usage(); return 2; }
+                sizes.push_back((uint32_t)v);
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filter = argv[++i];
+        else if (!strcmp(argv[i], "--cold") && i + 1 < argc) coldReps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc) jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--label") && i + 1 < argc) label = argv[++i];
+        else { usage(); return 2; }
+    }
+    if (sizes.empty() || coldReps < 1) { usage(); return 2; }
+
+    for (uint32_t n : sizes) {
+        addBasic(n);
+        addComplex(n);
+        addStatistics(n);
+        addFastMath(n);
+        addTransform(n);
+        addFiltering(n);
+        addSupport(n);
+        addOthers(n);
+    }
+    // 按函数族、名称、长度排序，同一内核的各长度相邻
+    std::stable_sort(cases.begin(), cases.end(), [](const Case &a, const Case &b) {
+        if (a.family != b.family) return a.family < b.family;
+        return a.name != b.name ? a.name < b.name : a.n < b.n;
+    });
+
+    const double tpn = ticksPerNs();
+#if defined(__x86_64__) || defined(__i386__)
+    printf("cycles are TSC reference cycles at %.3f GHz\n", tpn);
+#else
+    printf("cycles are nanoseconds (no cycle counter)\n");
+#endif
+    printf("%-11s %-38s %6s %10s %10s %10s %6s %8s\n",
+           "family", "kernel", "n", "warm ns", "warm c/el", "cold c/el", "B/el", "GB/s");
+
+    FILE *json = nullptr;
+    if (jsonPath) {
+        if (!(json = fopen(jsonPath, "w"))) {
+            fprintf(stderr, "bench_kernels: cannot create %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(json, "{\n  \"label\": \"");
+        for (const char *c = label; *c; c++) {
+            if (*c == '"' || *c == '\\') fputc('\\', json);
+            if ((unsigned char)*c >= 0x20) fputc(*c, json);
+        }
+        fprintf(json, "\",\n  \"compiler\": \"%s\",\n  \"ticks_per_ns\": %.4f,\n  \"kernels\": [\n",
+                __VERSION__, tpn);
+    }
+
+    size_t done = 0;
+    for (Case &c : cases) {
+        const std::string full = c.family + "/" + c.name;
+        if (filter && !strstr(full.c_str(), filter)) continue;
+        const Result r = measure(c, coldReps, tpn);
+        const double ns = r.warmTicks / tpn;
+        const double gbs = c.bytesPerElem * c.n / ns;
+        printf("%-11s %-38s %6u %10.1f %10.2f %10.2f %6.1f %8.2f\n",
+               c.family.c_str(), c.name.c_str(), c.n, ns, r.warmTicks / c.n,
+               r.coldTicks / c.n, c.bytesPerElem, gbs);
+        if (json) {
+            fprintf(json, "%s    {\"family\": \"%s\", \"kernel\": \"%s\", \"n\": %u, "
+                    "\"warm_ns\": %.2f, \"warm_cycles_per_elem\": %.4f, \"cold_cycles_per_elem\": %.4f, "
+                    "\"bytes_per_elem\": %.2f, \"warm_gb_per_s\": %.3f}",
+                    done ? ",\n" : "", c.family.c_str(), c.name.c_str(), c.n, ns,
+                    r.warmTicks / c.n, r.coldTicks / c.n, c.bytesPerElem, gbs);
+        }
+        ++done;
+    }
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        if (fclose(json) != 0) {
+            fprintf(stderr, "bench_kernels: cannot write %s\n", jsonPath);
+            return 1;
+        }
+    }
+    if (!done) {
+        fprintf(stderr, "bench_kernels: no kernel matches %s\n", filter);
+        return 2;
+    }
+    return 0;
+}
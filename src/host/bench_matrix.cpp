@@ -0,0 +1,181 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "arm_math.h"
+
+/*************************************
+ *  矩阵内核基准                       *
+ *  特征提取用到的 3x3 … 64x64 方阵：  *
+ *  分块 arm_mat_mult_f32 对比朴素三重 *
+ *  循环，批量矩阵-向量乘对比逐向量调用 *
+ *************************************/
+// 用法: bench_matrix [--sizes 3,4,6,8,12,16,24,32,48,64] [--vecs 32] [--json FILE] [--label TEXT]
+//
+// 每个单元格为热缓存下每次调用的纳秒数：每轮至少 200 µs，取 7 轮中最快的一轮。
+// baseline 列：mat_mult 为同一编译选项下的朴素 i-j-k 三重循环，mat_vec_mult_batch 为对每个向量
+// 调用一次 arm_mat_vec_mult_f32；trans / inverse / cholesky 没有对照，只给出内核耗时。
+// inverse 会改写源矩阵，计时包含每次调用前把源矩阵拷回的 n·n 次拷贝。
+// MFLOP/s 按 2·乘加次数计（inverse / cholesky 按 2n³ / n³/3 的名义运算量）。
+
+static void usage() {
+    fprintf(stderr, "usage: bench_matrix [--sizes 3,4,6,8,12,16,24,32,48,64] [--vecs 32] [--json FILE] [--label TEXT]\n");
+}
+
+/*********** 计时 ***********/
+template <class F>
+static double nsPerCall(F f) {
+    using clock = std::chrono::steady_clock;
+    f();
+    uint64_t iters = 1;
+    for (;;) {
+        const auto t0 = clock::now();
+        for (uint64_t i = 0; i < iters; i++) f();
+        if (clock::now() - t0 >= std::chrono::microseconds(200) || iters >= (1u << 26)) break;
+        iters *= 2;
+    }
+    double best = 1e300;
+    for (int round = 0; round < 7; round++) {
+        const auto t0 = clock::now();
+        for (uint64_t i = 0; i < iters; i++) f();
+        best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - t0).count() / iters);
+    }
+    return best;
+}
+
+struct Row {
+    std::string kernel;
+    uint32_t n;
+    double baseline;  // 无对照时为 NaN
+    double ns;
+    double flops;
+};
+
+static std::vector<Row> rows;
+
+// 朴素参考：逐元素点积，B 按列跨步访问
+static void __attribute__((noinline)) naiveMult(const float32_t *a, const float32_t *b, float32_t *c, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        for (uint32_t j = 0; j < n; j++) {
+            float32_t sum = 0.0f;
+            for (uint32_t k = 0; k < n; k++) sum += a[i * n + k] * b[k * n + j];
+            c[i * n + j] = sum;
+        }
+}
+
+static void run(uint32_t n, uint32_t numVecs, std::mt19937 &rng) {
+    std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+    const size_t nn = (size_t)n * n;
+    std::vector<float32_t> a(nn), b(nn), c(nn), spd(nn), work(nn), x((size_t)n * numVecs), y((size_t)n * numVecs);
+    for (auto &v : a) v = d(rng);
+    for (auto &v : b) v = d(rng);
+    for (auto &v : x) v = d(rng);
+    // 对角占优的对称正定矩阵，求逆与 Cholesky 都不会失败
+    for (uint32_t i = 0; i < n; i++)
+        for (uint32_t j = 0; j < n; j++) {
+            float32_t s = i == j ? (float32_t)n : 0.0f;
+            for (uint32_t k = 0; k < n; k++) s += a[i * n + k] * a[j * n + k];
+            spd[i * n + j] = s;
+        }
+
+    arm_matrix_instance_f32 A, B, C, S, W;
+    arm_mat_init_f32(&A, n, n, a.data());
+    arm_mat_init_f32(&B, n, n, b.data());
+    arm_mat_init_f32(&C, n, n, c.data());
+    arm_mat_init_f32(&S, n, n, spd.data());
+    arm_mat_init_f32(&W, n, n, work.data());
+    const double n3 = (double)n * n * n;
+
+    rows.push_back({"mat_mult_f32", n, nsPerCall([&] { naiveMult(a.data(), b.data(), c.data(), n); }),
+                    nsPerCall([&] { arm_mat_mult_f32(&A, &B, &C); }), 2 * n3});
+    rows.push_back({"mat_vec_mult_batch_f32", n,
+                    nsPerCall([&] {
+                        for (uint32_t v = 0; v < numVecs; v++)
+                            arm_mat_vec_mult_f32(&A, x.data() + v * n, y.data() + v * n);
+                    }),
+                    nsPerCall([&] { arm_mat_vec_mult_batch_f32(&A, x.data(), y.data(), numVecs); }),
+                    2.0 * nn * numVecs});
+    rows.push_back({"mat_trans_f32", n, NAN, nsPerCall([&] { arm_mat_trans_f32(&A, &C); }), 0});
+    rows.push_back({"mat_inverse_f32", n, NAN, nsPerCall([&] {
+                        memcpy(work.data(), spd.data(), nn * sizeof(float32_t));
+                        arm_mat_inverse_f32(&W, &C);
+                    }), 2 * n3});
+    rows.push_back({"mat_cholesky_f32", n, NAN, nsPerCall([&] { arm_mat_cholesky_f32(&S, &C); }), n3 / 3});
+}
+
+int main(int argc, char **argv) {
+    std::vector<uint32_t> sizes = {3, 4, 6, 8, 12, 16, 24, 32, 48, 64};
+    uint32_t numVecs = 32;
+    const char *jsonPath = nullptr, *label = "";
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--sizes") && i + 1 < argc) {
+            sizes.clear();
+            for (char *p = argv[++i]; *p;) {
+                char *end;
+                const unsigned long v = strtoul(p, &end, 10);
+                if (end == p || v < 1 || v > 1024) { usage(); return 2; }
+                sizes.push_back((uint32_t)v);
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+        else if (!strcmp(argv[i], "--vecs") && i + 1 < argc) {
+            const long v = atol(argv[++i]);
+            if (v < 1 || v > 4096) { usage(); return 2; }
+            numVecs = (uint32_t)v;
+        }
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc) jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--label") && i + 1 < argc) label = argv[++i];
+        else { usage(); return 2; }
+    }
+    if (sizes.empty()) { usage(); return 2; }
+
+    std::mt19937 rng(1);
+    for (uint32_t n : sizes) run(n, numVecs, rng);
+    std::stable_sort(rows.begin(), rows.end(),
+                     [](const Row &x, const Row &y) { return x.kernel < y.kernel; });
+
+    printf("ns per call, batch of %u vectors\n", numVecs);
+    printf("%-24s %5s %11s %11s %8s %9s\n", "kernel", "n", "baseline", "cmsis", "speedup", "MFLOP/s");
+    for (const Row &r : rows) {
+        printf("%-24s %5u", r.kernel.c_str(), r.n);
+        if (isnan(r.baseline)) printf(" %11s", "-");
+        else printf(" %11.1f", r.baseline);
+        printf(" %11.1f", r.ns);
+        if (isnan(r.baseline)) printf(" %8s", "-");
+        else printf(" %7.2fx", r.baseline / r.ns);
+        if (r.flops > 0) printf(" %9.0f\n", r.flops / r.ns * 1e3);
+        else printf(" %9s\n", "-");
+    }
+
+    if (jsonPath) {
+        FILE *json = fopen(jsonPath, "w");
+        if (!json) {
+            fprintf(stderr, "bench_matrix: cannot create %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(json, "{\n  \"label\": \"");
+        for (const char *c = label; *c; c++) {
+            if (*c == '"' || *c == '\\') fputc('\\', json);
+            if ((unsigned char)*c >= 0x20) fputc(*c, json);
+        }
+        fprintf(json, "\",\n  \"compiler\": \"%s\",\n  \"vecs\": %u,\n  \"kernels\": [\n", __VERSION__, numVecs);
+        for (size_t i = 0; i < rows.size(); i++) {
+            const Row &r = rows[i];
+            fprintf(json, "%s    {\"kernel\": \"%s\", \"n\": %u", i ? ",\n" : "", r.kernel.c_str(), r.n);
+            if (isnan(r.baseline)) fprintf(json, ", \"baseline_ns\": null");
+            else fprintf(json, ", \"baseline_ns\": %.2f", r.baseline);
+            fprintf(json, ", \"ns\": %.2f}", r.ns);
+        }
+        fprintf(json, "\n  ]\n}\n");
+        if (fclose(json) != 0) {
+            fprintf(stderr, "bench_matrix: cannot write %s\n", jsonPath);
+            return 1;
+        }
+    }
+    return 0;
+}
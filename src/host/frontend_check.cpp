@@ -0,0 +1,194 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <complex>
+#include <random>
+#include <vector>
+#include "BandDecimator.h"
+
+/*************************************
+ *  多速率前端检查                     *
+ *  带通 + FIR 抽取（BandDecimator）的  *
+ *  通带增益、群时延、直流与混叠抑制、 *
+ *  分块无关性；超出预算时退出码为 1   *
+ *************************************/
+// 用法: frontend_check [--factor M] [--latency MS]
+//
+// 输入采样率为 DET_FS，六个通道幅度不同、同一正弦；输出按最小二乘拟合幅度与相位
+// （arm_fir_decimate_f32 的第 j 个输出以第 j·M 个输入为最新采样，在第 j·M + M - 1 个输入到达后
+// 才产生，因此时延比系数的群时延多 M - 1 个输入采样）。预算：
+//   通带 3-7Hz   增益在 [-0.5, +0.1] dB 内；群时延与解析值相差 < 1 ms，且不超过 --latency（默认 250 ms）
+//   直流         >= 60 dB 衰减（重力 / 基线残差），0.05Hz 漂移 >= 45 dB
+//   混叠带       抽取后落入 0.5-8Hz（判定用到的频点）的输入频率 >= 50 dB 衰减
+//   分块         任意块长度（1..BLOCK）的输出与整块输出逐位相同
+
+static void usage() {
+    fprintf(stderr, "usage: frontend_check [--factor M] [--latency MS]\n");
+}
+
+static const float AMP[DET_CHANNELS] = {1.0f, 0.5f, 2.0f, 30.0f, 10.0f, 100.0f};
+
+/*********** 解析频响（双精度，由实际使用的 float 系数计算） ***********/
+static std::complex<double> response(const BandDecimator &bd, double f) {
+    const std::complex<double> z1 = std::polar(1.0, -2.0 * M_PI * f / DET_FS);
+    std::complex<double> h = 1.0;
+    const float *k = bd.biquadCoeffs();
+    for (int s = 0; s < BandDecimator::STAGES; s++, k += 5) {
+        h *= ((double)k[0] + z1 * ((double)k[1] + z1 * (double)k[2])) /
+             (1.0 - z1 * ((double)k[3] + z1 * (double)k[4]));
+    }
+    std::complex<double> fir = 0.0, zi = 1.0;
+    for (int i = 0; i < BandDecimator::TAPS; i++, zi *= z1) fir += (double)bd.firCoeffs()[i] * zi;
+    return h * fir;
+}
+
+// 系数的群时延加上抽取器的 M - 1 个采样
+static double groupDelayMs(const BandDecimator &bd, double f) {
+    const double d = 1e-3;
+    const double gd = -std::arg(response(bd, f + d) / response(bd, f - d)) / (2.0 * M_PI * 2.0 * d);
+    return (gd + (double)(bd.factor() - 1) / DET_FS) * 1e3;
+}
+
+/*********** 流式运行 ***********/
+// x 为交错的 DET_CHANNELS 通道输入；rng 非空时块长度随机取 1..BLOCK。输出同样交错
+static std::vector<float> runFront(BandDecimator &bd, const std::vector<float> &x, std::mt19937 *rng) {
+    static float blk[DET_CHANNELS * BandDecimator::BLOCK];
+    static float dec[DET_CHANNELS][BandDecimator::BLOCK];
+    std::uniform_int_distribution<size_t> len(1, BandDecimator::BLOCK);
+    const size_t n = x.size() / DET_CHANNELS;
+    std::vector<float> y;
+    bd.reset();
+    for (size_t pos = 0; pos < n;) {
+        size_t m = rng ? len(*rng) : BandDecimator::BLOCK;
+        if (m > n - pos) m = n - pos;
+        for (int c = 0; c < DET_CHANNELS; c++)
+            for (size_t i = 0; i < m; i++) blk[c * m + i] = x[(pos + i) * DET_CHANNELS + c];
+        const size_t k = bd.process(blk, m, dec[0], BandDecimator::BLOCK);
+        for (size_t i = 0; i < k; i++)
+            for (int c = 0; c < DET_CHANNELS; c++) y.push_back(dec[c][i]);
+        pos += m;
+    }
+    return y;
+}
+
+static std::vector<float> tone(double f, double seconds) {
+    const size_t n = (size_t)(seconds * DET_FS);
+    std::vector<float> x(n * DET_CHANNELS);
+    for (size_t i = 0; i < n; i++) {
+        const double s = sin(2.0 * M_PI * f * i / DET_FS);
+        for (int c = 0; c < DET_CHANNELS; c++) x[i * DET_CHANNELS + c] = (float)(AMP[c] * s);
+    }
+    return x;
+}
+
+// 跳过前 settle 秒后，按 y ≈ a·sin(2πf't) + b·cos(2πf't) 拟合通道 c（f' 为输出端看到的频率），
+// 返回相对输入幅度的增益与相位
+struct Fit { double gain, phase; };
+
+static Fit fitTone(const std::vector<float> &y, uint32_t m, double f, int c, double settle) {
+    double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0;
+    const size_t outs = y.size() / DET_CHANNELS;
+    for (size_t j = (size_t)(settle * DET_FS / m); j < outs; j++) {
+        const double t = (double)(j * m + m - 1) / DET_FS;  // 输出产生的时刻
+        const double s = sin(2.0 * M_PI * f * t), co = cos(2.0 * M_PI * f * t), v = y[j * DET_CHANNELS + c];
+        ss += s * s; cc += co * co; sc += s * co; ys += v * s; yc += v * co;
+    }
+    const double det = ss * cc - sc * sc;
+    const double a = (ys * cc - yc * sc) / det, b = (yc * ss - ys * sc) / det;
+    return {hypot(a, b) / AMP[c], atan2(b, a)};
+}
+
+static double worstGain(const std::vector<float> &y, uint32_t m, double f, double settle, bool least) {
+    double g = least ? 1e300 : 0;
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        const double v = fitTone(y, m, f, c, settle).gain;
+        g = least ? fmin(g, v) : fmax(g, v);
+    }
+    return g;
+}
+
+static double db(double g) { return 20.0 * log10(g > 1e-30 ? g : 1e-30); }
+
+int main(int argc, char **argv) {
+    uint32_t factor = 4;
+    double latencyBudget = 250.0;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--factor") && i + 1 < argc) {
+            const long v = atol(argv[++i]);
+            if (v < 2 || v > (long)BandDecimator::MAX_FACTOR || (v & (v - 1)) || DET_FS % v) { usage(); return 2; }
+            factor = (uint32_t)v;
+        }
+        else if (!strcmp(argv[i], "--latency") && i + 1 < argc) latencyBudget = atof(argv[++i]);
+        else { usage(); return 2; }
+    }
+
+    static BandDecimator bd((float)DET_FS, factor);
+    const double fo = (double)DET_FS / factor;
+    const double bandHi = 8.0;  // 判定用到的 1..i7+2 频点（7Hz 加两个频点的余量）
+    const double settle = 10.0, seconds = 40.0;
+    int failures = 0;
+    auto check = [&](bool ok) { if (!ok) ++failures; return ok ? "" : "  FAIL"; };
+
+    printf("fs=%uHz factor=%u -> %.1fHz, biquad %d stages, FIR %d taps\n",
+           (unsigned)DET_FS, (unsigned)factor, fo, BandDecimator::STAGES, BandDecimator::TAPS);
+
+    // 通带增益与群时延
+    printf("\npassband        gain dB   group delay ms   analytic ms\n");
+    for (double f = 3.0; f <= 7.0 + 1e-9; f += 1.0) {
+        const double d = 0.05;
+        std::vector<float> y = runFront(bd, tone(f, seconds), nullptr);
+        std::vector<float> lo = runFront(bd, tone(f - d, seconds), nullptr);
+        std::vector<float> hi = runFront(bd, tone(f + d, seconds), nullptr);
+        const double gMin = db(worstGain(y, factor, f, settle, true));
+        const double gMax = db(worstGain(y, factor, f, settle, false));
+        double dphi = fitTone(hi, factor, f + d, 0, settle).phase - fitTone(lo, factor, f - d, 0, settle).phase;
+        dphi = remainder(dphi, 2.0 * M_PI);
+        const double gd = -dphi / (2.0 * M_PI * 2.0 * d) * 1e3, ref = groupDelayMs(bd, f);
+        printf("  %4.1f Hz    %+8.3f %14.2f %13.2f%s\n", f, gMin, gd, ref,
+               check(gMin >= -0.5 && gMax <= 0.1 && fabs(gd - ref) < 1.0 && gd <= latencyBudget));
+    }
+
+    // 直流与低频漂移
+    {
+        std::vector<float> x(DET_FS * (size_t)seconds * DET_CHANNELS);
+        for (size_t i = 0; i < x.size(); i++) x[i] = AMP[i % DET_CHANNELS];
+        std::vector<float> y = runFront(bd, x, nullptr);
+        double worst = 0;
+        for (size_t j = (size_t)(settle * fo) * DET_CHANNELS; j < y.size(); j++)
+            worst = fmax(worst, fabs(y[j]) / AMP[j % DET_CHANNELS]);
+        printf("\nDC              %+8.1f dB%s\n", db(worst), check(db(worst) <= -60.0));
+        y = runFront(bd, tone(0.05, 200.0), nullptr);
+        const double g = db(worstGain(y, factor, 0.05, 60.0, false));
+        printf("0.05 Hz drift   %+8.1f dB%s\n", g, check(g <= -45.0));
+    }
+
+    // 混叠带：折叠到 0.5Hz..bandHi 的输入频率
+    printf("\nalias band (input -> aliased)   gain dB\n");
+    double worstAlias = -1e300, worstF = 0;
+    for (double f = fo / 2 + 0.5; f < DET_FS / 2.0; f += 0.5) {
+        const double fa = fabs(f - fo * floor(f / fo + 0.5));
+        if (fa < 0.5 || fa > bandHi) continue;
+        std::vector<float> y = runFront(bd, tone(f, 20.0), nullptr);
+        const double g = db(worstGain(y, factor, f, 5.0, false));
+        if (g > worstAlias) { worstAlias = g; worstF = f; }
+    }
+    printf("  worst %.1f Hz -> %.1f Hz  %+8.1f%s\n", worstF, fabs(worstF - fo * floor(worstF / fo + 0.5)),
+           worstAlias, check(worstAlias <= -50.0));
+
+    // 分块无关性：宽带噪声，随机块长度对比整块
+    {
+        std::mt19937 rng(7);
+        std::normal_distribution<float> nz(0.0f, 1.0f);
+        std::vector<float> x(DET_FS * 30 * DET_CHANNELS);
+        for (float &v : x) v = nz(rng);
+        const std::vector<float> a = runFront(bd, x, nullptr);
+        const std::vector<float> b = runFront(bd, x, &rng);
+        const bool same = a.size() == b.size() && !memcmp(a.data(), b.data(), a.size() * sizeof(float));
+        printf("\nchunking        %zu outputs, %s%s\n", a.size() / DET_CHANNELS,
+               same ? "bit-identical" : "MISMATCH", check(same));
+    }
+
+    printf("\n%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
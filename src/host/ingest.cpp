@@ -0,0 +1,461 @@
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ColumnFile.h"
+#include "DetectorParams.h"
+
+/*************************************
+ *  文本串口日志批量导入              *
+ *  mmap 读入旧格式的控制台抓包，手写  *
+ *  扫描器逐行解析，输出列式特征表与   *
+ *  稀疏原始采样                      *
+ *************************************/
+// 用法: ingest <out.col> <capture.txt ...> [--threads N]
+//       ingest --info <file.col>          列出各列
+//       ingest --csv <file.col>           以 CSV 输出窗口特征表
+//
+// 识别的行（其它行忽略，例如校准与 Motion detected）：
+//   --- Window N ---  /  ---Win N---      开始新的一行窗口记录
+//   RAW ax ay az gx gy gz                 稀疏原始采样，记录所属窗口行号
+//   AX 3-5 P@FHz 5-7 P@FHz rms R          6 个通道的频谱摘要
+//   Decision T=t(l) D=d(l)                判定
+//   Boot                                  本文件内的重启计数加一
+// 窗口表（win.*）以 win.file（输入文件序号）+ win.boot（该文件内此前的 Boot 行数）区分会话，
+// 缺失的摘要为 NaN，缺失的判定为 255；raw.row 为所属窗口行号，
+// 出现在第一个窗口头之前的数据归入窗口号为 -1 的行。
+//
+// 文件按行边界切块后多线程解析，块内换行查找用 memchr（glibc 向量化实现），
+// 数字用定长小数的专用解析器，遇到非常规写法（指数、nan）时才退回 strtof。
+
+static const char *const TAGS[DET_CHANNELS] = {"AX", "AY", "AZ", "GX", "GY", "GZ"};
+static const char *const FEATS[5] = {"p35", "f35", "p57", "f57", "rms"};
+static const uint8_t MISSING = 255;
+
+static void usage() {
+    fprintf(stderr, "usage: ingest <out.col> <capture.txt ...> [--threads N]\n"
+                    "       ingest --info <file.col>\n"
+                    "       ingest --csv <file.col>\n");
+}
+
+/*********** 列式表 ***********/
+struct Tables {
+    // 窗口表
+    std::vector<uint16_t> file, boot;
+    std::vector<int32_t> window;
+    std::vector<float> feat[DET_CHANNELS][5];
+    std::vector<uint8_t> tremor, dysk;
+    std::vector<float> levelT, levelD;
+    // 原始采样表
+    std::vector<uint32_t> rawRow;
+    std::vector<int16_t> raw[6];
+
+    // 本块开头、第一个窗口头之前的数据（属于上一块的最后一个窗口）
+    bool leading = false;
+    uint16_t boots = 0;  // 本块内的 Boot 行数
+
+    size_t rows() const { return window.size(); }
+
+    void newRow(int32_t win) {
+        file.push_back(0);
+        boot.push_back(boots);
+        window.push_back(win);
+        for (auto &ch : feat) for (auto &f : ch) f.push_back(NAN);
+        tremor.push_back(MISSING);
+        dysk.push_back(MISSING);
+        levelT.push_back(NAN);
+        levelD.push_back(NAN);
+    }
+
+    // 当前行；块开头还没有窗口头时建立占位行
+    size_t row() {
+        if (window.empty()) {
+            leading = true;
+            newRow(-1);
+        }
+        return window.size() - 1;
+    }
+};
+
+/*********** 手写扫描器 ***********/
+struct Cursor {
+    const char *p, *end;
+
+    bool lit(const char *s) {
+        const char *q = p;
+        for (; *s; ++s, ++q) {
+            if (q >= end || *q != *s) return false;
+        }
+        p = q;
+        return true;
+    }
+
+    bool integer(int32_t &v) {
+        const char *q = p;
+        bool neg = q < end && *q == '-';
+        if (neg) ++q;
+        if (q >= end || (unsigned)(*q - '0') > 9) return false;
+        int64_t acc = 0;
+        while (q < end && (unsigned)(*q - '0') <= 9 && acc < INT32_MAX) acc = acc * 10 + (*q++ - '0');
+        v = (int32_t)(neg ? -acc : acc);
+        p = q;
+        return true;
+    }
+
+    // %.Nf 格式的小数；非常规写法退回 strtof
+    bool number(float &v) {
+        static const double POW10[] = {1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+        const char *q = p;
+        bool neg = q < end && *q == '-';
+        if (neg) ++q;
+        int64_t mant = 0;
+        int digits = 0, frac = 0;
+        while (q < end && (unsigned)(*q - '0') <= 9 && digits < 18) { mant = mant * 10 + (*q++ - '0'); ++digits; }
+        if (q < end && *q == '.') {
+            ++q;
+            while (q < end && (unsigned)(*q - '0') <= 9 && digits < 18 && frac < 9) {
+                mant = mant * 10 + (*q++ - '0');
+                ++digits;
+                ++frac;
+            }
+        }
+        if (digits == 0 || (q < end && (unsigned)(*q - '0') <= 9) ||
+            (q < end && (*q == 'e' || *q == 'E'))) {
+            return slowNumber(v);
+        }
+        double d = mant / POW10[frac];
+        v = (float)(neg ? -d : d);
+        p = q;
+        return true;
+    }
+
+    bool slowNumber(float &v) {
+        char buf[48];
+        size_t n = (size_t)(end - p) < sizeof(buf) - 1 ? (size_t)(end - p) : sizeof(buf) - 1;
+        memcpy(buf, p, n);
+        buf[n] = 0;
+        char *e;
+        v = strtof(buf, &e);
+        if (e == buf) return false;
+        p += e - buf;
+        return true;
+    }
+
+    void spaces() {
+        while (p < end && *p == ' ') ++p;
+    }
+};
+
+static int channelIndex(const char *p) {
+    const int axis = p[1] - 'X';
+    if (axis < 0 || axis > 2) return -1;
+    return p[0] == 'A' ? axis : (p[0] == 'G' ? 3 + axis : -1);
+}
+
+// 解析一行；返回 true 表示识别并记录
+static bool parseLine(const char *p, const char *end, Tables &t) {
+    Cursor c = {p, end};
+    if (end - p < 4) return false;
+    switch (p[0]) {
+    case '-': {  // --- Window N ---  /  ---Win N---
+        while (c.p < end && *c.p == '-') ++c.p;
+        c.spaces();
+        if (!c.lit("Win")) return false;
+        c.lit("dow");
+        c.spaces();
+        int32_t w;
+        if (!c.integer(w)) return false;
+        t.newRow(w);
+        return true;
+    }
+    case 'R': {  // RAW ax ay az gx gy gz
+        if (!c.lit("RAW")) return false;
+        int32_t v[6];
+        for (int i = 0; i < 6; i++) {
+            c.spaces();
+            if (!c.integer(v[i]) || v[i] < -32768 || v[i] > 32767) return false;
+        }
+        t.rawRow.push_back((uint32_t)t.row());
+        for (int i = 0; i < 6; i++) t.raw[i].push_back((int16_t)v[i]);
+        return true;
+    }
+    case 'A':
+    case 'G': {  // AX 3-5 P@FHz 5-7 P@FHz rms R
+        const int ch = channelIndex(p);
+        if (ch < 0) return false;
+        c.p += 2;
+        float f[5];
+        if (!(c.lit(" 3-5 ") && c.number(f[0]) && c.lit("@") && c.number(f[1]) &&
+              c.lit("Hz 5-7 ") && c.number(f[2]) && c.lit("@") && c.number(f[3]) &&
+              c.lit("Hz rms ") && c.number(f[4]))) {
+            return false;
+        }
+        const size_t r = t.row();
+        for (int k = 0; k < 5; k++) t.feat[ch][k][r] = f[k];
+        return true;
+    }
+    case 'D': {  // Decision T=t(l) D=d(l)
+        int32_t tr, dk;
+        float lt, ld;
+        if (!(c.lit("Decision T=") && c.integer(tr) && c.lit("(") && c.number(lt) &&
+              c.lit(") D=") && c.integer(dk) && c.lit("(") && c.number(ld))) {
+            return false;
+        }
+        const size_t r = t.row();
+        t.tremor[r] = (uint8_t)(tr != 0);
+        t.dysk[r] = (uint8_t)(dk != 0);
+        t.levelT[r] = lt;
+        t.levelD[r] = ld;
+        return true;
+    }
+    case 'B':
+        if (!c.lit("Boot")) return false;
+        ++t.boots;
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct ChunkResult {
+    Tables t;
+    uint64_t lines = 0, parsed = 0;
+};
+
+static void parseChunk(const char *p, const char *end, ChunkResult &out) {
+    while (p < end) {
+        const char *nl = (const char *)memchr(p, '\n', end - p);
+        const char *le = nl ? nl : end;
+        const char *lt = le;
+        if (lt > p && lt[-1] == '\r') --lt;
+        ++out.lines;
+        out.parsed += parseLine(p, lt, out.t);
+        p = le + 1;
+    }
+}
+
+/*********** 合并 ***********/
+// 把各块的表依次接到 all 后面；join 时块开头的占位行并入同一文件上一块的最后一行
+static void merge(Tables &all, Tables &t, uint16_t file, uint16_t bootBase, bool join) {
+    const size_t before = all.rows();
+    size_t first = 0;
+    if (t.leading && join) {
+        const size_t dst = before - 1;
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            for (int k = 0; k < 5; k++) {
+                if (!isnan(t.feat[c][k][0])) all.feat[c][k][dst] = t.feat[c][k][0];
+            }
+        }
+        if (t.tremor[0] != MISSING) {
+            all.tremor[dst] = t.tremor[0];
+            all.dysk[dst] = t.dysk[0];
+            all.levelT[dst] = t.levelT[0];
+            all.levelD[dst] = t.levelD[0];
+        }
+        first = 1;
+    }
+    const size_t base = before - first;  // 本块第 i 行的全局行号为 base + i（占位行除外）
+    // 整列追加，而不是逐行 push_back
+    auto append = [first](auto &dst, const auto &src) { dst.insert(dst.end(), src.begin() + first, src.end()); };
+    const size_t boot0 = all.boot.size();
+    all.file.resize(all.file.size() + t.rows() - first, file);
+    append(all.boot, t.boot);
+    for (size_t i = boot0; i < all.boot.size(); i++) all.boot[i] = (uint16_t)(all.boot[i] + bootBase);
+    append(all.window, t.window);
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        for (int k = 0; k < 5; k++) append(all.feat[c][k], t.feat[c][k]);
+    }
+    append(all.tremor, t.tremor);
+    append(all.dysk, t.dysk);
+    append(all.levelT, t.levelT);
+    append(all.levelD, t.levelD);
+
+    const size_t raw0 = all.rawRow.size();
+    all.rawRow.insert(all.rawRow.end(), t.rawRow.begin(), t.rawRow.end());
+    for (size_t i = raw0; i < all.rawRow.size(); i++) all.rawRow[i] = (uint32_t)(all.rawRow[i] + base);
+    for (int k = 0; k < 6; k++) all.raw[k].insert(all.raw[k].end(), t.raw[k].begin(), t.raw[k].end());
+}
+
+static bool ingestFile(const char *path, uint16_t file, int threads, Tables &all,
+                       uint64_t &bytes, uint64_t &lines, uint64_t &parsed) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    const size_t size = st.st_size;
+    if (size == 0) {
+        close(fd);
+        return true;
+    }
+    const char *data = (const char *)mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+
+    // 按行边界切块；小文件不拆分
+    const size_t minChunk = 1 << 20;
+    size_t nChunks = size / minChunk + 1;
+    if (nChunks > (size_t)threads) nChunks = threads;
+    std::vector<const char *> cut(nChunks + 1);
+    cut[0] = data;
+    cut[nChunks] = data + size;
+    for (size_t i = 1; i < nChunks; i++) {
+        const char *q = data + size * i / nChunks;
+        if (q < cut[i - 1]) q = cut[i - 1];
+        const char *nl = (const char *)memchr(q, '\n', data + size - q);
+        cut[i] = nl ? nl + 1 : data + size;
+    }
+
+    std::vector<ChunkResult> res(nChunks);
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < nChunks; i++) {
+        pool.emplace_back(parseChunk, cut[i], cut[i + 1], std::ref(res[i]));
+    }
+    parseChunk(cut[0], cut[1], res[0]);
+    for (auto &th : pool) th.join();
+
+    const size_t rows0 = all.rows();
+    uint16_t boots = 0;
+    for (size_t i = 0; i < nChunks; i++) {
+        merge(all, res[i].t, file, boots, all.rows() > rows0);
+        boots = (uint16_t)(boots + res[i].t.boots);
+        lines += res[i].lines;
+        parsed += res[i].parsed;
+        res[i] = ChunkResult();  // 尽早释放
+    }
+    munmap((void *)data, size);
+    bytes += size;
+    return true;
+}
+
+/*********** 输出 ***********/
+static bool writeTables(const char *path, const Tables &t) {
+    ColumnWriter w;
+    w.add("win.file", t.file);
+    w.add("win.boot", t.boot);
+    w.add("win.window", t.window);
+    std::vector<std::string> names;
+    names.reserve(DET_CHANNELS * 5);
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        for (int k = 0; k < 5; k++) {
+            names.push_back(std::string("win.") + TAGS[c] + "." + FEATS[k]);
+            w.add(names.back().c_str(), t.feat[c][k]);
+        }
+    }
+    w.add("win.tremor", t.tremor);
+    w.add("win.levelT", t.levelT);
+    w.add("win.dysk", t.dysk);
+    w.add("win.levelD", t.levelD);
+    w.add("raw.row", t.rawRow);
+    static const char *const RAW[6] = {"raw.ax", "raw.ay", "raw.az", "raw.gx", "raw.gy", "raw.gz"};
+    for (int k = 0; k < 6; k++) w.add(RAW[k], t.raw[k]);
+    return w.write(path);
+}
+
+static int info(const char *path) {
+    ColumnReader r;
+    if (!r.open(path)) {
+        fprintf(stderr, "ingest: %s is not a column file\n", path);
+        return 1;
+    }
+    for (size_t i = 0; i < r.columns(); i++) {
+        const ColumnInfo &c = r.info(i);
+        printf("%-24s %c %10llu rows @%llu\n", c.name, (char)c.type,
+               (unsigned long long)c.count, (unsigned long long)c.offset);
+    }
+    return 0;
+}
+
+static int csv(const char *path) {
+    ColumnReader r;
+    if (!r.open(path)) {
+        fprintf(stderr, "ingest: %s is not a column file\n", path);
+        return 1;
+    }
+    size_t n = 0, m;
+    const uint16_t *file = r.get<uint16_t>("win.file", 'H', &n);
+    const uint16_t *boot = r.get<uint16_t>("win.boot", 'H', &m);
+    const int32_t *window = r.get<int32_t>("win.window", 'i', &m);
+    const uint8_t *tremor = r.get<uint8_t>("win.tremor", 'B', &m);
+    const float *levelT = r.get<float>("win.levelT", 'f', &m);
+    const uint8_t *dysk = r.get<uint8_t>("win.dysk", 'B', &m);
+    const float *levelD = r.get<float>("win.levelD", 'f', &m);
+    const float *feat[DET_CHANNELS][5];
+    bool ok = file && boot && window && tremor && levelT && dysk && levelD;
+    printf("file,boot,window");
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        for (int k = 0; k < 5; k++) {
+            std::string name = std::string("win.") + TAGS[c] + "." + FEATS[k];
+            feat[c][k] = r.get<float>(name.c_str(), 'f', &m);
+            ok = ok && feat[c][k];
+            printf(",%s.%s", TAGS[c], FEATS[k]);
+        }
+    }
+    printf(",tremor,levelT,dysk,levelD\n");
+    if (!ok) {
+        fprintf(stderr, "ingest: %s lacks window columns\n", path);
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        printf("%u,%u,%d", file[i], boot[i], window[i]);
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            for (int k = 0; k < 5; k++) printf(",%g", feat[c][k][i]);
+        }
+        printf(",%d,%g,%d,%g\n", tremor[i], levelT[i], dysk[i], levelD[i]);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && !strcmp(argv[1], "--info")) return info(argv[2]);
+    if (argc == 3 && !strcmp(argv[1], "--csv")) return csv(argv[2]);
+
+    const char *out = nullptr;
+    std::vector<const char *> inputs;
+    int threads = (int)std::thread::hardware_concurrency();
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (argv[i][0] != '-' && !out) out = argv[i];
+        else if (argv[i][0] != '-') inputs.push_back(argv[i]);
+        else { usage(); return 2; }
+    }
+    if (!out || inputs.empty()) { usage(); return 2; }
+    if (threads < 1) threads = 1;
+
+    auto t0 = std::chrono::steady_clock::now();
+    Tables all;
+    uint64_t bytes = 0, lines = 0, parsed = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!ingestFile(inputs[i], (uint16_t)i, threads, all, bytes, lines, parsed)) {
+            fprintf(stderr, "ingest: cannot read %s\n", inputs[i]);
+            return 1;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    if (!writeTables(out, all)) {
+        fprintf(stderr, "ingest: cannot write %s\n", out);
+        return 1;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    const double parseSec = std::chrono::duration<double>(t1 - t0).count();
+    const double writeSec = std::chrono::duration<double>(t2 - t1).count();
+    fprintf(stderr,
+            "ingest: %zu files, %.1f MB, %llu lines (%llu parsed), %zu windows, %zu raw samples\n"
+            "        parse %.2fs (%.0f MB/s, %d threads), write %.2fs\n",
+            inputs.size(), bytes / 1e6, (unsigned long long)lines, (unsigned long long)parsed,
+            all.rows(), all.rawRow.size(), parseSec, parseSec > 0 ? bytes / 1e6 / parseSec : 0.0,
+            threads, writeSec);
+    return 0;
+}
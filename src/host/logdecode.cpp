@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "BinLog.h"
+
+/*************************************
+ *  二进制日志解码                    *
+ *  把固件 BinLog 的字节流还原为与     *
+ *  文本日志相同的输出                 *
+ *************************************/
+// 用法: logdecode <capture.bin | -> [--ts]
+// 抓包可直接来自串口（例如 cat /dev/ttyACM0 > capture.bin）；
+// 遇到损坏或截断的记录时跳过一个字节重新同步，结尾把跳过的字节数打印到 stderr。
+// --ts 在每条记录前加上固件时间戳（秒）。
+
+static void usage() {
+    fprintf(stderr, "usage: logdecode <capture.bin | -> [--ts]\n");
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// 按格式串依次解出参数并格式化；参数字节与格式不符时返回 false
+static bool format(const char *fmt, const uint8_t *arg, size_t len, std::string &out) {
+    size_t pos = 0;
+    char spec[32], buf[64];
+    out.clear();
+    while (*fmt) {
+        if (*fmt != '%') { out += *fmt++; continue; }
+        if (fmt[1] == '%') { out += '%'; fmt += 2; continue; }
+
+        // 复制标志、宽度与精度，丢弃长度修饰符（参数统一按 32 位编码）
+        size_t n = 0;
+        spec[n++] = *fmt++;
+        while (*fmt && strchr("-+ #0123456789.", *fmt) && n < sizeof(spec) - 2) spec[n++] = *fmt++;
+        while (*fmt && strchr("hlLqjzt", *fmt)) ++fmt;
+        const char conv = *fmt;
+        if (!conv) return false;
+        ++fmt;
+        spec[n++] = conv;
+        spec[n] = 0;
+
+        if (conv == 's') {
+            if (pos + 1 > len) return false;
+            size_t sl = arg[pos];
+            if (sl > BINLOG_MAX_STR || pos + 1 + sl > len) return false;
+            std::string s((const char *)arg + pos + 1, sl);
+            pos += 1 + sl;
+            snprintf(buf, sizeof(buf), spec, s.c_str());
+        } else {
+            if (pos + 4 > len) return false;
+            uint32_t u = rd32(arg + pos);
+            pos += 4;
+            if (strchr("fFeEgGaA", conv)) {
+                float f;
+                memcpy(&f, &u, 4);
+                snprintf(buf, sizeof(buf), spec, (double)f);
+            } else if (conv == 'd' || conv == 'i' || conv == 'c') {
+                snprintf(buf, sizeof(buf), spec, (int)(int32_t)u);
+            } else if (strchr("uxXo", conv)) {
+                snprintf(buf, sizeof(buf), spec, (unsigned)u);
+            } else {
+                return false;
+            }
+        }
+        out += buf;
+    }
+    return pos == len;
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    bool ts = false;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--ts")) ts = true;
+        else if ((argv[i][0] != '-' || !strcmp(argv[i], "-")) && !path) path = argv[i];
+        else { usage(); return 2; }
+    }
+    if (!path) { usage(); return 2; }
+
+    FILE *fp = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+    if (!fp) {
+        fprintf(stderr, "logdecode: cannot open %s\n", path);
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), fp)) > 0) data.insert(data.end(), chunk, chunk + got);
+    if (fp != stdin) fclose(fp);
+
+    uint64_t records = 0, skipped = 0;
+    std::string text;
+    size_t i = 0;
+    while (i < data.size()) {
+        const uint8_t *p = &data[i];
+        const size_t left = data.size() - i;
+        if (p[0] != BINLOG_SYNC || left < BINLOG_HEADER || p[1] >= BINLOG_COUNT ||
+            BINLOG_HEADER + p[2] > BINLOG_MAX_RECORD || BINLOG_HEADER + p[2] > left ||
+            !format(BINLOG_FMT[p[1]], p + BINLOG_HEADER, p[2], text)) {
+            ++i;
+            ++skipped;
+            continue;
+        }
+        if (ts) printf("[%10.6f] ", rd32(p + 3) * 1e-6);
+        fputs(text.c_str(), stdout);
+        ++records;
+        i += BINLOG_HEADER + p[2];
+    }
+
+    fprintf(stderr, "logdecode: %llu records, %llu bytes skipped\n",
+            (unsigned long long)records, (unsigned long long)skipped);
+    return 0;
+}
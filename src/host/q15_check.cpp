@@ -0,0 +1,197 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "TremorDetector.h"
+#include "TraceFile.h"
+
+/*************************************
+ *  q15 定点路径与浮点路径的对比      *
+ *  在录制数据上统计判定一致率与       *
+ *  3-7Hz 频谱的信噪比                *
+ *************************************/
+// 用法: q15_check <trace.txt> [--hop H] [--hann] [--min-snr DB]
+// 判定：两个检测器（ENGINE_FFT / ENGINE_Q15）处理同一轨迹，逐窗口比较。
+// SNR：把同一组整数输入（计数减去基线）分别送入 Stft 与 StftQ15，
+// 以浮点幅度为参考统计 1..i7+2 频点的误差，只反映定点 FFT 本身的误差。
+// 通道摘要：逐窗口比较两个检测器每个通道的 ChannelSummary（峰值、峰值频率、均方值），
+// 幅度按信噪比统计，峰值频率统计最大偏差。频谱或摘要的总信噪比低于 --min-snr 时退出码为 1。
+
+#if DETECTOR_HAS_Q15 && DETECTOR_HAS_FFT
+static const int CALIBRATION_WINDOWS = 5;   // 与固件一致
+
+static void usage() {
+    fprintf(stderr, "usage: q15_check <trace> [--hop H] [--hann] [--min-snr DB]\n");
+}
+
+static double db(double sig, double err) {
+    return err > 0 ? 10.0 * log10(sig / err) : 999.0;
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    double minSnr = 40.0;
+    DetectorConfig cfg;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--hop") && i + 1 < argc) cfg.hop = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--hann")) cfg.window = Stft::HANN;
+        else if (!strcmp(argv[i], "--min-snr") && i + 1 < argc) minSnr = atof(argv[++i]);
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else { usage(); return 2; }
+    }
+    if (!path) { usage(); return 2; }
+
+    std::vector<ImuFrame> trace;
+    if (!loadTrace(path, trace) || trace.empty()) {
+        fprintf(stderr, "q15_check: cannot read frames from %s\n", path);
+        return 1;
+    }
+
+    DetectorConfig qcfg = cfg;
+    qcfg.engine = ENGINE_Q15;
+    static TremorDetector fdet(cfg), qdet(qcfg);
+    static Stft fref(cfg.hop, cfg.window);
+    static StftQ15 qref(cfg.hop, cfg.window);
+
+    size_t pos = 0;
+    size_t calN = std::min(trace.size(), (size_t)CALIBRATION_WINDOWS * DET_N);
+    for (; pos < calN; pos++) {
+        fdet.accumulateBaseline(trace[pos]);
+        qdet.accumulateBaseline(trace[pos]);
+    }
+    fdet.finishCalibration();
+    qdet.finishCalibration();
+    const int16_t *base = qdet.baselineCounts();
+
+    const int nb = fdet.bin7() + 2;
+    uint64_t windows = 0, agreeDecision = 0, agreeShow = 0;
+    uint64_t onlyFloat[2] = {0, 0}, onlyQ15[2] = {0, 0};  // [震颤, 运动障碍]
+    double sig[DET_CHANNELS] = {0}, err[DET_CHANNELS] = {0};
+    double worstSnr = 999.0;
+    double sumSig[DET_CHANNELS] = {0}, sumErr[DET_CHANNELS] = {0}, maxDf[DET_CHANNELS] = {0};
+    double fSec = 0, qSec = 0;
+    float fm[DET_MAX_BIN + 1];
+    q15_t qm[DET_MAX_BIN + 1];
+
+    for (; pos < trace.size(); pos++) {
+        const ImuFrame &f = trace[pos];
+
+        // 频谱对比：两种变换使用完全相同的整数输入
+        q15_t q[DET_CHANNELS];
+        float x[DET_CHANNELS];
+        for (int i = 0; i < 3; i++) {
+            q[i]     = (q15_t)__SSAT((int32_t)f.acc[i] - base[i], 16);
+            q[3 + i] = (q15_t)__SSAT((int32_t)f.gyr[i] - base[3 + i], 16);
+            x[i]     = q[i] * ACC_LSB_G;
+            x[3 + i] = q[3 + i] * GYR_LSB_DPS;
+        }
+        fref.push(x);
+        if (qref.push(q)) {
+            for (int c = 0; c < DET_CHANNELS; c++) {
+                fref.magnitude(c, fm);
+                int shift = qref.magnitude(c, qm);
+                float unit = ldexpf(c < 3 ? ACC_LSB_G : GYR_LSB_DPS, StftQ15::MAG_EXP - shift);
+                double s = 0, e = 0;
+                for (int k = 1; k <= nb; k++) {
+                    double d = qm[k] * unit - fm[k];
+                    s += (double)fm[k] * fm[k];
+                    e += d * d;
+                }
+                sig[c] += s;
+                err[c] += e;
+                if (s > 0) worstSnr = std::min(worstSnr, db(s, e));
+            }
+        }
+
+        // 判定对比
+        bool fr = fdet.pushSample(f);
+        bool qr = qdet.pushSample(f);
+        if (fr != qr) {
+            fprintf(stderr, "q15_check: window boundaries diverged at frame %zu\n", pos);
+            return 1;
+        }
+        if (!fr) continue;
+
+        auto t0 = std::chrono::steady_clock::now();
+        const DetectorResult &a = fdet.analyze();
+        auto t1 = std::chrono::steady_clock::now();
+        const DetectorResult &b = qdet.analyze();
+        auto t2 = std::chrono::steady_clock::now();
+        fSec += std::chrono::duration<double>(t1 - t0).count();
+        qSec += std::chrono::duration<double>(t2 - t1).count();
+
+        ++windows;
+        agreeDecision += a.tremor == b.tremor && a.dyskinesia == b.dyskinesia;
+        agreeShow += a.showTremor == b.showTremor && a.showDyskinesia == b.showDyskinesia;
+        onlyFloat[0] += a.tremor && !b.tremor;
+        onlyQ15[0]   += !a.tremor && b.tremor;
+        onlyFloat[1] += a.dyskinesia && !b.dyskinesia;
+        onlyQ15[1]   += !a.dyskinesia && b.dyskinesia;
+
+        // 通道摘要对比
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            const ChannelSummary &u = a.ch[c], &v = b.ch[c];
+            const float ref[3] = {u.p35, u.p57, u.rms}, out[3] = {v.p35, v.p57, v.rms};
+            for (int k = 0; k < 3; k++) {
+                sumSig[c] += (double)ref[k] * ref[k];
+                sumErr[c] += (double)(out[k] - ref[k]) * (out[k] - ref[k]);
+            }
+            maxDf[c] = std::max(maxDf[c], (double)std::max(fabsf(u.f35 - v.f35), fabsf(u.f57 - v.f57)));
+        }
+    }
+
+    if (!windows) {
+        fprintf(stderr, "q15_check: trace too short for one analysis window\n");
+        return 1;
+    }
+
+    double totalSig = 0, totalErr = 0;
+    printf("spectrum SNR (bins 1..%d, float reference):\n", nb);
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        printf("  %s %6.1f dB\n", TremorDetector::CHANNEL_TAGS[c], db(sig[c], err[c]));
+        totalSig += sig[c];
+        totalErr += err[c];
+    }
+    const double snr = db(totalSig, totalErr);
+    printf("  all %6.1f dB  worst window/channel %.1f dB\n", snr, worstSnr);
+    double summarySig = 0, summaryErr = 0;
+    printf("channel summary (p35/p57/rms SNR, max peak frequency offset):\n");
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        printf("  %s %6.1f dB  %.2f Hz\n", TremorDetector::CHANNEL_TAGS[c],
+               db(sumSig[c], sumErr[c]), maxDf[c]);
+        summarySig += sumSig[c];
+        summaryErr += sumErr[c];
+    }
+    const double summarySnr = db(summarySig, summaryErr);
+    printf("  all %6.1f dB\n", summarySnr);
+    printf("windows=%llu hop=%zu window=%s\n"
+           "decision agreement %.2f%%  displayed agreement %.2f%%\n"
+           "tremor: float-only %llu q15-only %llu  dysk: float-only %llu q15-only %llu\n"
+           "analyze: float %.2fus/window  q15 %.2fus/window\n"
+           "RAM: detector %zu B (engine storage: float %zu B, q15 %zu B; DETECTOR_ENGINES=%d)\n",
+           (unsigned long long)windows, cfg.hop, cfg.window == Stft::HANN ? "hann" : "rect",
+           100.0 * agreeDecision / windows, 100.0 * agreeShow / windows,
+           (unsigned long long)onlyFloat[0], (unsigned long long)onlyQ15[0],
+           (unsigned long long)onlyFloat[1], (unsigned long long)onlyQ15[1],
+           fSec * 1e6 / windows, qSec * 1e6 / windows,
+           sizeof(TremorDetector), sizeof(Stft), sizeof(StftQ15), DETECTOR_ENGINES);
+    return snr >= minSnr && summarySnr >= minSnr ? 0 : 1;
+}
+#else
+int main() {
+    if (!(DETECTOR_ENGINES & 4) || !(DETECTOR_ENGINES & 1)) {
+        fprintf(stderr, "q15_check: DETECTOR_ENGINES=%d, needs both the float FFT and q15 engines\n",
+                DETECTOR_ENGINES);
+    } else if (DET_DECIM > 1) {
+        fprintf(stderr, "q15_check: DETECTOR_DECIMATE=%u, q15 path has no decimating front end\n",
+                (unsigned)DET_DECIM);
+    } else {
+        fprintf(stderr, "q15_check: DETECTOR_FFT_LEN=%u is not a power of two, no q15 path\n",
+                (unsigned)DET_FFTN);
+    }
+    return 2;
+}
+#endif
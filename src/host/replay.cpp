@@ -0,0 +1,368 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "TremorDetector.h"
+#include "TraceFile.h"
+#include "Lsm6dsl.h"
+#include "Lsm6dslMock.h"
+#include "Lsm6dslAsync.h"
+#include "FakeAsyncI2C.h"
+#include "MotionSource.h"
+#include "SpscRing.h"
+#include "BinLog.h"
+#include "Telemetry.h"
+
+/*************************************
+ *  主机端轨迹回放                    *
+ *  用与固件相同的检测核心处理录制数据 *
+ *************************************/
+// 用法: replay <trace.txt | --synth SPEC [--seconds S]> [--no-calib] [--quiet] [--repeat K] [--fifo | --async [HOLD]] [--threads] [--hop H] [--hann] [--sdft | --q15] [--binlog FILE] [--telemetry FILE]
+
+static const int CALIBRATION_WINDOWS = 5;   // 与固件一致
+static const int FIFO_BLOCK_FRAMES   = 26;  // 与固件一致
+
+// --binlog: 按固件的方式把每个窗口的日志写入 BinLog，窗口结束后（空闲时）送往文件，
+// 结尾对比记录写入与 vsnprintf 文本格式化的耗时。用 logdecode 还原文本
+static uint32_t binlogClock() {
+    static const auto t0 = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count();
+}
+
+// --telemetry: 把全部采样、每个窗口的 6 通道频谱与判定按固件的遥测格式写入文件，
+// 可用 teldecode 解码并与原轨迹比较
+
+static void usage() {
+    fprintf(stderr, "usage: replay <trace | --synth SPEC [--seconds S]> [--no-calib] [--quiet] [--repeat K] [--fifo | --async [HOLD]] [--threads] [--hop H] [--hann] [--sdft | --q15] [--binlog FILE] [--telemetry FILE]\n");
+}
+
+// 经寄存器级模拟器的 FIFO 路径重新采集轨迹：
+// 传感器每产生一帧就入队，INT1 水位有效时由驱动批量读出
+static bool acquireViaFifo(const std::vector<ImuFrame> &in, std::vector<ImuFrame> &out) {
+    Lsm6dslMock mock;
+    Lsm6dsl<Lsm6dslMock> imu(mock);
+    if (!imu.probe()) return false;
+    imu.w8(CTRL3_C, CTRL3_C_BDU | CTRL3_C_IF_INC);
+    imu.enableFifo(FIFO_BLOCK_FRAMES);
+
+    ImuFrame block[FIFO_BLOCK_FRAMES * 2];
+    uint32_t t0 = mock.transactions(), reads = 0;
+    for (size_t i = 0; i <= in.size(); i++) {
+        if (i < in.size()) mock.pushSample(in[i]);
+        // 最后一次不等水位，取出剩余数据
+        while (mock.int1() || (i == in.size() && mock.fifoWords())) {
+            size_t n = imu.readFifo(block, FIFO_BLOCK_FRAMES * 2);
+            if (n == 0) break;
+            out.insert(out.end(), block, block + n);
+            ++reads;
+        }
+    }
+
+    if (out.size() != in.size() || memcmp(out.data(), in.data(), in.size() * sizeof(ImuFrame))) {
+        fprintf(stderr, "replay: FIFO path returned %zu frames, mismatch with input\n", out.size());
+        return false;
+    }
+    fprintf(stderr, "fifo: %u bursts, %.3f I2C transactions/sample, overruns=%u\n",
+            reads, (double)(mock.transactions() - t0) / in.size(), imu.fifoOverruns());
+    return true;
+}
+
+// 经异步传输替身 + 乒乓缓冲重新采集轨迹：每个节拍发起一次突发读，
+// 分析线程持有一个数据块 holdTicks 个节拍（模拟分析耗时），期间采集继续
+static bool acquireViaAsync(const std::vector<ImuFrame> &in, std::vector<ImuFrame> &out,
+                            int holdTicks) {
+    Lsm6dslMock mock;
+    FakeAsyncI2C bus(mock);
+    Lsm6dsl<FakeAsyncI2C> imu(bus);
+    if (!imu.probe()) return false;
+    imu.w8(CTRL3_C, CTRL3_C_BDU | CTRL3_C_IF_INC);
+
+    Lsm6dslAsyncReader<FakeAsyncI2C, FakeAsyncI2C::Callback, DET_N> reader(bus);
+    reader.begin(imu.address());
+
+    const ImuFrame *held = nullptr;
+    int heldFor = 0;
+    for (size_t i = 0; i < in.size(); i++) {
+        mock.pushSample(in[i]);
+        reader.kick();
+        bus.completePending();  // DMA 在下一个节拍前完成
+
+        if (!held) {
+            held = reader.acquire();
+            heldFor = 0;
+        }
+        if (held && ++heldFor >= holdTicks) {
+            out.insert(out.end(), held, held + DET_N);
+            reader.release();
+            held = nullptr;
+        }
+    }
+    if (held) {
+        out.insert(out.end(), held, held + DET_N);
+        reader.release();
+    }
+
+    fprintf(stderr, "async: %u blocks, %.3f transfers/sample, missed=%u errors=%u overruns=%u\n",
+            reader.blocks(), (double)bus.transfers() / in.size(),
+            reader.missed(), reader.errors(), reader.overruns());
+    if (reader.overruns() == 0 &&
+        (out.size() != in.size() / DET_N * DET_N ||
+         memcmp(out.data(), in.data(), out.size() * sizeof(ImuFrame)))) {
+        fprintf(stderr, "replay: async path returned %zu frames, mismatch with input\n", out.size());
+        return false;
+    }
+    return true;
+}
+
+// --synth: 用合成震颤代替录制轨迹，经模拟器按固件量程（±2 g / 245 dps）量化，
+// 并报告生成速率（应远高于检测核心的处理速率）
+static bool synthesize(const char *spec, double seconds, std::vector<ImuFrame> &out) {
+    TremorParams tp;
+    if (!parseTremorSpec(spec, tp)) {
+        fprintf(stderr, "replay: bad --synth spec %s\n", spec);
+        return false;
+    }
+    TremorMotion src(tp);
+    Lsm6dslMock mock;
+    const size_t total = (size_t)(seconds * DET_FS);
+    out.resize(total);
+    MotionSample block[1024];
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < total;) {
+        size_t n = src.generate(block, std::min(total - i, (size_t)1024), 1.0 / DET_FS);
+        for (size_t k = 0; k < n; k++) out[i + k] = mock.quantize(block[k]);
+        i += n;
+    }
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    fprintf(stderr, "synth: %zu samples (%.0f s @%d Hz) in %.3f s, %.1f M samples/s\n",
+            total, seconds, (int)DET_FS, sec, sec > 0 ? total / sec / 1e6 : 0.0);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr, *synth = nullptr;
+    double synthSec = 60;
+    bool calib = true, quiet = false, fifo = false, threads = false;
+    int repeat = 1, asyncHold = 0;
+    const char *binlogPath = nullptr, *telPath = nullptr;
+    DetectorConfig cfg;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--no-calib")) calib = false;
+        else if (!strcmp(argv[i], "--quiet")) quiet = true;
+        else if (!strcmp(argv[i], "--fifo")) fifo = true;
+        else if (!strcmp(argv[i], "--threads")) threads = true;
+        else if (!strcmp(argv[i], "--async")) {
+            asyncHold = (i + 1 < argc && argv[i + 1][0] != '-' && isdigit((unsigned char)argv[i + 1][0]))
+                      ? atoi(argv[++i]) : (int)DET_N / 2;
+        }
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--hop") && i + 1 < argc) cfg.hop = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--hann")) cfg.window = Stft::HANN;
+        else if (!strcmp(argv[i], "--sdft")) cfg.engine = ENGINE_SDFT;
+        else if (!strcmp(argv[i], "--q15")) cfg.engine = ENGINE_Q15;
+        else if (!strcmp(argv[i], "--binlog") && i + 1 < argc) binlogPath = argv[++i];
+        else if (!strcmp(argv[i], "--telemetry") && i + 1 < argc) telPath = argv[++i];
+        else if (!strcmp(argv[i], "--synth") && i + 1 < argc) synth = argv[++i];
+        else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) synthSec = atof(argv[++i]);
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else { usage(); return 2; }
+    }
+    if (!path == !synth) { usage(); return 2; }
+    const bool built = cfg.engine == ENGINE_Q15 ? DETECTOR_HAS_Q15 : cfg.engine == ENGINE_SDFT ? DETECTOR_HAS_SDFT : DETECTOR_HAS_FFT;
+    if (!built) {
+        fprintf(stderr, "replay: engine not built in (DETECTOR_ENGINES); --q15 also needs a power-of-two DETECTOR_FFT_LEN and no DETECTOR_DECIMATE\n");
+        return 2;
+    }
+
+    std::vector<ImuFrame> trace;
+    if (synth) {
+        if (!synthesize(synth, synthSec, trace)) return 2;
+    } else if (!loadTrace(path, trace) || trace.empty()) {
+        fprintf(stderr, "replay: cannot read frames from %s\n", path);
+        return 1;
+    }
+    if (fifo) {
+        std::vector<ImuFrame> acquired;
+        if (!acquireViaFifo(trace, acquired)) return 1;
+        trace.swap(acquired);
+    } else if (asyncHold > 0) {
+        std::vector<ImuFrame> acquired;
+        if (!acquireViaAsync(trace, acquired, asyncHold)) return 1;
+        trace.swap(acquired);
+    }
+
+    FILE *logFile = nullptr;
+    if (binlogPath && !(logFile = fopen(binlogPath, "wb"))) {
+        fprintf(stderr, "replay: cannot create %s\n", binlogPath);
+        return 1;
+    }
+    static BinLog<4096> binlog(binlogClock);
+    double logSec = 0, textSec = 0;
+    uint64_t logRecords = 0, logBytes = 0;
+
+    FILE *telFile = nullptr;
+    if (telPath && !(telFile = fopen(telPath, "wb"))) {
+        fprintf(stderr, "replay: cannot create %s\n", telPath);
+        return 1;
+    }
+    TelemetryEncoder tel;
+    uint64_t telBytes = 0;
+    auto telOut = [&](size_t n) {
+        if (n) {
+            fwrite(tel.frame(), 1, n, telFile);
+            telBytes += n;
+        }
+    };
+
+    uint64_t windows = 0, tremorWins = 0, dyskWins = 0, samples = 0;
+    double analyzeSec = 0;
+    auto t0 = std::chrono::steady_clock::now();
+
+    // --threads: 与固件相同的采集/分析分离。生产者线程以最快速度经
+    // SpscRing 送帧（缓冲满时让出 CPU 重试），分析线程逐帧校验顺序
+    static SpscRing<ImuFrame, 256> ring;
+    std::thread producer;
+    uint64_t mismatches = 0;
+    if (threads) {
+        producer = std::thread([&] {
+            for (int r = 0; r < repeat; r++) {
+                for (const ImuFrame &f : trace) {
+                    while (!ring.push(f)) std::this_thread::yield();
+                }
+            }
+        });
+    }
+    ImuFrame popped;
+    auto fetch = [&](size_t pos) -> const ImuFrame & {
+        if (!threads) return trace[pos];
+        while (!ring.pop(popped)) std::this_thread::yield();
+        if (memcmp(&popped, &trace[pos], sizeof(ImuFrame)) != 0) ++mismatches;
+        return popped;
+    };
+
+    for (int r = 0; r < repeat; r++) {
+        TremorDetector det(cfg);
+        size_t pos = 0;
+
+        // 基线校准：与固件相同，使用最前面的若干窗口
+        if (calib) {
+            size_t calN = std::min(trace.size(), (size_t)CALIBRATION_WINDOWS * DET_N);
+            for (; pos < calN; pos++) {
+                const ImuFrame &f = fetch(pos);
+                if (telFile && r == 0) telOut(tel.imu(f));
+                det.accumulateBaseline(f);
+            }
+        }
+        det.finishCalibration();
+
+        for (; pos < trace.size(); pos++) {
+            ++samples;
+            const ImuFrame &f = fetch(pos);
+            if (telFile && r == 0) telOut(tel.imu(f));
+            if (!det.pushSample(f)) continue;
+
+            auto a0 = std::chrono::steady_clock::now();
+            const DetectorResult &res = det.analyze();
+            analyzeSec += std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - a0).count();
+
+            ++windows;
+            tremorWins += res.showTremor;
+            dyskWins += res.showDyskinesia;
+            if (!quiet && r == 0) {
+                printf("%llu Decision T=%d(%.2f) D=%d(%.2f)\n",
+                       (unsigned long long)windows, res.tremor, res.levelT,
+                       res.dyskinesia, res.levelD);
+            }
+            if (telFile && r == 0) {
+                float mag[DET_MAX_BIN + 1];
+                for (int c = 0; c < DET_CHANNELS; c++) {
+                    det.spectrum(c, mag);
+                    telOut(tel.spectrum((uint32_t)windows, c, mag, DET_MAX_BIN + 1));
+                }
+                uint8_t flags = (res.tremor ? TEL_TREMOR : 0) |
+                                (res.dyskinesia ? TEL_DYSKINESIA : 0) |
+                                (res.showTremor ? TEL_SHOW_TREMOR : 0) |
+                                (res.showDyskinesia ? TEL_SHOW_DYSKINESIA : 0);
+                telOut(tel.decision((uint32_t)windows, flags, res.levelT, res.levelD));
+            }
+            if (logFile && r == 0) {
+                // 与固件每个窗口的日志相同：窗口头、6 行频谱摘要、判定
+                auto l0 = std::chrono::steady_clock::now();
+                binlog.write<LOG_WINDOW>((uint32_t)windows);
+                for (int c = 0; c < DET_CHANNELS; c++) {
+                    const ChannelSummary &s = res.ch[c];
+                    binlog.write<LOG_FFT_SUMMARY>(TremorDetector::CHANNEL_TAGS[c],
+                                                  s.p35, s.f35, s.p57, s.f57, s.rms);
+                }
+                binlog.write<LOG_DECISION>(res.tremor, res.levelT, res.dyskinesia, res.levelD);
+                auto l1 = std::chrono::steady_clock::now();
+
+                // 对照：同样内容用 snprintf 格式化（不输出）
+                char text[128];
+                snprintf(text, sizeof(text), BINLOG_FMT[LOG_WINDOW], (unsigned long)windows);
+                for (int c = 0; c < DET_CHANNELS; c++) {
+                    const ChannelSummary &s = res.ch[c];
+                    snprintf(text, sizeof(text), BINLOG_FMT[LOG_FFT_SUMMARY],
+                             TremorDetector::CHANNEL_TAGS[c], (double)s.p35, (double)s.f35,
+                             (double)s.p57, (double)s.f57, (double)s.rms);
+                }
+                snprintf(text, sizeof(text), BINLOG_FMT[LOG_DECISION],
+                         res.tremor, (double)res.levelT, res.dyskinesia, (double)res.levelD);
+                auto l2 = std::chrono::steady_clock::now();
+                logSec += std::chrono::duration<double>(l1 - l0).count();
+                textSec += std::chrono::duration<double>(l2 - l1).count();
+                logRecords += 2 + DET_CHANNELS;
+
+                uint8_t chunk[256];
+                size_t n;
+                while ((n = binlog.drain(chunk, sizeof(chunk))) > 0) {
+                    fwrite(chunk, 1, n, logFile);
+                    logBytes += n;
+                }
+            }
+        }
+    }
+
+    if (threads) {
+        producer.join();
+        fprintf(stderr, "threads: ring full %u times, %llu out-of-order frames\n",
+                ring.overruns(), (unsigned long long)mismatches);
+        if (mismatches) return 1;
+    }
+
+    if (telFile) {
+        telOut(tel.flushImu());
+        fclose(telFile);
+        fprintf(stderr, "telemetry: %llu bytes, %.1f bytes/s of signal (link 11520 bytes/s)\n",
+                (unsigned long long)telBytes, telBytes / ((double)trace.size() / DET_FS));
+    }
+    if (logFile) {
+        fclose(logFile);
+        fprintf(stderr, "binlog: %llu records, %.1f bytes/record, dropped=%u, "
+                "%.0f ns/record (snprintf %.0f ns/record)\n",
+                (unsigned long long)logRecords,
+                logRecords ? (double)logBytes / logRecords : 0.0, binlog.dropped(),
+                logRecords ? logSec * 1e9 / logRecords : 0.0,
+                logRecords ? textSec * 1e9 / logRecords : 0.0);
+    }
+
+    double sec = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - t0).count();
+    double signalSec = (double)samples / DET_FS;
+    fprintf(stderr,
+            "frames=%llu windows=%llu tremor=%llu dysk=%llu\n"
+            "%s hop=%zu window=%s elapsed=%.3fs analyze=%.2fus/window realtime=x%.0f\n",
+            (unsigned long long)samples, (unsigned long long)windows,
+            (unsigned long long)tremorWins, (unsigned long long)dyskWins,
+            cfg.engine == ENGINE_SDFT ? "sdft" : cfg.engine == ENGINE_Q15 ? "q15" : "fft",
+            cfg.hop, cfg.engine == ENGINE_SDFT || cfg.window != Stft::HANN ? "rect" : "hann",
+            sec, windows ? analyzeSec * 1e6 / windows : 0.0,
+            sec > 0 ? signalSec / sec : 0.0);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include "Stft.h"
+#include "SlidingDft.h"
+
+/*************************************
+ *  滑动 DFT 漂移 / 稳定性检查         *
+ *  用数小时的合成信号对比 FFT 参考    *
+ *************************************/
+// 用法: sdft_check [HOURS] [--budget REL]
+// 信号直接以分析采样率 DET_FS_A 生成（不经抽取前端）。
+// 每分钟对比一次 1..i7+2 频点的幅度；误差以该窗口频谱最大值归一化。
+// 同时运行不重新同步的实例，用于观察舍入误差的累积速度。
+
+static void usage() {
+    fprintf(stderr, "usage: sdft_check [HOURS] [--budget REL]\n");
+}
+
+int main(int argc, char **argv) {
+    double hours = 6.0;
+    double budget = 1e-4;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--budget") && i + 1 < argc) budget = atof(argv[++i]);
+        else if (argv[i][0] != '-') hours = atof(argv[i]);
+        else { usage(); return 2; }
+    }
+
+    const uint64_t total = (uint64_t)(hours * 3600.0 * DET_FS_A);
+    const uint64_t checkEvery = 60 * DET_FS_A;
+
+    static Stft ref(DET_N_A, Stft::RECT);
+    static SlidingDft sdft(1);
+    static SlidingDft raw(1, 0);  // 从不重新同步
+
+    // 合成信号：重力直流 + 幅度调制的 3-7Hz 分量 + 宽带噪声，各通道参数不同
+    std::mt19937 rng(12345);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    const float dc[DET_CHANNELS]   = {0.02f, -0.05f, 1.0f, 3.0f, -2.0f, 0.5f};
+    const float amp[DET_CHANNELS]  = {0.3f, 0.2f, 0.1f, 40.0f, 25.0f, 10.0f};
+    const float fr[DET_CHANNELS]   = {4.1f, 5.9f, 3.3f, 4.7f, 6.6f, 3.9f};
+    const float nz[DET_CHANNELS]   = {0.01f, 0.01f, 0.01f, 1.0f, 1.0f, 1.0f};
+
+    float mref[DET_FFTN / 2], ms[DET_FFTN / 2], mr[DET_FFTN / 2];
+    double worst = 0, worstRaw = 0, hourWorst = 0, hourWorstRaw = 0;
+    double sdftSec = 0, fftSec = 0;
+    uint64_t checks = 0;
+
+    for (uint64_t n = 0; n < total; n++) {
+        const double t = (double)n / DET_FS_A;
+        float x[DET_CHANNELS];
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            // 调制包络周期约 20 s，模拟间歇出现的震颤
+            float env = 0.5f + 0.5f * (float)sin(2 * M_PI * t / (17.0 + c));
+            x[c] = dc[c] + amp[c] * env * (float)sin(2 * M_PI * fr[c] * t) + nz[c] * noise(rng);
+        }
+
+        auto a0 = std::chrono::steady_clock::now();
+        sdft.push(x);
+        auto a1 = std::chrono::steady_clock::now();
+        sdftSec += std::chrono::duration<double>(a1 - a0).count();
+        raw.push(x);
+        ref.push(x);
+
+        if ((n + 1) % checkEvery != 0) continue;
+        ++checks;
+        for (int c = 0; c < DET_CHANNELS; c++) {
+            auto f0 = std::chrono::steady_clock::now();
+            ref.magnitude(c, mref);
+            fftSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - f0).count();
+            sdft.magnitude(c, ms);
+            raw.magnitude(c, mr);
+
+            float peak = 0;
+            for (int k = DET_SDFT_BIN_LO; k <= DET_SDFT_BIN_HI; k++) peak = fmaxf(peak, mref[k]);
+            for (int k = DET_SDFT_BIN_LO; k <= DET_SDFT_BIN_HI; k++) {
+                double e = fabs(ms[k] - mref[k]) / peak;
+                double er = fabs(mr[k] - mref[k]) / peak;
+                if (e > hourWorst) hourWorst = e;
+                if (er > hourWorstRaw) hourWorstRaw = er;
+            }
+        }
+
+        if ((n + 1) % (3600 * DET_FS_A) == 0 || n + 1 == total) {
+            printf("t=%6.2fh  max rel err: resync %.2e  no-resync %.2e\n",
+                   t / 3600.0, hourWorst, hourWorstRaw);
+            if (hourWorst > worst) worst = hourWorst;
+            if (hourWorstRaw > worstRaw) worstRaw = hourWorstRaw;
+            hourWorst = hourWorstRaw = 0;
+        }
+    }
+
+    double perSample = total ? sdftSec * 1e6 / total : 0;
+    double perFft = checks ? fftSec * 1e6 / checks : 0;
+    printf("samples=%llu bins=%d resync=%u\n"
+           "sdft %.3fus/sample (all channels)  fft %.2fus/window (all channels)\n"
+           "worst rel err: resync %.2e (budget %.1e)  no-resync %.2e\n",
+           (unsigned long long)total, DET_SDFT_BINS, DET_SDFT_RESYNC,
+           perSample, perFft, worst, budget, worstRaw);
+    return worst <= budget ? 0 : 1;
+}
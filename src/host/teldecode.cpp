@@ -0,0 +1,181 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <initializer_list>
+#include "Telemetry.h"
+
+/*************************************
+ *  遥测流解码                        *
+ *  从抓包文件、串口或 pty 读取 COBS   *
+ *  帧，逐帧校验后写出轨迹 / 频谱 /    *
+ *  判定 / 日志                       *
+ *************************************/
+// 用法: teldecode <capture.bin | /dev/ttyACM0 | -> [-o trace.txt] [--spectra FILE]
+//                 [--decisions FILE] [--log FILE]
+// 轨迹为 replay 可直接读取的文本格式（每行 6 个整数），边收边写，可用于实时串口。
+// 频谱 / 判定为 CSV；日志为原始 BinLog 字节流，用 logdecode 还原文本。
+// 读到文件结尾或收到 Ctrl-C 时在 stderr 打印统计（CRC 错误、序号缺口、采样缺口）。
+
+static volatile sig_atomic_t stop = 0;
+
+static void usage() {
+    fprintf(stderr, "usage: teldecode <capture | device | -> [-o trace.txt] [--spectra FILE] "
+                    "[--decisions FILE] [--log FILE]\n");
+}
+
+struct Outputs {
+    FILE *trace, *spectra, *decisions, *log;
+    uint64_t samples, sampleGaps, lostSamples, windows;
+    uint32_t nextIndex;
+    bool seenImu;
+};
+
+static void onFrame(void *ctx, TelType type, uint16_t seq, const uint8_t *p, size_t n) {
+    Outputs &o = *(Outputs *)ctx;
+    uint32_t u32;
+    switch (type) {
+    case TEL_IMU: {
+        if (n < 5) return;
+        memcpy(&u32, p, 4);
+        const size_t count = p[4];
+        if (n != 5 + count * sizeof(ImuFrame)) return;
+        // 采样序号不连续：对应的 TEL_IMU 帧丢失或被丢弃
+        if (o.seenImu && u32 != o.nextIndex) {
+            ++o.sampleGaps;
+            o.lostSamples += u32 - o.nextIndex;
+        }
+        o.seenImu = true;
+        o.nextIndex = u32 + (uint32_t)count;
+        for (size_t i = 0; i < count; i++) {
+            ImuFrame f;
+            memcpy(&f, p + 5 + i * sizeof(ImuFrame), sizeof(f));
+            if (o.trace) {
+                fprintf(o.trace, "%d %d %d %d %d %d\n",
+                        f.acc[0], f.acc[1], f.acc[2], f.gyr[0], f.gyr[1], f.gyr[2]);
+            }
+        }
+        o.samples += count;
+        break;
+    }
+    case TEL_SPECTRUM: {
+        if (n < 6 || n != 6 + p[5] * sizeof(float)) return;
+        memcpy(&u32, p, 4);
+        if (o.spectra) {
+            fprintf(o.spectra, "%u,%u", u32, p[4]);
+            for (int k = 0; k < p[5]; k++) {
+                float m;
+                memcpy(&m, p + 6 + k * sizeof(float), sizeof(m));
+                fprintf(o.spectra, ",%.6g", m);
+            }
+            fputc('\n', o.spectra);
+        }
+        break;
+    }
+    case TEL_DECISION: {
+        if (n != 13) return;
+        float lt, ld;
+        memcpy(&u32, p, 4);
+        memcpy(&lt, p + 5, 4);
+        memcpy(&ld, p + 9, 4);
+        if (o.decisions) {
+            fprintf(o.decisions, "%u,%d,%.3f,%d,%.3f,%d,%d\n", u32,
+                    !!(p[4] & TEL_TREMOR), lt, !!(p[4] & TEL_DYSKINESIA), ld,
+                    !!(p[4] & TEL_SHOW_TREMOR), !!(p[4] & TEL_SHOW_DYSKINESIA));
+        }
+        ++o.windows;
+        break;
+    }
+    case TEL_LOG:
+        if (o.log) fwrite(p, 1, n, o.log);
+        break;
+    default:
+        break;
+    }
+    (void)seq;
+}
+
+static FILE *openOut(const char *path) {
+    if (!path) return nullptr;
+    FILE *fp = fopen(path, "w");
+    if (!fp) fprintf(stderr, "teldecode: cannot create %s\n", path);
+    return fp;
+}
+
+int main(int argc, char **argv) {
+    const char *in = nullptr, *tracePath = nullptr, *specPath = nullptr;
+    const char *decPath = nullptr, *logPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) tracePath = argv[++i];
+        else if (!strcmp(argv[i], "--spectra") && i + 1 < argc) specPath = argv[++i];
+        else if (!strcmp(argv[i], "--decisions") && i + 1 < argc) decPath = argv[++i];
+        else if (!strcmp(argv[i], "--log") && i + 1 < argc) logPath = argv[++i];
+        else if ((argv[i][0] != '-' || !strcmp(argv[i], "-")) && !in) in = argv[i];
+        else { usage(); return 2; }
+    }
+    if (!in) { usage(); return 2; }
+
+    int fd = strcmp(in, "-") ? open(in, O_RDONLY | O_NOCTTY) : 0;
+    if (fd < 0) {
+        fprintf(stderr, "teldecode: cannot open %s: %s\n", in, strerror(errno));
+        return 1;
+    }
+    // 串口 / pty：切换到原始模式，避免终端驱动改写 0x0D / 0x0A 等字节
+    if (isatty(fd)) {
+        struct termios tio;
+        if (tcgetattr(fd, &tio) == 0) {
+            cfmakeraw(&tio);
+            cfsetispeed(&tio, B115200);
+            tcsetattr(fd, TCSANOW, &tio);
+        }
+    }
+
+    Outputs o;
+    memset(&o, 0, sizeof(o));
+    o.trace = tracePath ? openOut(tracePath) : stdout;
+    o.spectra = openOut(specPath);
+    o.decisions = openOut(decPath);
+    o.log = logPath ? fopen(logPath, "wb") : nullptr;
+    if (!o.trace || (specPath && !o.spectra) || (decPath && !o.decisions) || (logPath && !o.log)) {
+        return 1;
+    }
+    if (o.spectra) fputs("window,channel,bins...\n", o.spectra);
+    if (o.decisions) fputs("window,tremor,levelT,dyskinesia,levelD,showTremor,showDyskinesia\n", o.decisions);
+
+    // Ctrl-C 只打断读取，随后照常输出统计
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = [](int) { stop = 1; };
+    sigaction(SIGINT, &sa, nullptr);
+
+    TelemetryDecoder dec(onFrame, &o);
+    uint8_t buf[4096];
+    while (!stop) {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        dec.feed(buf, (size_t)n);
+        // 实时串口：每次读到数据后刷新，下游可以 tail -f
+        if (o.trace) fflush(o.trace);
+    }
+    if (fd != 0) close(fd);
+
+    for (FILE *fp : {o.spectra, o.decisions, o.log}) if (fp) fclose(fp);
+    if (o.trace && o.trace != stdout) fclose(o.trace);
+
+    const TelemetryStats &s = dec.stats();
+    fprintf(stderr,
+            "teldecode: %llu bytes, %llu frames, crc errors %llu, bad frames %llu\n"
+            "           seq gaps %llu (~%llu frames lost)\n"
+            "           samples %llu, sample gaps %llu (%llu samples lost), windows %llu\n",
+            (unsigned long long)s.bytes, (unsigned long long)s.frames,
+            (unsigned long long)s.crcErrors, (unsigned long long)s.badFrames,
+            (unsigned long long)s.seqGaps, (unsigned long long)s.lostFrames,
+            (unsigned long long)o.samples, (unsigned long long)o.sampleGaps,
+            (unsigned long long)o.lostSamples, (unsigned long long)o.windows);
+    return s.crcErrors || s.seqGaps || o.sampleGaps ? 1 : 0;
+}
@@ -1,5 +1,11 @@
 #include "mbed.h"
-#include "arm_math.h"
+#include "TremorDetector.h"
+#include "Lsm6dsl.h"
+#include "Lsm6dslAsync.h"
+#include "SpscRing.h"
+#include "BinLog.h"
+#include "Telemetry.h"
+#include "hal/us_ticker_api.h"
 using namespace std::chrono_literals;
 
 /*************************************
@@ -12,45 +18,43 @@ using namespace std::chrono_literals;
 #define DEBUG_RAW_EVERY    50   // 每50个采样点打印一次原始数据（0表示关闭）
 #define DEBUG_FFT_SUMMARY   1   // 1: 每个通道打印一行FFT分析摘要
 #define DEBUG_THRESH_MSG    1   // 1: 显示每个窗口的决策变量
+#define ACQ_POLL            0   // Ticker 逐样本阻塞读取
+#define ACQ_FIFO            1   // FIFO 水位中断批量读取
+#define ACQ_ASYNC           2   // Ticker 触发异步 (DMA) 突发读 + 乒乓缓冲
+#define ACQ_MODE     ACQ_FIFO   // 采集方式
+#define FIFO_BLOCK_FRAMES  26   // FIFO 水位（帧），26 帧 = 250ms
+#define STFT_HOP           26   // 分析间隔（采样点），26 = 每 250ms 判定一次；DET_N 为不重叠
+#define LOG_BINARY          1   // 1: 二进制日志（用 logdecode 解码）；0: 直接输出文本
+#define TELEMETRY           1   // 1: 串口改为 COBS 分帧遥测（全部采样 + 判定 + 日志），用 teldecode 解码
+#define TELEMETRY_SPECTRA   0   // 1: 遥测中附带每个分析窗口 6 通道 0..DET_MAX_BIN 的频谱
+#define SPECTRUM_ENGINE ENGINE_FFT  // ENGINE_SDFT: 滑动 DFT 逐样本更新 3-7Hz 频点（矩形窗）；ENGINE_Q15: q15 定点 FFT
 
 // 检测阈值设置
-static float ACC_T_TH    = 0.10f;  // 加速度计震颤检测阈值
-static float ACC_D_TH    = 0.10f;  // 加速度计运动障碍检测阈值
-static float GYR_T_TH    = 10.0f;  // 陀螺仪震颤检测阈值
-static float GYR_D_TH    = 10.0f;  // 陀螺仪运动障碍检测阈值
-static float PEAK_TO_RMS = 1.5f;   // 峰值与RMS比值阈值，用于判断信号质量
-
-// 稳定性判断参数
-static const int STABLE_WINDOWS = 1;  // 需要连续检测到症状的窗口数
-static int stable_tremor = 0;         // 震颤稳定计数器
-static int stable_dyskinesia = 0;     // 运动障碍稳定计数器
+static DetectorConfig cfg = {
+    0.10f,  // ACC_T_TH    加速度计震颤检测阈值
+    0.10f,  // ACC_D_TH    加速度计运动障碍检测阈值
+    10.0f,  // GYR_T_TH    陀螺仪震颤检测阈值
+    10.0f,  // GYR_D_TH    陀螺仪运动障碍检测阈值
+    1.5f,   // PEAK_TO_RMS 峰值与RMS比值阈值，用于判断信号质量
+    1,      // STABLE_WINDOWS 需要连续检测到症状的窗口数
+    STFT_HOP,     // 滑动窗口分析间隔
+    Stft::HANN,   // 重叠分析使用 Hann 窗
+    SPECTRUM_ENGINE,
+};
+static TremorDetector detector(cfg);
 
 // 基线校准参数
 static const int CALIBRATION_WINDOWS = 5;   // 校准窗口数
-static float baseline_acc[3] = {0};        // 加速度计基线值
-static float baseline_gyr[3] = {0};        // 陀螺仪基线值
-static bool is_calibrated = false;         // 校准状态标志
 
 /*********** 调试串口设置 ***********/
 UnbufferedSerial pc(USBTX, USBRX, 115200);  // 创建串口对象，波特率115200
 
 /*********** I²C2 接线定义 (PB11 SDA, PB10 SCL) ***********/
 I2C i2c(PB_11, PB_10);  // 创建I2C对象
-int LSM_ADDR;           // LSM6DSL传感器地址
-
-/*********** LSM6DSL 寄存器地址定义 ***********/
-constexpr uint8_t WHO_AM_I = 0x0F;  // 器件ID寄存器
-constexpr uint8_t CTRL1_XL  = 0x10;  // 加速度计控制寄存器
-constexpr uint8_t CTRL2_G   = 0x11;  // 陀螺仪控制寄存器
-constexpr uint8_t CTRL3_C   = 0x12;  // 通用控制寄存器
-constexpr uint8_t OUT_G_L   = 0x22;  // 陀螺仪数据输出寄存器（低字节）
-constexpr uint8_t OUT_XL_L  = 0x28;  // 加速度计数据输出寄存器（低字节）
+Lsm6dsl<I2C> imu(i2c);  // LSM6DSL传感器驱动
 
 /*********** 算法参数设置 ***********/
-constexpr uint32_t Fs    = 104;     // 采样频率（Hz）
-constexpr uint32_t WIN_S = 1;       // 窗口大小（秒）
-constexpr size_t   N     = Fs * WIN_S;  // 每个窗口的采样点数
-constexpr size_t   FFTN  = 256;     // FFT点数
+constexpr size_t N = DET_N;  // 每个窗口的采样点数
 
 /*********** LED输出定义 ***********/
 PwmOut led_tremor(PA_5);      // LD2 (绿色) - 震颤指示LED
@@ -58,37 +62,162 @@ PwmOut led_dyskinesia(PC_9);  // LD4 (蓝色) - 运动障碍指示LED
 DigitalOut led_status(PB_14);  // LD3 (红色) - 系统状态指示LED
 DigitalOut led_power(PA_8);    // LD5 (红色) - 电源/错误指示LED
 
-/*********** 数据缓冲区 ***********/
-static float ax[FFTN], ay[FFTN], az[FFTN];  // 加速度计数据缓冲区
-static float gx[FFTN], gy[FFTN], gz[FFTN];  // 陀螺仪数据缓冲区
-
+/*********** 采集线程 → 分析线程 ***********/
+// 采集线程（高优先级）把帧写入无锁环形缓冲，主线程按窗口取出分析；
+// FFT、串口日志与 LED 更新期间采集不停止，缓冲满时丢帧并计数
+constexpr size_t FRAME_RING_SIZE = 256;         // 约 2.5 s 的缓冲
+static SpscRing<ImuFrame, FRAME_RING_SIZE> frame_ring;
+constexpr uint32_t FLAG_FRAMES = 1;             // 环形缓冲中有新帧
+EventFlags acq_flags;
+Thread acq_thread(osPriorityHigh);
+EventQueue acq_queue;
+
+#if ACQ_MODE == ACQ_FIFO
+/*********** FIFO 水位中断 (INT1 = PD11) ***********/
+InterruptIn imu_int1(PD_11);
+static ImuFrame fifo_block[FIFO_BLOCK_FRAMES * 2];  // 一次突发读出的数据块
+
+// 读出 FIFO 中所有完整的数据组
+void acq_fifo() {
+    // INT1 为电平信号：读取后仍高于水位时不会再有上升沿，因此继续读取
+    do {
+        size_t n = imu.readFifo(fifo_block, FIFO_BLOCK_FRAMES * 2);
+        for (size_t i = 0; i < n; i++) frame_ring.push(fifo_block[i]);
+    } while (imu_int1.read());
+    acq_flags.set(FLAG_FRAMES);
+}
+#else
 /*********** 采样定时器设置 ***********/
-static volatile bool tick_flag = false;  // 采样标志
-Ticker tick;                            // 定时器对象
-void isr() { tick_flag = true; }        // 定时器中断服务函数
-
-/*********** I²C 辅助函数 ***********/
-// 写入一个字节到指定寄存器
-inline void w8(uint8_t reg, uint8_t val) {
-    char b[2] = { (char)reg, (char)val };
-    i2c.write(LSM_ADDR, b, 2);
+Ticker tick;                          // 定时器对象
+static volatile uint32_t missed_ticks = 0;  // 采集线程未及时处理的节拍
+
+#if ACQ_MODE == ACQ_ASYNC
+constexpr size_t ASYNC_BLOCK_FRAMES = 8;    // DMA 乒乓缓冲块大小（帧）
+Lsm6dslAsyncReader<I2C, event_callback_t, ASYNC_BLOCK_FRAMES> async_reader(i2c);
+
+// 发起一次 12 字节突发读；写满的乒乓块转入环形缓冲
+void acq_sample() {
+    async_reader.kick();
+    if (const ImuFrame *blk = async_reader.acquire()) {
+        for (size_t i = 0; i < ASYNC_BLOCK_FRAMES; i++) frame_ring.push(blk[i]);
+        async_reader.release();
+        acq_flags.set(FLAG_FRAMES);
+    }
+}
+#else
+// 逐样本阻塞读取
+void acq_sample() {
+    ImuFrame f;
+    if (imu.readFrame(f)) {
+        frame_ring.push(f);
+        acq_flags.set(FLAG_FRAMES);
+    }
 }
+#endif
 
-// 从指定寄存器读取一个字节
-inline uint8_t r8(uint8_t reg) {
-    uint8_t v;
-    i2c.write(LSM_ADDR, (char *)&reg, 1, true);
-    i2c.read(LSM_ADDR, (char *)&v, 1);
-    return v;
+// 定时器中断服务函数：把一次采样投递给采集线程，队列满时计为丢失
+void isr() {
+    if (!acq_queue.call(acq_sample)) ++missed_ticks;
+}
+#endif
+
+/*********** 遥测 ***********/
+#if TELEMETRY
+#if !LOG_BINARY
+#error "TELEMETRY carries the binary log stream and needs LOG_BINARY=1"
+#endif
+// 分析线程组帧后整帧写入字节环形缓冲（放不下时整帧丢弃，接收端由序号检出），
+// 发送线程在帧边界处插入日志帧
+constexpr size_t TEL_RING_BYTES = 2048;
+static SpscRing<uint8_t, TEL_RING_BYTES> tel_ring;
+static TelemetryEncoder tel;       // 分析线程：IMU / 频谱 / 判定
+static TelemetryEncoder tel_log;   // 发送线程：日志
+
+static void tel_send(size_t n) {
+    if (n) tel_ring.pushAll(tel.frame(), n);
 }
 
-// 从指定寄存器读取多个字节
-inline int rN(uint8_t reg, uint8_t *dst) {
-    i2c.write(LSM_ADDR, (char *)&reg, 1, true);
-    return i2c.read(LSM_ADDR, (char *)dst, 6);
+// 每个分析窗口：可选的 6 通道频谱 + 判定
+static void tel_window(uint32_t window, const DetectorResult &res) {
+#if TELEMETRY_SPECTRA
+    float mag[DET_MAX_BIN + 1];
+    for (int c = 0; c < DET_CHANNELS; c++) {
+        detector.spectrum(c, mag);
+        tel_send(tel.spectrum(window, c, mag, DET_MAX_BIN + 1));
+    }
+#endif
+    uint8_t flags = (res.tremor ? TEL_TREMOR : 0) |
+                    (res.dyskinesia ? TEL_DYSKINESIA : 0) |
+                    (res.showTremor ? TEL_SHOW_TREMOR : 0) |
+                    (res.showDyskinesia ? TEL_SHOW_DYSKINESIA : 0);
+    tel_send(tel.decision(window, flags, res.levelT, res.levelD));
+}
+#endif
+
+/*********** 采样获取 ***********/
+// 等待并返回下一帧 6 轴数据（校准阶段逐帧读取）
+bool nextFrame(ImuFrame &f) {
+    while (!frame_ring.pop(f)) {
+        acq_flags.wait_any(FLAG_FRAMES);
+    }
+#if TELEMETRY
+    tel_send(tel.imu(f));  // 每 TEL_IMU_BATCH 个采样发送一帧
+#endif
+    return true;
+}
+
+// 分析阶段按块读取：等待并一次取出环形缓冲中已有的帧（至多 max 个）。
+// 遥测在帧被检测器消耗时发送，保持与判定帧的先后顺序
+size_t nextFrames(ImuFrame *f, size_t max) {
+    size_t n;
+    while ((n = frame_ring.popMany(f, max)) == 0) {
+        acq_flags.wait_any(FLAG_FRAMES);
+    }
+    return n;
 }
 
+// 检测器整块换算的帧块；窗口结束时未消耗的帧留给下一个窗口
+constexpr size_t FRAME_BLOCK = 32;
+static ImuFrame frame_block[FRAME_BLOCK];
+static size_t block_pos = 0, block_len = 0;
+
 /*********** 日志辅助函数 ***********/
+#if LOG_BINARY
+// 分析线程只把格式 ID 与参数拷入环形缓冲；最低优先级的线程在空闲时送往串口
+constexpr size_t LOG_RING_BYTES = 2048;  // 约 60 个分析窗口的日志
+static uint32_t log_clock() { return us_ticker_read(); }
+static BinLog<LOG_RING_BYTES> binlog(log_clock);
+Thread log_thread(osPriorityLow, 1024);
+
+void log_drain() {
+    uint8_t chunk[64];
+    while (true) {
+        bool idle = true;
+#if TELEMETRY
+        // 遥测帧整帧入队，缓冲读空时必在帧边界，此时才插入日志帧
+        size_t n;
+        while ((n = tel_ring.popMany(chunk, sizeof(chunk))) > 0) {
+            pc.write(chunk, n);
+            idle = false;
+        }
+        if ((n = binlog.drain(chunk, sizeof(chunk))) > 0) {
+            size_t m = tel_log.log(chunk, n);
+            pc.write(tel_log.frame(), m);
+            idle = false;
+        }
+#else
+        size_t n = binlog.drain(chunk, sizeof(chunk));
+        if (n) {
+            pc.write(chunk, n);
+            idle = false;
+        }
+#endif
+        if (idle) ThisThread::sleep_for(5ms);
+    }
+}
+
+#define LOG(id, ...) binlog.write<id>(__VA_ARGS__)
+#else
 void logf(const char *fmt, ...) {
     char buf[128];
     va_list args;
@@ -98,29 +227,30 @@ void logf(const char *fmt, ...) {
     pc.write(buf, n);
 }
 
+#define LOG(id, ...) logf(BINLOG_FMT[id], ##__VA_ARGS__)
+#endif
+
 // 主函数
 int main() {
     // 启动消息
-    pc.write("Boot\r\n", 6);
+#if LOG_BINARY
+    log_thread.start(log_drain);
+#endif
+    LOG(LOG_BOOT);
 
     // I2C初始化
     i2c.frequency(400000);  // 设置I2C频率为400kHz
 
     // 自动检测传感器地址
-    for (int addr : {0x6A, 0x6B}) {
-        LSM_ADDR = addr << 1;
-        if (r8(WHO_AM_I) == 0x6A) {
-            logf("Found LSM6DSL at 0x%02X\r\n", addr);
-            break;
-        }
+    if (imu.probe()) {
+        LOG(LOG_FOUND_IMU, imu.address());
     }
 
     // 传感器配置
-    w8(CTRL1_XL, 0x40);  // 设置加速度计：104Hz采样率，±2g量程
-    w8(CTRL2_G,  0x40);  // 设置陀螺仪：104Hz采样率，245dps量程
-    w8(CTRL3_C,  0x44);  // 设置通用控制：IF_INC=1, BDU=1
-    logf("CTRL1=%02X CTRL2=%02X CTRL3=%02X\r\n",
-         r8(CTRL1_XL), r8(CTRL2_G), r8(CTRL3_C));
+    imu.w8(CTRL1_XL, 0x40);  // 设置加速度计：104Hz采样率，±2g量程
+    imu.w8(CTRL2_G,  0x40);  // 设置陀螺仪：104Hz采样率，245dps量程
+    imu.w8(CTRL3_C,  0x44);  // 设置通用控制：IF_INC=1, BDU=1
+    LOG(LOG_CTRL_REGS, imu.r8(CTRL1_XL), imu.r8(CTRL2_G), imu.r8(CTRL3_C));
 
     // LED初始化
     led_tremor.period_ms(1);
@@ -134,189 +264,102 @@ int main() {
     led_status = 0;
     led_power = 0;
 
-    // FFT初始化
-    arm_rfft_fast_instance_f32 fft;
-    arm_rfft_fast_init_f32(&fft, FFTN);
-    float fbuf[FFTN], mag[FFTN / 2];
-    int i3 = roundf(3.0f * FFTN / Fs);  // 3Hz对应的FFT bin
-    int i5 = roundf(5.0f * FFTN / Fs);  // 5Hz对应的FFT bin
-    int i7 = roundf(7.0f * FFTN / Fs);  // 7Hz对应的FFT bin
-    logf("Freq bins: i3=%d i5=%d i7=%d\r\n", i3, i5, i7);
-
+    // FFT初始化（由检测器完成）
+    LOG(LOG_FREQ_BINS, detector.bin3(), detector.bin5(), detector.bin7());
+
+    // 启动采集线程
+    acq_thread.start(callback(&acq_queue, &EventQueue::dispatch_forever));
+#if ACQ_MODE == ACQ_FIFO
+    // 启动 FIFO：由传感器自身 ODR 定时，水位中断唤醒采集线程
+    imu_int1.rise(acq_queue.event(acq_fifo));
+    imu.enableFifo(FIFO_BLOCK_FRAMES);
+#else
+#if ACQ_MODE == ACQ_ASYNC
+    async_reader.begin(imu.address());
+#endif
     // 启动采样定时器
     tick.attach(&isr, 9600us);  // 设置采样间隔为9600微秒
+#endif
 
     // 添加校准过程
-    logf("Starting calibration...\r\n");
+    LOG(LOG_CALIB_START);
     for (int i = 0; i < CALIBRATION_WINDOWS; i++) {
         size_t idx = 0;
         while (idx < N) {
-            if (!tick_flag) continue;
-            tick_flag = false;
-
-            uint8_t data[6];
-            
-            // 收集加速度计数据
-            if (rN(OUT_XL_L, data) != 0) continue;
-            baseline_acc[0] += (data[0] | (data[1] << 8)) * 0.000061f;
-            baseline_acc[1] += (data[2] | (data[3] << 8)) * 0.000061f;
-            baseline_acc[2] += (data[4] | (data[5] << 8)) * 0.000061f;
-
-            // 收集陀螺仪数据
-            if (rN(OUT_G_L, data) != 0) continue;
-            baseline_gyr[0] += (data[0] | (data[1] << 8)) * 0.00875f;
-            baseline_gyr[1] += (data[2] | (data[3] << 8)) * 0.00875f;
-            baseline_gyr[2] += (data[4] | (data[5] << 8)) * 0.00875f;
-
+            ImuFrame frame;
+            if (!nextFrame(frame)) continue;
+            detector.accumulateBaseline(frame);
             ++idx;
         }
         ThisThread::sleep_for(100ms);
     }
 
     // 计算基线平均值
-    for (int i = 0; i < 3; i++) {
-        baseline_acc[i] /= (CALIBRATION_WINDOWS * N);
-        baseline_gyr[i] /= (CALIBRATION_WINDOWS * N);
-    }
-    is_calibrated = true;
-    logf("Calibration complete. Baselines: ACC[%.3f, %.3f, %.3f] GYR[%.3f, %.3f, %.3f]\r\n",
-         baseline_acc[0], baseline_acc[1], baseline_acc[2],
-         baseline_gyr[0], baseline_gyr[1], baseline_gyr[2]);
+    detector.finishCalibration();
+    const float *bacc = detector.baselineAcc();
+    const float *bgyr = detector.baselineGyr();
+    LOG(LOG_CALIB_DONE, bacc[0], bacc[1], bacc[2], bgyr[0], bgyr[1], bgyr[2]);
 
     uint32_t windowCount = 0;
+    uint32_t sampleCount = 0;  // 连续计数，与窗口 / hop 无关
+    uint32_t lastOverruns = 0;
+#if ACQ_MODE != ACQ_FIFO
+    uint32_t lastMissedTicks = 0;
+#endif
+#if LOG_BINARY
+    uint32_t lastDropped = 0;
+#endif
+#if TELEMETRY
+    uint32_t lastTelDropped = 0;
+#endif
     while (true) {
-        logf("--- Window %lu ---\r\n", ++windowCount);
-
-        // 收集N个采样点
-        size_t idx = 0;
-        while (idx < N) {
-            if (!tick_flag) continue;
-            tick_flag = false;
-
-            uint8_t data[6];
-
-            // 读取加速度计数据
-            if (rN(OUT_XL_L, data) != 0) continue;
-            int16_t axr = data[0] | (data[1] << 8);
-            int16_t ayr = data[2] | (data[3] << 8);
-            int16_t azr = data[4] | (data[5] << 8);
-
-            // 读取陀螺仪数据
-            if (rN(OUT_G_L, data) != 0) continue;
-            int16_t gxr = data[0] | (data[1] << 8);
-            int16_t gyr = data[2] | (data[3] << 8);
-            int16_t gzr = data[4] | (data[5] << 8);
-
-            // 调试输出原始数据
-            if (DEBUG_RAW_EVERY && (idx % DEBUG_RAW_EVERY == 0)) {
-                logf("RAW %d %d %d %d %d %d\r\n",
-                     axr, ayr, azr, gxr, gyr, gzr);
+        LOG(LOG_WINDOW, ++windowCount);
+
+        // 收集一个窗口的采样点
+        bool ready = false;
+        while (!ready) {
+            if (block_pos == block_len) {
+                block_len = nextFrames(frame_block, FRAME_BLOCK);
+                block_pos = 0;
             }
 
-            // 数据缩放和基线校正
-            ax[idx] = axr * 0.000061f - baseline_acc[0];
-            ay[idx] = ayr * 0.000061f - baseline_acc[1];
-            az[idx] = azr * 0.000061f - baseline_acc[2];
-            gx[idx] = gxr * 0.00875f - baseline_gyr[0];
-            gy[idx] = gyr * 0.00875f - baseline_gyr[1];
-            gz[idx] = gzr * 0.00875f - baseline_gyr[2];
-
-            ++idx;
-        }
-
-        // 零填充
-        for (size_t i = N; i < FFTN; i++) {
-            ax[i] = ay[i] = az[i] = gx[i] = gy[i] = gz[i] = 0;
+            // 数据缩放和基线校正（整块，推到窗口结束为止）
+            const size_t n = detector.pushFrames(frame_block + block_pos, block_len - block_pos, ready);
+
+            for (size_t i = 0; i < n; i++, sampleCount++) {
+                const ImuFrame &frame = frame_block[block_pos + i];
+#if TELEMETRY
+                tel_send(tel.imu(frame));  // 每 TEL_IMU_BATCH 个采样发送一帧
+#endif
+                // 调试输出原始数据
+                if (DEBUG_RAW_EVERY && (sampleCount % DEBUG_RAW_EVERY == 0)) {
+                    LOG(LOG_RAW, frame.acc[0], frame.acc[1], frame.acc[2],
+                        frame.gyr[0], frame.gyr[1], frame.gyr[2]);
+                }
+            }
+            block_pos += n;
         }
 
         // 信号分析
-        bool trem = false, dysk = false;
-        float levelT = 0, levelD = 0;
-
-        // 信号分析函数
-        auto analyze = [&](float *d, float tth, float dth,
-                           float scale, const char *tag) {
-            // 执行FFT
-            arm_rfft_fast_f32(&fft, d, fbuf, 0);
-            arm_cmplx_mag_f32(fbuf, mag, FFTN / 2);
-
-            // 计算RMS值
-            float rms = 0;
-            for (int k = 1; k < i7 + 3; k++) {
-                rms += mag[k] * mag[k];
-            }
-            rms = sqrtf(rms / (i7 + 2));
-
-            // 寻找峰值
-            float p35 = 0, p57 = 0;
-            int k35 = i3, k57 = i5;
-            for (int k = i3; k <= i5; k++) {
-                if (mag[k] > p35) { p35 = mag[k]; k35 = k; }
-            }
-            for (int k = i5; k <= i7; k++) {
-                if (mag[k] > p57) { p57 = mag[k]; k57 = k; }
-            }
-
-            float f35 = k35 * (float)Fs / FFTN;
-            float f57 = k57 * (float)Fs / FFTN;
-
-            // 调试输出FFT分析结果
-            if (DEBUG_FFT_SUMMARY) {
-                logf("%s 3-5 %.3f@%.1fHz 5-7 %.3f@%.1fHz rms %.3f\r\n",
-                     tag, (double)p35, (double)f35,
-                     (double)p57, (double)f57,
-                     (double)rms);
-            }
-
-            // 阈值判断逻辑
-            if (p35 >= tth && p35 / rms > PEAK_TO_RMS && rms > tth * 0.3f) {
-                trem = true;
-                levelT = fmaxf(levelT, p35 / scale);
+        const DetectorResult &res = detector.analyze();
+#if TELEMETRY
+        tel_window(windowCount, res);
+#endif
+
+        // 调试输出FFT分析结果
+        if (DEBUG_FFT_SUMMARY) {
+            for (int c = 0; c < DET_CHANNELS; c++) {
+                const ChannelSummary &s = res.ch[c];
+                LOG(LOG_FFT_SUMMARY, TremorDetector::CHANNEL_TAGS[c],
+                    (double)s.p35, (double)s.f35,
+                    (double)s.p57, (double)s.f57,
+                    (double)s.rms);
             }
-            if (p57 >= dth && p57 / rms > PEAK_TO_RMS && rms > dth * 0.3f) {
-                dysk = true;
-                levelD = fmaxf(levelD, p57 / scale);
-            }
-        };
-
-        // 分析所有通道
-        analyze(ax, ACC_T_TH, ACC_D_TH, 0.5f, "AX");
-        analyze(ay, ACC_T_TH, ACC_D_TH, 0.5f, "AY");
-        analyze(az, ACC_T_TH, ACC_D_TH, 0.5f, "AZ");
-        analyze(gx, GYR_T_TH, GYR_D_TH, 100.f, "GX");
-        analyze(gy, GYR_T_TH, GYR_D_TH, 100.f, "GY");
-        analyze(gz, GYR_T_TH, GYR_D_TH, 100.f, "GZ");
-
-        // 限制信号强度在0-1之间
-        levelT = fminf(levelT, 1.0f);
-        levelD = fminf(levelD, 1.0f);
+        }
 
         // 调试输出决策变量
         if (DEBUG_THRESH_MSG) {
-            logf("Decision T=%d(%.2f) D=%d(%.2f)\r\n",
-                 trem, levelT, dysk, levelD);
-        }
-
-        // LED反馈控制
-        bool show_tremor = false;
-        bool show_dyskinesia = false;
-
-        // 判断是否显示症状
-        if (dysk && (!trem || levelD >= levelT)) {
-            stable_dyskinesia++;
-            stable_tremor = 0;
-            if (stable_dyskinesia >= STABLE_WINDOWS) {
-                show_dyskinesia = true;
-            }
-        } else if (trem) {
-            stable_tremor++;
-            stable_dyskinesia = 0;
-            if (stable_tremor >= STABLE_WINDOWS) {
-                show_tremor = true;
-            }
-        } else {
-            stable_tremor = 0;
-            stable_dyskinesia = 0;
+            LOG(LOG_DECISION, res.tremor, res.levelT, res.dyskinesia, res.levelD);
         }
 
         // 重置所有LED状态
@@ -326,18 +369,18 @@ int main() {
         led_power = 0;
 
         // 根据检测结果控制LED
-        if (show_dyskinesia) {
+        if (res.showDyskinesia) {
             // 运动障碍指示
-            led_dyskinesia.period_ms(200);  // 5Hz闪烁
-            led_dyskinesia.write(levelD);   // 亮度与强度成正比
-        } else if (show_tremor) {
+            led_dyskinesia.period_ms(200);    // 5Hz闪烁
+            led_dyskinesia.write(res.levelD); // 亮度与强度成正比
+        } else if (res.showTremor) {
             // 震颤指示
-            led_tremor.period_ms(500);      // 2Hz闪烁
-            led_tremor.write(levelT);       // 亮度与强度成正比
+            led_tremor.period_ms(500);        // 2Hz闪烁
+            led_tremor.write(res.levelT);     // 亮度与强度成正比
         }
 
         // 更新状态LED
-        if (show_tremor || show_dyskinesia) {
+        if (res.showTremor || res.showDyskinesia) {
             led_status = 1;  // 检测到运动时亮起
         }
 
@@ -346,8 +389,32 @@ int main() {
 
         // 输出调试信息
         if (DEBUG_THRESH_MSG) {
-            logf("Motion detected - Tremor: %d(%.2f) Dyskinesia: %d(%.2f)\r\n",
-                 trem, levelT, dysk, levelD);
+            LOG(LOG_MOTION, res.tremor, res.levelT, res.dyskinesia, res.levelD);
+        }
+
+        // 采集丢帧统计（有变化时输出）
+        if (frame_ring.overruns() != lastOverruns) {
+            lastOverruns = frame_ring.overruns();
+            LOG(LOG_OVERRUN, (unsigned long)lastOverruns);
+        }
+#if ACQ_MODE != ACQ_FIFO
+        // 定时器节拍丢失统计（采集队列满，有变化时输出）
+        if (missed_ticks != lastMissedTicks) {
+            lastMissedTicks = missed_ticks;
+            LOG(LOG_MISSED_TICKS, (unsigned long)lastMissedTicks);
+        }
+#endif
+#if LOG_BINARY
+        // 日志丢弃统计（有变化时输出，本条也可能被丢弃，下次再报）
+        if (binlog.dropped() != lastDropped && LOG(LOG_DROPPED, (unsigned long)binlog.dropped())) {
+            lastDropped = binlog.dropped();
+        }
+#endif
+#if TELEMETRY
+        if (tel_ring.overruns() != lastTelDropped &&
+            LOG(LOG_TEL_DROPPED, (unsigned long)tel_ring.overruns())) {
+            lastTelDropped = tel_ring.overruns();
         }
+#endif
     }
 }
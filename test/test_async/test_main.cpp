@@ -0,0 +1,207 @@
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <unity.h>
+#include "FakeAsyncI2C.h"
+#include "Lsm6dsl.h"
+#include "Lsm6dslAsync.h"
+#include "Lsm6dslMock.h"
+
+/*************************************
+ *  异步采集乒乓缓冲交接单元测试       *
+ *  Lsm6dslAsyncReader 经 FakeAsyncI2C *
+ *  与寄存器级模拟器运行               *
+ *************************************/
+// pio test -e native -f test_async
+
+static const size_t BLOCK = 8;
+typedef Lsm6dslAsyncReader<FakeAsyncI2C, FakeAsyncI2C::Callback, BLOCK> Reader;
+
+static Lsm6dslMock *mock;
+static FakeAsyncI2C *bus;
+static Reader *reader;
+
+// 序号分成两个 15 位字段，长时间运行也不回绕；其余各轴由序号派生，字序或轴序出错都会被发现
+static ImuFrame frame(int i) {
+    ImuFrame f;
+    f.acc[0] = (int16_t)(i & 0x7FFF);
+    f.acc[1] = (int16_t)(i >> 15);
+    f.acc[2] = (int16_t)(i * 3);
+    for (int k = 0; k < 3; k++) f.gyr[k] = (int16_t)~f.acc[k];
+    return f;
+}
+
+static int frameIndex(const ImuFrame &f) { return f.acc[0] | (f.acc[1] << 15); }
+
+static void expectBlock(const ImuFrame *block, int first) {
+    for (size_t i = 0; i < BLOCK; i++) {
+        ImuFrame want = frame(first + (int)i);
+        TEST_ASSERT_EQUAL_MEMORY(&want, &block[i], sizeof(ImuFrame));
+    }
+}
+
+// 一个采样节拍：传感器出新样本，发起突发读，DMA 在下一个节拍前完成
+static void tick(int i) {
+    mock->pushSample(frame(i));
+    reader->kick();
+    bus->completePending();
+}
+
+void setUp(void) {
+    mock = new Lsm6dslMock();
+    bus = new FakeAsyncI2C(*mock);
+    Lsm6dsl<FakeAsyncI2C> imu(*bus);
+    TEST_ASSERT_TRUE(imu.probe());
+    imu.w8(CTRL3_C, CTRL3_C_BDU | CTRL3_C_IF_INC);
+    reader = new Reader(*bus);
+    reader->begin(imu.address());
+}
+
+void tearDown(void) {
+    delete reader;
+    delete bus;
+    delete mock;
+}
+
+/*********** 交接 ***********/
+void test_nothing_ready_before_first_block(void) {
+    for (size_t i = 0; i + 1 < BLOCK; i++) tick((int)i);
+    TEST_ASSERT_NULL(reader->acquire());
+    tick(BLOCK - 1);
+    const ImuFrame *b = reader->acquire();
+    TEST_ASSERT_NOT_NULL(b);
+    expectBlock(b, 0);
+    TEST_ASSERT_NULL(reader->acquire());  // 同一块不会交出两次
+    reader->release();
+    TEST_ASSERT_EQUAL(1, reader->blocks());
+}
+
+// 分析持有一个块期间采集继续写另一个块，块之间不丢样本
+void test_capture_overlaps_analysis_without_gaps(void) {
+    const int blocks = 6, hold = (int)BLOCK - 1;
+    std::vector<ImuFrame> out;
+    const ImuFrame *held = nullptr;
+    int heldFor = 0;
+    for (int i = 0; i < blocks * (int)BLOCK; i++) {
+        tick(i);
+        if (!held && (held = reader->acquire()) != nullptr) heldFor = 0;
+        if (held && ++heldFor >= hold) {
+            out.insert(out.end(), held, held + BLOCK);
+            reader->release();
+            held = nullptr;
+        }
+    }
+    if (held) {
+        out.insert(out.end(), held, held + BLOCK);
+        reader->release();
+    }
+    TEST_ASSERT_EQUAL(blocks * BLOCK, out.size());
+    for (int b = 0; b < blocks; b++) expectBlock(&out[b * BLOCK], b * (int)BLOCK);
+    TEST_ASSERT_EQUAL(0, reader->overruns());
+    TEST_ASSERT_EQUAL(0, reader->missed());
+    TEST_ASSERT_EQUAL(blocks * BLOCK, bus->transfers());  // 每个样本一次传输
+}
+
+// 分析超过一个块的时长仍不归还：另一块写满时无处切换，整块丢弃并计入溢出，
+// 已交出的块不被改写；归还后从下一个写满的块继续
+void test_slow_consumer_overruns_without_corrupting_held_block(void) {
+    for (size_t i = 0; i < BLOCK; i++) tick((int)i);
+    const ImuFrame *held = reader->acquire();
+    TEST_ASSERT_NOT_NULL(held);
+
+    for (size_t i = BLOCK; i < 4 * BLOCK; i++) tick((int)i);
+    TEST_ASSERT_EQUAL(3, reader->overruns());
+    TEST_ASSERT_NULL(reader->acquire());
+    expectBlock(held, 0);
+    reader->release();
+
+    for (size_t i = 4 * BLOCK; i < 5 * BLOCK; i++) tick((int)i);
+    const ImuFrame *next = reader->acquire();
+    TEST_ASSERT_NOT_NULL(next);
+    expectBlock(next, 4 * BLOCK);
+    reader->release();
+    TEST_ASSERT_EQUAL(2, reader->blocks());
+}
+
+/*********** 传输异常 ***********/
+void test_kick_while_busy_counts_missed_tick(void) {
+    mock->pushSample(frame(0));
+    reader->kick();
+    reader->kick();  // 上一次传输尚未完成
+    TEST_ASSERT_EQUAL(1, reader->missed());
+    TEST_ASSERT_EQUAL(1, bus->transfers());
+    bus->completePending();
+    for (size_t i = 1; i < BLOCK; i++) tick((int)i);
+    const ImuFrame *b = reader->acquire();
+    TEST_ASSERT_NOT_NULL(b);
+    expectBlock(b, 0);
+}
+
+// NACK：计入错误，该节拍不写入数据块，后续样本接着写
+void test_nack_is_counted_and_skipped(void) {
+    tick(0);
+    bus->failNext();
+    mock->pushSample(frame(1));
+    reader->kick();
+    bus->completePending();
+    TEST_ASSERT_EQUAL(1, reader->errors());
+
+    for (size_t i = 1; i < BLOCK; i++) tick((int)i + 1);
+    const ImuFrame *b = reader->acquire();
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL(0, frameIndex(b[0]));
+    for (size_t i = 1; i < BLOCK; i++) TEST_ASSERT_EQUAL(i + 1, frameIndex(b[i]));
+}
+
+/*********** 跨线程 ***********/
+// 采集（节拍 + 完成回调）与分析分别在两个线程：交出的每个块内容连续、块序递增，
+// 交出的块数加丢弃的块数等于写满的块数
+void test_handoff_across_threads(void) {
+    const int ticks = 200000;
+    std::atomic<bool> finished(false);
+    std::thread producer([&finished] {
+        for (int i = 0; i < ticks; i++) {
+            tick(i);
+            if ((i & 63) == 0) std::this_thread::yield();
+        }
+        finished = true;
+    });
+
+    uint32_t delivered = 0, bad = 0;
+    int lastFirst = -1;
+    bool done = false;
+    while (!done) {
+        done = finished;
+        const ImuFrame *b = reader->acquire();
+        if (!b) continue;
+        const int first = frameIndex(b[0]);
+        bad += first <= lastFirst || first % (int)BLOCK != 0;
+        for (size_t i = 1; i < BLOCK; i++) bad += frameIndex(b[i]) != first + (int)i;
+        lastFirst = first;
+        ++delivered;
+        reader->release();
+    }
+    producer.join();
+    while (const ImuFrame *b = reader->acquire()) {
+        bad += frameIndex(b[0]) <= lastFirst;
+        lastFirst = frameIndex(b[0]);
+        ++delivered;
+        reader->release();
+    }
+
+    TEST_ASSERT_EQUAL(0, bad);
+    TEST_ASSERT_EQUAL(0, reader->missed());
+    TEST_ASSERT_EQUAL(ticks / BLOCK, delivered + reader->overruns());
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_nothing_ready_before_first_block);
+    RUN_TEST(test_capture_overlaps_analysis_without_gaps);
+    RUN_TEST(test_slow_consumer_overruns_without_corrupting_held_block);
+    RUN_TEST(test_kick_while_busy_counts_missed_tick);
+    RUN_TEST(test_nack_is_counted_and_skipped);
+    RUN_TEST(test_handoff_across_threads);
+    return UNITY_END();
+}
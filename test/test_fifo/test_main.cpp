@@ -0,0 +1,157 @@
+#include <string.h>
+#include <unity.h>
+#include "Lsm6dsl.h"
+#include "Lsm6dslMock.h"
+
+/*************************************
+ *  LSM6DSL FIFO 批量读取单元测试     *
+ *  驱动 Lsm6dsl::readFifo 经寄存器级  *
+ *  模拟器 Lsm6dslMock 运行            *
+ *************************************/
+// pio test -e native -f test_fifo
+
+static const uint16_t WATERMARK = 26;  // 与固件 FIFO_BLOCK_FRAMES 一致
+
+static Lsm6dslMock *mock;
+static Lsm6dsl<Lsm6dslMock> *imu;
+
+// 每帧 6 个字各不相同，字序或轴序出错都会被发现
+static ImuFrame frame(int i) {
+    ImuFrame f;
+    for (int k = 0; k < 3; k++) {
+        f.acc[k] = (int16_t)(i * 8 + k);
+        f.gyr[k] = (int16_t)(-i * 8 - k - 1);
+    }
+    return f;
+}
+
+static void push(int from, int to) {
+    for (int i = from; i < to; i++) mock->pushSample(frame(i));
+}
+
+static void expectFrames(const ImuFrame *got, size_t n, int first) {
+    for (size_t i = 0; i < n; i++) {
+        ImuFrame want = frame(first + (int)i);
+        TEST_ASSERT_EQUAL_MEMORY(&want, &got[i], sizeof(ImuFrame));
+    }
+}
+
+void setUp(void) {
+    mock = new Lsm6dslMock();
+    imu = new Lsm6dsl<Lsm6dslMock>(*mock);
+    TEST_ASSERT_TRUE(imu->probe());
+    imu->w8(CTRL3_C, CTRL3_C_BDU | CTRL3_C_IF_INC);
+    imu->enableFifo(WATERMARK);
+}
+
+void tearDown(void) {
+    delete imu;
+    delete mock;
+}
+
+/*********** 配置 ***********/
+void test_enable_programs_watermark_and_mode(void) {
+    const uint16_t fth = WATERMARK * FIFO_FRAME_WORDS;
+    TEST_ASSERT_EQUAL(fth & 0xFF, mock->reg(FIFO_CTRL1));
+    TEST_ASSERT_EQUAL((fth >> 8) & 0x07, mock->reg(FIFO_CTRL2));
+    TEST_ASSERT_EQUAL(FIFO_DEC_NONE_G_XL, mock->reg(FIFO_CTRL3));
+    TEST_ASSERT_EQUAL(FIFO_ODR_104HZ | FIFO_MODE_CONTINUOUS, mock->reg(FIFO_CTRL5));
+    TEST_ASSERT_EQUAL(INT1_FTH, mock->reg(INT1_CTRL));
+}
+
+void test_int1_follows_watermark(void) {
+    push(0, WATERMARK - 1);
+    TEST_ASSERT_FALSE(mock->int1());
+    push(WATERMARK - 1, WATERMARK);
+    TEST_ASSERT_TRUE(mock->int1());
+
+    ImuFrame out[2 * WATERMARK];
+    TEST_ASSERT_EQUAL(WATERMARK, imu->readFifo(out, 2 * WATERMARK));
+    TEST_ASSERT_FALSE(mock->int1());
+}
+
+/*********** 解析 ***********/
+// 一个数据组的字序为 Gx Gy Gz XLx XLy XLz，读出后转换为 [acc gyr]
+void test_block_is_parsed_in_order(void) {
+    push(0, WATERMARK);
+    ImuFrame out[2 * WATERMARK];
+    TEST_ASSERT_EQUAL(WATERMARK, imu->readFifo(out, 2 * WATERMARK));
+    expectFrames(out, WATERMARK, 0);
+    TEST_ASSERT_EQUAL(0, mock->fifoWords());
+    TEST_ASSERT_EQUAL(0, imu->fifoOverruns());
+}
+
+// 整块只需一次状态读取 + 一次突发读取（各为一次写地址 + 一次读）
+void test_block_costs_two_bus_reads(void) {
+    push(0, WATERMARK);
+    uint32_t t0 = mock->transactions();
+    ImuFrame out[WATERMARK];
+    TEST_ASSERT_EQUAL(WATERMARK, imu->readFifo(out, WATERMARK));
+    TEST_ASSERT_EQUAL(4, mock->transactions() - t0);
+}
+
+void test_max_frames_leaves_rest_queued(void) {
+    push(0, 30);
+    ImuFrame out[30];
+    TEST_ASSERT_EQUAL(10, imu->readFifo(out, 10));
+    expectFrames(out, 10, 0);
+    TEST_ASSERT_EQUAL(20 * FIFO_FRAME_WORDS, mock->fifoWords());
+    TEST_ASSERT_EQUAL(20, imu->readFifo(out, 30));
+    expectFrames(out, 20, 10);
+}
+
+void test_empty_fifo_returns_nothing(void) {
+    ImuFrame out[4];
+    TEST_ASSERT_EQUAL(0, imu->readFifo(out, 4));
+}
+
+// 读指针停在数据组中间（例如上次读取被打断）：丢弃残缺的一组后从下一组起对齐
+void test_misaligned_pattern_skips_partial_frame(void) {
+    push(0, 3);
+    uint8_t junk[4];
+    TEST_ASSERT_EQUAL(0, imu->rN(FIFO_DATA_OUT_L, junk, sizeof(junk)));  // 读走 2 个字
+
+    ImuFrame out[4];
+    TEST_ASSERT_EQUAL(2, imu->readFifo(out, 4));
+    expectFrames(out, 2, 1);
+}
+
+// 溢出：连续模式覆盖最旧的数据，驱动计数一次溢出并重新对齐到完整的数据组。
+// FIFO 满时 DIFF_FIFO 饱和为 2047，最新的一组留到下一次读取
+void test_overflow_counts_and_resynchronizes(void) {
+    const int total = 400;  // 2400 字 > 2048 字容量
+    push(0, total);
+    TEST_ASSERT_TRUE(mock->fifoDropped() > 0);
+
+    static ImuFrame out[FIFO_CAPACITY_WORDS / FIFO_FRAME_WORDS];
+    const size_t maxFrames = sizeof(out) / sizeof(out[0]);
+    size_t n = imu->readFifo(out, maxFrames);
+    TEST_ASSERT_EQUAL(1, imu->fifoOverruns());
+    TEST_ASSERT_TRUE(n > 0);
+    // 第一组是被覆盖部分之后第一个完整的数据组，之后连续
+    const int first = (int)((mock->fifoDropped() + FIFO_FRAME_WORDS - 1) / FIFO_FRAME_WORDS);
+    expectFrames(out, n, first);
+
+    size_t rest = imu->readFifo(out, maxFrames);
+    expectFrames(out, rest, first + (int)n);
+    TEST_ASSERT_EQUAL(total, first + (int)(n + rest));
+
+    // 溢出标志随读出清除，之后的数据正常
+    push(total, total + WATERMARK);
+    TEST_ASSERT_EQUAL(WATERMARK, imu->readFifo(out, maxFrames));
+    expectFrames(out, WATERMARK, total);
+    TEST_ASSERT_EQUAL(1, imu->fifoOverruns());
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_enable_programs_watermark_and_mode);
+    RUN_TEST(test_int1_follows_watermark);
+    RUN_TEST(test_block_is_parsed_in_order);
+    RUN_TEST(test_block_costs_two_bus_reads);
+    RUN_TEST(test_max_frames_leaves_rest_queued);
+    RUN_TEST(test_empty_fifo_returns_nothing);
+    RUN_TEST(test_misaligned_pattern_skips_partial_frame);
+    RUN_TEST(test_overflow_counts_and_resynchronizes);
+    return UNITY_END();
+}
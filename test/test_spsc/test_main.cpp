@@ -0,0 +1,140 @@
+#include <stdint.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <unity.h>
+#include "SpscRing.h"
+
+/*************************************
+ *  SpscRing 单元测试                 *
+ *  单线程检查边界行为，多线程用       *
+ *  std::thread 压力测试批量读写       *
+ *************************************/
+// pio test -e native -f test_spsc
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/*********** 单线程 ***********/
+// 空间不足时 pushAll 一个都不写，并计入一次溢出
+void test_push_all_is_all_or_nothing(void) {
+    static SpscRing<uint32_t, 8> ring;
+    uint32_t src[8] = {0, 1, 2, 3, 4, 5, 6, 7}, dst[8];
+    TEST_ASSERT_TRUE(ring.pushAll(src, 5));
+    TEST_ASSERT_FALSE(ring.pushAll(src + 5, 4));  // 只剩 3 个位置
+    TEST_ASSERT_EQUAL(1, ring.overruns());
+    TEST_ASSERT_EQUAL(5, ring.size());
+    TEST_ASSERT_TRUE(ring.pushAll(src + 5, 3));   // 正好写满
+    TEST_ASSERT_EQUAL(8, ring.size());
+    TEST_ASSERT_FALSE(ring.push(src[0]));
+    TEST_ASSERT_EQUAL(2, ring.overruns());
+
+    TEST_ASSERT_EQUAL(8, ring.popMany(dst, 8));
+    for (uint32_t i = 0; i < 8; i++) TEST_ASSERT_EQUAL(i, dst[i]);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_push_all_larger_than_capacity_fails(void) {
+    static SpscRing<uint32_t, 8> ring;
+    uint32_t src[9] = {0};
+    TEST_ASSERT_FALSE(ring.pushAll(src, 9));
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_TRUE(ring.pushAll(src, 0));  // 空写入总是成功
+}
+
+void test_pop_many_returns_at_most_available(void) {
+    static SpscRing<uint32_t, 8> ring;
+    uint32_t src[3] = {7, 8, 9}, dst[8] = {0};
+    TEST_ASSERT_EQUAL(0, ring.popMany(dst, 8));
+    ring.pushAll(src, 3);
+    TEST_ASSERT_EQUAL(2, ring.popMany(dst, 2));
+    TEST_ASSERT_EQUAL(7, dst[0]);
+    TEST_ASSERT_EQUAL(8, dst[1]);
+    TEST_ASSERT_EQUAL(1, ring.popMany(dst, 8));
+    TEST_ASSERT_EQUAL(9, dst[0]);
+}
+
+// 每个起点都让一块数据跨过缓冲末尾
+void test_bulk_copy_wraps_around_the_end(void) {
+    static SpscRing<uint32_t, 8> ring;
+    uint32_t seq = 0, expect = 0, src[8], dst[8];
+    for (int start = 0; start < 8; start++) {
+        for (int n = 1; n <= 8; n++) {
+            for (int i = 0; i < n; i++) src[i] = seq++;
+            TEST_ASSERT_TRUE(ring.pushAll(src, n));
+            size_t got = ring.popMany(dst, 8);
+            TEST_ASSERT_EQUAL(n, got);
+            for (size_t i = 0; i < got; i++) TEST_ASSERT_EQUAL(expect++, dst[i]);
+        }
+        uint32_t one = seq++;  // 错开下一轮的起点
+        ring.push(one);
+        TEST_ASSERT_EQUAL(1, ring.popMany(dst, 8));
+        TEST_ASSERT_EQUAL(expect++, dst[0]);
+    }
+    TEST_ASSERT_EQUAL(0, ring.overruns());
+}
+
+/*********** 多线程压力测试 ***********/
+// 生产者以随机长度（1..Capacity）的整块 pushAll 写入连续序号，满时重试；
+// 消费者以随机上限 popMany 读出并逐个校验序号：不丢、不乱序、不重复。
+// 生产者统计的失败次数必须与 overruns() 一致
+// T 为 uint8_t 时序号按 256 取模（与固件的遥测 / 二进制日志字节流相同）
+template <class T, size_t Capacity>
+static void stress(uint32_t items) {
+    static SpscRing<T, Capacity> ring;
+    std::atomic<uint32_t> failed(0);
+
+    std::thread producer([&] {
+        std::mt19937 rng(1);
+        std::uniform_int_distribution<uint32_t> len(1, Capacity);
+        T chunk[Capacity];
+        uint32_t seq = 0, fails = 0;
+        while (seq < items) {
+            uint32_t n = std::min(len(rng), items - seq);
+            for (uint32_t i = 0; i < n; i++) chunk[i] = (T)(seq + i);
+            while (!ring.pushAll(chunk, n)) {
+                ++fails;
+                std::this_thread::yield();
+            }
+            seq += n;
+        }
+        failed = fails;
+    });
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<uint32_t> len(1, Capacity + 7);
+    T dst[Capacity + 7];
+    uint32_t expect = 0, bad = 0, polls = 0;
+    while (expect < items) {
+        size_t n = ring.popMany(dst, len(rng));
+        if (n == 0 && (++polls & 15) == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; i++) bad += dst[i] != (T)expect++;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL(0, bad);
+    TEST_ASSERT_EQUAL(items, expect);
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL(failed.load(), ring.overruns());
+}
+
+// 小缓冲：几乎每次写入都碰到缓冲满
+void test_stress_small_ring_often_full(void) { stress<uint32_t, 8>(2000000); }
+
+// 与固件帧缓冲相同的容量
+void test_stress_frame_ring_size(void) { stress<uint32_t, 256>(4000000); }
+
+// 字节流：变长记录整块写入、整块读出，与遥测 / 二进制日志的用法相同
+void test_stress_byte_stream(void) { stress<uint8_t, 1024>(8000000); }
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_push_all_is_all_or_nothing);
+    RUN_TEST(test_push_all_larger_than_capacity_fails);
+    RUN_TEST(test_pop_many_returns_at_most_available);
+    RUN_TEST(test_bulk_copy_wraps_around_the_end);
+    RUN_TEST(test_stress_small_ring_often_full);
+    RUN_TEST(test_stress_frame_ring_size);
+    RUN_TEST(test_stress_byte_stream);
+    return UNITY_END();
+}